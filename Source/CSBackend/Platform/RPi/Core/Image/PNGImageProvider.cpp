@@ -131,7 +131,7 @@ namespace CSBackend
 		//---------------------------------------------------------------------------------
 		void PNGImageProvider::CreateResourceFromFileAsync(ChilliSource::StorageLocation storageLocation, const std::string& filePath, const ChilliSource::IResourceOptionsBaseCSPtr& options, const ChilliSource::ResourceProvider::AsyncLoadDelegate& delegate, const ChilliSource::ResourceSPtr& out_resource)
 		{
-			ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_file, [=](const ChilliSource::TaskContext&)
+			ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const ChilliSource::TaskContext&)
 			{
 				CreatePNGImageFromFile(storageLocation, filePath, delegate, out_resource);
 			});
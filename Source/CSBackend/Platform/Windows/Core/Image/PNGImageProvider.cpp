@@ -131,7 +131,7 @@ namespace CSBackend
 		//----------------------------------------------------
 		void PNGImageProvider::CreateResourceFromFileAsync(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filePath, const ChilliSource::IResourceOptionsBaseCSPtr& in_options, const ChilliSource::ResourceProvider::AsyncLoadDelegate& in_delegate, const ChilliSource::ResourceSPtr& out_resource)
 		{
-			ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_file, [=](const ChilliSource::TaskContext&)
+			ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const ChilliSource::TaskContext&)
 			{
 				CreatePNGImageFromFile(in_storageLocation, in_filePath, in_delegate, out_resource);
 			});
@@ -32,10 +32,14 @@
 extern PFNGLGENVERTEXARRAYSOESPROC glGenVertexArraysOESEXT;
 extern PFNGLBINDVERTEXARRAYOESPROC glBindVertexArrayOESEXT;
 extern PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArraysOESEXT;
+extern PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstancedEXTEXT;
+extern PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisorEXTEXT;
 
 #   define glGenVertexArraysOES glGenVertexArraysOESEXT
 #   define glBindVertexArrayOES glBindVertexArrayOESEXT
 #   define glDeleteVertexArraysOES glDeleteVertexArraysOESEXT
+#   define glDrawElementsInstancedEXT glDrawElementsInstancedEXTEXT
+#   define glVertexAttribDivisorEXT glVertexAttribDivisorEXTEXT
 #endif
 
 #ifdef CS_OPENGLVERSION_ES
@@ -43,6 +47,9 @@ extern PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArraysOESEXT;
 #   define glBindVertexArray glBindVertexArrayOES
 #   define glGenVertexArrays glGenVertexArraysOES
 
+#   define glDrawElementsInstanced glDrawElementsInstancedEXT
+#   define glVertexAttribDivisor glVertexAttribDivisorEXT
+
 #   define GL_WRITE_ONLY GL_WRITE_ONLY_OES
 #   define glMapBuffer glMapBufferOES
 #   define glUnmapBuffer glUnmapBufferOES
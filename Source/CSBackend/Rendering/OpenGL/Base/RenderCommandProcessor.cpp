@@ -37,6 +37,8 @@
 #include <CSBackend/Rendering/OpenGL/Texture/GLCubemap.h>
 #include <CSBackend/Rendering/OpenGL/Texture/GLTexture.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
 #include <ChilliSource/Rendering/Model/IndexFormat.h>
 #include <ChilliSource/Rendering/Model/PolygonType.h>
 #include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
@@ -61,6 +63,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadCubemapRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreCubemapRenderCommand.h>
@@ -87,6 +90,7 @@ namespace CSBackend
             const std::string k_uniformWorldMat = "u_worldMat";
             const std::string k_uniformViewMat = "u_viewMat";
             const std::string k_uniformNormalMat = "u_normalMat";
+            const std::string k_uniformVPMat = "u_vpMat";
             
             /// Converts from a ChilliSource polygon type to a OpenGL polygon type.
             ///
@@ -212,6 +216,9 @@ namespace CSBackend
                         case ChilliSource::RenderCommand::Type::k_renderInstance:
                             RenderInstance(static_cast<const ChilliSource::RenderInstanceRenderCommand*>(renderCommand));
                             break;
+                        case ChilliSource::RenderCommand::Type::k_renderInstances:
+                            RenderInstances(static_cast<const ChilliSource::RenderInstancesRenderCommand*>(renderCommand));
+                            break;
                         case ChilliSource::RenderCommand::Type::k_end:
                             End();
                             break;
@@ -248,6 +255,8 @@ namespace CSBackend
             {
                 m_glDynamicMesh->Invalidate();
             }
+            
+            m_instanceBufferHandle = 0;
         }
         
         //------------------------------------------------------------------------------
@@ -257,6 +266,11 @@ namespace CSBackend
             
             m_glDynamicMesh.reset();
             m_glDynamicMesh = GLDynamicMeshUPtr(new GLDynamicMesh(ChilliSource::RenderDynamicMesh::k_maxVertexDataSize, ChilliSource::RenderDynamicMesh::k_maxIndexDataSize));
+            
+            if (m_isInstancingSupported)
+            {
+                glGenBuffers(1, &m_instanceBufferHandle);
+            }
         }
         
         //------------------------------------------------------------------------------
@@ -266,6 +280,12 @@ namespace CSBackend
             m_textureUnitManager = GLTextureUnitManagerUPtr(new GLTextureUnitManager());
             m_glDynamicMesh = GLDynamicMeshUPtr(new GLDynamicMesh(ChilliSource::RenderDynamicMesh::k_maxVertexDataSize, ChilliSource::RenderDynamicMesh::k_maxIndexDataSize));
             
+            m_isInstancingSupported = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderCapabilities>()->IsInstancingSupported();
+            if (m_isInstancingSupported)
+            {
+                glGenBuffers(1, &m_instanceBufferHandle);
+            }
+            
             ResetCache();
         }
         
@@ -279,6 +299,13 @@ namespace CSBackend
             //TODO: Should be pooled.
             auto glShader = new GLShader(renderCommand->GetVertexShader(), renderCommand->GetFragmentShader());
             
+            // Without a variant runs of instances are drawn one at a time, so there's no need to build it
+            // if instancing isn't supported.
+            if (m_isInstancingSupported && !renderCommand->GetInstancedVertexShader().empty())
+            {
+                glShader->SetInstancedVariant(GLShaderUPtr(new GLShader(renderCommand->GetInstancedVertexShader(), renderCommand->GetFragmentShader())));
+            }
+            
             renderShader->SetExtraData(glShader);
         }
         
@@ -488,15 +515,21 @@ namespace CSBackend
                 m_textureUnitManager->Bind(GL_TEXTURE_2D, m_currentMaterial->GetRenderTextures2D(), 0u);
                 m_textureUnitManager->Bind(GL_TEXTURE_CUBE_MAP, m_currentMaterial->GetRenderTexturesCubemap(), u32(m_currentMaterial->GetRenderTextures2D().size()));
                 
-                m_currentCamera.Apply(glShader);
-                
-                GLMaterial::Apply(renderMaterial, glShader);
-                
-                if (m_currentLight)
-                {
-                    // The light may bind additional textures, meaning it must be applied after the material is applied.
-                    m_currentLight->Apply(glShader, m_textureUnitManager.get());
-                }
+                ApplyCurrentMaterialUniforms(glShader);
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::ApplyCurrentMaterialUniforms(GLShader* glShader) noexcept
+        {
+            m_currentCamera.Apply(glShader);
+            
+            GLMaterial::Apply(m_currentMaterial, glShader);
+            
+            if (m_currentLight)
+            {
+                // The light may bind additional textures, meaning it must be applied after the material is applied.
+                m_currentLight->Apply(glShader, m_textureUnitManager.get());
             }
         }
         
@@ -597,11 +630,64 @@ namespace CSBackend
             CS_ASSERT(m_currentShader, "A shader must be applied before rendering a mesh.");
             
             auto glShader = static_cast<GLShader*>(m_currentShader->GetExtraData());
-            glShader->SetUniform(k_uniformWorldMat, renderCommand->GetWorldMatrix(), GLShader::FailurePolicy::k_silent);
             glShader->SetUniform(k_uniformViewMat, m_currentCamera.GetViewMatrix(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformWVPMat, renderCommand->GetWorldMatrix() * m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformNormalMat, ChilliSource::Matrix4::Transpose(ChilliSource::Matrix4::Inverse(renderCommand->GetWorldMatrix())), GLShader::FailurePolicy::k_silent);
             
+            ApplyInstanceWorldMatrix(glShader, renderCommand->GetWorldMatrix());
+            DrawCurrentMesh();
+            
+            if (!m_currentMesh)
+            {
+                m_glDynamicMesh->SwitchBuffer();
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while rendering an instance.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::RenderInstances(const ChilliSource::RenderInstancesRenderCommand* renderCommand) noexcept
+        {
+            CS_ASSERT(m_currentMaterial, "A material must be applied before rendering a mesh.");
+            CS_ASSERT(m_currentShader, "A shader must be applied before rendering a mesh.");
+            
+            auto glShader = static_cast<GLShader*>(m_currentShader->GetExtraData());
+            glShader->SetUniform(k_uniformViewMat, m_currentCamera.GetViewMatrix(), GLShader::FailurePolicy::k_silent);
+            
+            auto worldMatrices = renderCommand->GetWorldMatrices();
+            auto numInstances = renderCommand->GetNumInstances();
+            
+            auto glInstancedShader = glShader->GetInstancedVariant();
+            if (glInstancedShader && m_currentMesh && m_currentMesh->GetNumIndices() > 0)
+            {
+                DrawCurrentMeshInstanced(glShader, glInstancedShader, worldMatrices, numInstances);
+            }
+            else
+            {
+                for (u32 i = 0; i < numInstances; ++i)
+                {
+                    ApplyInstanceWorldMatrix(glShader, worldMatrices[i]);
+                    DrawCurrentMesh();
+                }
+            }
+            
+            if (!m_currentMesh)
+            {
+                m_glDynamicMesh->SwitchBuffer();
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while rendering instances.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::ApplyInstanceWorldMatrix(GLShader* glShader, const ChilliSource::Matrix4& worldMatrix) noexcept
+        {
+            glShader->SetUniform(k_uniformWorldMat, worldMatrix, GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformWVPMat, worldMatrix * m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformNormalMat, ChilliSource::Matrix4::Transpose(ChilliSource::Matrix4::Inverse(worldMatrix)), GLShader::FailurePolicy::k_silent);
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::DrawCurrentMesh() noexcept
+        {
             if (m_currentMesh)
             {
                 if (m_currentMesh->GetNumIndices() > 0)
@@ -623,11 +709,51 @@ namespace CSBackend
                 {
                     glDrawArrays(ToGLPolygonType(m_glDynamicMesh->GetPolygonType()), 0, m_glDynamicMesh->GetNumVertices());
                 }
-                
-                m_glDynamicMesh->SwitchBuffer();
             }
+        }
+        
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::DrawCurrentMeshInstanced(GLShader* glShader, GLShader* glInstancedShader, const ChilliSource::Matrix4* worldMatrices, u32 numInstances) noexcept
+        {
+            CS_ASSERT(m_isInstancingSupported, "Instancing must be supported to draw instanced.");
+            CS_ASSERT(m_currentMesh && m_currentMesh->GetNumIndices() > 0, "An indexed mesh must be applied to draw instanced.");
             
-            CS_ASSERT_NOGLERROR("An OpenGL error occurred while rendering an instance.");
+            // The variant is a separate program, so it needs the current uniforms and its own mesh bindings. The
+            // mesh caches a VAO per shader, so the bindings are only set up the first time.
+            auto glMesh = static_cast<GLMesh*>(m_currentMesh->GetExtraData());
+            glInstancedShader->Bind();
+            glMesh->Bind(glInstancedShader);
+            
+            ApplyCurrentMaterialUniforms(glInstancedShader);
+            glInstancedShader->SetUniform(k_uniformViewMat, m_currentCamera.GetViewMatrix(), GLShader::FailurePolicy::k_silent);
+            glInstancedShader->SetUniform(k_uniformVPMat, m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
+            
+            // The buffer is orphaned each draw so the driver doesn't have to wait on the previous contents.
+            glBindBuffer(GL_ARRAY_BUFFER, m_instanceBufferHandle);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(ChilliSource::Matrix4) * numInstances, worldMatrices, GL_STREAM_DRAW);
+            
+            // The attribute state is recorded in the mesh's VAO, so it's reset once the draw is issued.
+            GLuint attribHandle = GLuint(glInstancedShader->GetInstanceWorldMatrixAttributeHandle());
+            for (GLuint column = 0; column < 4; ++column)
+            {
+                auto offset = reinterpret_cast<const GLvoid*>(u64(sizeof(ChilliSource::Vector4) * column));
+                glEnableVertexAttribArray(attribHandle + column);
+                glVertexAttribPointer(attribHandle + column, 4, GL_FLOAT, GL_FALSE, sizeof(ChilliSource::Matrix4), offset);
+                glVertexAttribDivisor(attribHandle + column, 1);
+            }
+            
+            glDrawElementsInstanced(ToGLPolygonType(m_currentMesh->GetPolygonType()), m_currentMesh->GetNumIndices(), ToGLIndexType(m_currentMesh->GetIndexFormat()), 0, GLsizei(numInstances));
+            
+            for (GLuint column = 0; column < 4; ++column)
+            {
+                glVertexAttribDivisor(attribHandle + column, 0);
+                glDisableVertexAttribArray(attribHandle + column);
+            }
+            
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            
+            glShader->Bind();
+            glMesh->Bind(glShader);
         }
         
         //------------------------------------------------------------------------------
@@ -196,6 +196,15 @@ namespace CSBackend
             ///
             void ApplyMaterial(const ChilliSource::ApplyMaterialRenderCommand* renderCommand) noexcept;
             
+            /// Sets the uniforms of the given shader from the current camera, material and light.
+            /// The shader must be bound, and the textures of the current material must already be
+            /// bound.
+            ///
+            /// @param glShader
+            ///     The shader to apply the uniforms to.
+            ///
+            void ApplyCurrentMaterialUniforms(GLShader* glShader) noexcept;
+            
             /// Applies the given mesh to the OpenGL Context.
             ///
             /// @param renderCommand
@@ -233,6 +242,51 @@ namespace CSBackend
             ///
             void RenderInstance(const ChilliSource::RenderInstanceRenderCommand* renderCommand) noexcept;
             
+            /// Renders an instance of the mesh described by the current OpenGL context state for each
+            /// world matrix in the command. A camera, material and mesh must all currently be appled to
+            /// the context.
+            ///
+            /// If the shader has an instanced variant and the mesh is indexed, all instances are
+            /// rendered in a single instanced draw call using the variant. Otherwise each instance is
+            /// drawn separately, with per-instance state supplied through the same uniforms as
+            /// RenderInstance().
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void RenderInstances(const ChilliSource::RenderInstancesRenderCommand* renderCommand) noexcept;
+            
+            /// Sets the world, world view projection and normal matrix uniforms for a single instance
+            /// of the current mesh.
+            ///
+            /// @param glShader
+            ///     The currently applied shader.
+            /// @param worldMatrix
+            ///     The world matrix of the instance.
+            ///
+            void ApplyInstanceWorldMatrix(GLShader* glShader, const ChilliSource::Matrix4& worldMatrix) noexcept;
+            
+            /// Issues the draw call for the currently applied mesh or dynamic mesh.
+            ///
+            void DrawCurrentMesh() noexcept;
+            
+            /// Issues a single instanced draw call for the currently applied mesh using the instanced
+            /// variant of the current shader, streaming the world matrices into its per-instance world
+            /// matrix attribute. The variant is given the view projection matrix rather than the world
+            /// view projection and normal matrices. The current mesh must be indexed. The current
+            /// shader and mesh are re-bound afterwards.
+            ///
+            /// @param glShader
+            ///     The currently applied shader.
+            /// @param glInstancedShader
+            ///     The instanced variant of the currently applied shader.
+            /// @param worldMatrices
+            ///     The world matrix of each instance.
+            /// @param numInstances
+            ///     The number of instances.
+            ///
+            void DrawCurrentMeshInstanced(GLShader* glShader, GLShader* glInstancedShader, const ChilliSource::Matrix4* worldMatrices, u32 numInstances) noexcept;
+            
             /// Ends rendering to the current render target.
             ///
             void End() noexcept;
@@ -277,6 +331,8 @@ namespace CSBackend
             void ResetCache() noexcept;
             
             bool m_initRequired = true;
+            bool m_isInstancingSupported = false;
+            GLuint m_instanceBufferHandle = 0;
             
             GLTextureUnitManagerUPtr m_textureUnitManager;
             GLDynamicMeshUPtr m_glDynamicMesh;
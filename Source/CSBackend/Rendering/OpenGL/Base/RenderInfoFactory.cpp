@@ -53,6 +53,7 @@ namespace CSBackend
             bool areHighPrecFragmentsSupported = true;
             bool areMapBuffersSupported = true;
             bool areVAOsSupported = true;
+            bool isInstancingSupported = false;
             bool areDepthTexturesSupported = false;
             bool areShadowMapsSupported = false;
             
@@ -71,6 +72,11 @@ namespace CSBackend
             //Check for map buffer support
             areMapBuffersSupported = CheckForOpenGLExtension("GL_OES_mapbuffer");
             areVAOsSupported = CheckForOpenGLExtension("GL_OES_vertex_array_object");
+            isInstancingSupported = CheckForOpenGLExtension("GL_EXT_instanced_arrays");
+#endif
+            
+#ifdef CS_TARGETPLATFORM_IOS
+            isInstancingSupported = CheckForOpenGLExtension("GL_EXT_instanced_arrays");
 #endif
             
 #ifdef CS_TARGETPLATFORM_RPI
@@ -81,6 +87,7 @@ namespace CSBackend
             
 #ifdef CS_OPENGLVERSION_STANDARD
             areDepthTexturesSupported = CheckForOpenGLExtension("GL_ARB_depth_texture");
+            isInstancingSupported = (GLEW_VERSION_3_3 != 0);
 #elif defined(CS_OPENGLVERSION_ES)
             areDepthTexturesSupported = CheckForOpenGLExtension("GL_OES_depth_texture");
 #endif
@@ -91,7 +98,7 @@ namespace CSBackend
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while getting render capabilities.");
             
-            ChilliSource::RenderInfo renderInfo(areShadowMapsSupported, areDepthTexturesSupported, areMapBuffersSupported, areVAOsSupported, areHighPrecFragmentsSupported, maxTextureSize, maxTextureUnits, maxVertexAttribs);
+            ChilliSource::RenderInfo renderInfo(areShadowMapsSupported, areDepthTexturesSupported, areMapBuffersSupported, areVAOsSupported, isInstancingSupported, areHighPrecFragmentsSupported, maxTextureSize, maxTextureUnits, maxVertexAttribs);
             
             return renderInfo;
         }
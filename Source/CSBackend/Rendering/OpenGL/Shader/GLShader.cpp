@@ -127,6 +127,7 @@ namespace CSBackend
         const std::string GLShader::k_attributeColour = "a_colour";
         const std::string GLShader::k_attributeWeights = "a_weights";
         const std::string GLShader::k_attributeJointIndices = "a_jointIndices";
+        const std::string GLShader::k_attributeInstanceWorldMatrix = "a_instanceWorldMat";
     
         //------------------------------------------------------------------------------
         GLShader::GLShader(const std::string& vertexShader, const std::string& fragmentShader) noexcept
@@ -286,9 +287,30 @@ namespace CSBackend
 				}
             }
             
+            m_instanceWorldMatrixAttributeHandle = glGetAttribLocation(m_programId, k_attributeInstanceWorldMatrix.c_str());
+            
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while populating attribute handles.");
         }
         
+        //------------------------------------------------------------------------------
+        void GLShader::SetInstancedVariant(GLShaderUPtr instancedVariant) noexcept
+        {
+            CS_ASSERT(instancedVariant->GetInstanceWorldMatrixAttributeHandle() >= 0, "The instanced variant of a shader must declare '" + k_attributeInstanceWorldMatrix + "'.");
+            
+            m_instancedVariant = std::move(instancedVariant);
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLShader::Invalidate() noexcept
+        {
+            m_invalidData = true;
+            
+            if (m_instancedVariant)
+            {
+                m_instancedVariant->Invalidate();
+            }
+        }
+        
         //------------------------------------------------------------------------------
         GLint GLShader::GetUniformHandle(const std::string& name, FailurePolicy failurePolicy) noexcept
         {
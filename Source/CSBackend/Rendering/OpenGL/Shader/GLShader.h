@@ -61,6 +61,7 @@ namespace CSBackend
             static const std::string k_attributeColour;
             static const std::string k_attributeWeights;
             static const std::string k_attributeJointIndices;
+            static const std::string k_attributeInstanceWorldMatrix;
             
             /// An enum describing the different types of failure policy. This is used when setting
             /// uniforms to judge if an assertion should occur when the uniform doesn't exist.
@@ -189,6 +190,27 @@ namespace CSBackend
             ///
             GLint GetAttributeHandle(u32 index) const noexcept { return m_attributeHandles[index]; }
             
+            /// The per-instance world matrix is a mat4 attribute, so it occupies four consecutive
+            /// attribute locations starting at the returned handle; one per matrix column.
+            ///
+            /// @return Handle of the per-instance world matrix attribute in the shader. -1 if the
+            ///     shader doesn't support instancing.
+            ///
+            GLint GetInstanceWorldMatrixAttributeHandle() const noexcept { return m_instanceWorldMatrixAttributeHandle; }
+            
+            /// Sets the variant of this shader which should be used when drawing multiple instances
+            /// in a single call. The variant must declare the per-instance world matrix attribute.
+            ///
+            /// @param instancedVariant
+            ///     The instanced variant of this shader.
+            ///
+            void SetInstancedVariant(GLShaderUPtr instancedVariant) noexcept;
+            
+            /// @return The variant of this shader which should be used when drawing multiple
+            ///     instances in a single call, or null if there isn't one.
+            ///
+            GLShader* GetInstancedVariant() const noexcept { return m_instancedVariant.get(); }
+            
             /// Sets the attribute with the given name and data information. If the attribute doesn't
             /// exist then it will be ignored.
             ///
@@ -211,7 +233,7 @@ namespace CSBackend
             /// on Android. Function will set a flag to handle safe destructing of this object, preventing
             /// us from trying to delete invalid memory.
             ///
-            void Invalidate() noexcept { m_invalidData = true; }
+            void Invalidate() noexcept;
             
             /// Unloads the opengl shader.
             ///
@@ -240,6 +262,8 @@ namespace CSBackend
             GLuint m_programId = 0;
             std::unordered_map<std::string, GLint> m_uniformHandles;
             std::array<GLint, k_numAttributes> m_attributeHandles;
+            GLint m_instanceWorldMatrixAttributeHandle = -1;
+            GLShaderUPtr m_instancedVariant;
             
             bool m_invalidData = false;
         };
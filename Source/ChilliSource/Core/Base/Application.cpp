@@ -40,6 +40,7 @@
 #include <ChilliSource/Core/Image/PNGImageProvider.h>
 #include <ChilliSource/Core/Localisation/LocalisedText.h>
 #include <ChilliSource/Core/Localisation/LocalisedTextProvider.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Core/Scene/Scene.h>
 #include <ChilliSource/Core/State/State.h>
@@ -309,6 +310,7 @@ namespace ChilliSource
         m_fileSystem = CreateSystem<FileSystem>();
         m_stateManager = CreateSystem<StateManager>();
         m_resourcePool = CreateSystem<ResourcePool>();
+        CreateSystem<MemoryTracker>();
         m_taggedPathResolver = CreateSystem<TaggedFilePathResolver>();
         CreateSystem<AppDataStore>();
         CreateSystem<CSImageProvider>();
@@ -445,7 +447,7 @@ namespace ChilliSource
         }
 
         
-        RenderSnapshot renderSnapshot = m_renderer->CreateRenderSnapshot(targetGroup, resolution, clearColour, GenerateRenderCamera(scene));
+        RenderSnapshot renderSnapshot = m_renderer->CreateRenderSnapshot(frameAllocator, targetGroup, resolution, clearColour, GenerateRenderCamera(scene));
         
         for (const AppSystemUPtr& system : m_systems)
         {
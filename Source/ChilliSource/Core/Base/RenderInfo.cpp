@@ -26,12 +26,13 @@
 
 namespace ChilliSource
 {
-    RenderInfo::RenderInfo(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isVAOSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits, u32 maxVertexAttribs) noexcept
+    RenderInfo::RenderInfo(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isVAOSupported, bool isInstancingSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits, u32 maxVertexAttribs) noexcept
         :
     m_isShadowMapsSupported(isShadowMapsSupported),
     m_isDepthTexturesSupported(isDepthTexturesSupported),
     m_isMapBuffersSupported(isMapBuffersSupported),
     m_isVAOSupported(isVAOSupported),
+    m_isInstancingSupported(isInstancingSupported),
     m_isHighPrecisionFloatsSupported(isHighPrecisionFloatsSupported),
     m_maxTextureSize(maxTextureSize),
     m_maxTextureUnits(numTextureUnits),
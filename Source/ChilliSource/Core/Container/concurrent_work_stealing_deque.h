@@ -0,0 +1,269 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_CONCURRENTWORKSTEALINGDEQUE_H_
+#define _CHILLISOURCE_CORE_CONTAINER_CONCURRENTWORKSTEALINGDEQUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A lock-free Chase-Lev work stealing deque. A single owner thread pushes and pops
+    /// objects at the bottom of the deque in LIFO order, while any number of other threads
+    /// can steal objects from the top in FIFO order.
+    ///
+    /// Objects are read speculatively by stealers, so the contained type must be trivially
+    /// copyable and small enough to be stored in a lock-free atomic, typically a pointer.
+    ///
+    /// The storage grows as required. Previous storage is retained until the deque is
+    /// destroyed, since a stealer may still be reading from it.
+    ///
+    /// push() and pop() must only be called from the owning thread. steal() and
+    /// empty() are thread-safe.
+    ///
+    template <typename TType> class concurrent_work_stealing_deque final
+    {
+    public:
+        CS_DECLARE_NOCOPY(concurrent_work_stealing_deque);
+
+        /// @param initialCapacity
+        ///     The initial capacity of the deque. This must be a power of two.
+        ///
+        concurrent_work_stealing_deque(std::size_t initialCapacity = 256) noexcept;
+
+        /// This may give a stale result if other threads are accessing the deque.
+        ///
+        /// @return Whether or not the deque contains any objects.
+        ///
+        bool empty() const noexcept;
+
+        /// Pushes the given object onto the bottom of the deque. This must only be called
+        /// from the owning thread.
+        ///
+        /// @param object
+        ///     The object to push.
+        ///
+        void push(TType object) noexcept;
+
+        /// Pops the most recently pushed object from the bottom of the deque. This must
+        /// only be called from the owning thread.
+        ///
+        /// @param out_object
+        ///     (Out) The popped object. This is only set if an object was popped.
+        ///
+        /// @return Whether or not an object was popped.
+        ///
+        bool pop(TType& out_object) noexcept;
+
+        /// Steals the least recently pushed object from the top of the deque. This can
+        /// be called from any thread. This can fail if another thread is contending for
+        /// the same object, even if the deque is not empty.
+        ///
+        /// @param out_object
+        ///     (Out) The stolen object. This is only set if an object was stolen.
+        ///
+        /// @return Whether or not an object was stolen.
+        ///
+        bool steal(TType& out_object) noexcept;
+
+    private:
+        /// A fixed size circular buffer of objects.
+        ///
+        class Buffer final
+        {
+        public:
+            /// @param capacity
+            ///     The capacity of the buffer. This must be a power of two.
+            ///
+            Buffer(std::size_t capacity) noexcept
+                : m_mask(s64(capacity) - 1), m_objects(new std::atomic<TType>[capacity])
+            {
+            }
+
+            /// @return The capacity of the buffer.
+            ///
+            s64 GetCapacity() const noexcept
+            {
+                return m_mask + 1;
+            }
+
+            /// @param index
+            ///     The unbounded index of the object.
+            ///
+            /// @return The object at the given index.
+            ///
+            TType Get(s64 index) const noexcept
+            {
+                return m_objects[index & m_mask].load(std::memory_order_relaxed);
+            }
+
+            /// @param index
+            ///     The unbounded index of the object.
+            /// @param object
+            ///     The object to store.
+            ///
+            void Set(s64 index, TType object) noexcept
+            {
+                m_objects[index & m_mask].store(object, std::memory_order_relaxed);
+            }
+
+        private:
+            const s64 m_mask;
+            std::unique_ptr<std::atomic<TType>[]> m_objects;
+        };
+
+        /// Replaces the current buffer with one twice the size, copying over all objects
+        /// in the given range. This must only be called from the owning thread.
+        ///
+        /// @param top
+        ///     The top index.
+        /// @param bottom
+        ///     The bottom index.
+        ///
+        /// @return The new buffer.
+        ///
+        Buffer* Grow(s64 top, s64 bottom) noexcept;
+
+        std::atomic<s64> m_top;
+        std::atomic<s64> m_bottom;
+        std::atomic<Buffer*> m_buffer;
+        std::vector<std::unique_ptr<Buffer>> m_buffers;
+    };
+
+    //------------------------------------------------------------------------------
+    template <typename TType> concurrent_work_stealing_deque<TType>::concurrent_work_stealing_deque(std::size_t initialCapacity) noexcept
+        : m_top(0), m_bottom(0)
+    {
+        CS_ASSERT(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0, "Capacity must be a power of two.");
+
+        m_buffers.push_back(std::unique_ptr<Buffer>(new Buffer(initialCapacity)));
+        m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> bool concurrent_work_stealing_deque<TType>::empty() const noexcept
+    {
+        s64 bottom = m_bottom.load(std::memory_order_relaxed);
+        s64 top = m_top.load(std::memory_order_relaxed);
+        return bottom <= top;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> void concurrent_work_stealing_deque<TType>::push(TType object) noexcept
+    {
+        s64 bottom = m_bottom.load(std::memory_order_relaxed);
+        s64 top = m_top.load(std::memory_order_acquire);
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+        if (bottom - top > buffer->GetCapacity() - 1)
+        {
+            buffer = Grow(top, bottom);
+        }
+
+        buffer->Set(bottom, object);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> bool concurrent_work_stealing_deque<TType>::pop(TType& out_object) noexcept
+    {
+        s64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        s64 top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        TType object = buffer->Get(bottom);
+
+        if (top == bottom)
+        {
+            // This is the last object, so we must race any stealers for it.
+            bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (!won)
+            {
+                return false;
+            }
+        }
+
+        out_object = object;
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> bool concurrent_work_stealing_deque<TType>::steal(TType& out_object) noexcept
+    {
+        s64 top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        s64 bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+        TType object = buffer->Get(top);
+
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        out_object = object;
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> typename concurrent_work_stealing_deque<TType>::Buffer* concurrent_work_stealing_deque<TType>::Grow(s64 top, s64 bottom) noexcept
+    {
+        Buffer* oldBuffer = m_buffer.load(std::memory_order_relaxed);
+        std::unique_ptr<Buffer> newBuffer(new Buffer(std::size_t(oldBuffer->GetCapacity() * 2)));
+
+        for (s64 i = top; i < bottom; ++i)
+        {
+            newBuffer->Set(i, oldBuffer->Get(i));
+        }
+
+        Buffer* output = newBuffer.get();
+        m_buffers.push_back(std::move(newBuffer));
+        m_buffer.store(output, std::memory_order_release);
+
+        return output;
+    }
+}
+
+#endif
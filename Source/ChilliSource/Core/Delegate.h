@@ -34,5 +34,6 @@
 #include <ChilliSource/Core/Delegate/DelegateConnection.h>
 #include <ChilliSource/Core/Delegate/MakeConnectableDelegate.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/Delegate/SmallDelegate.h>
 
 #endif
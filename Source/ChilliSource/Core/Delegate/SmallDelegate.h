@@ -0,0 +1,281 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_DELEGATE_SMALLDELEGATE_H_
+#define _CHILLISOURCE_CORE_DELEGATE_SMALLDELEGATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+    template <typename TSignature> class SmallDelegate;
+
+    /// A move-only, type erased callable, similar to std::function, which stores callables
+    /// of up to four pointers in size inline rather than on the heap. This is large enough
+    /// for a bound member function (an instance pointer plus a member function pointer) or
+    /// a std::function, so typical delegates never require a heap allocation. Larger
+    /// callables, or those which cannot be moved without throwing, fall back to the heap.
+    ///
+    /// This is not thread-safe.
+    ///
+    template <typename TReturnType, typename... TArgTypes> class SmallDelegate<TReturnType(TArgTypes...)> final
+    {
+    public:
+        static constexpr std::size_t k_inlineSize = 4 * sizeof(void*);
+
+        SmallDelegate() = default;
+
+        /// Constructs an empty delegate.
+        ///
+        SmallDelegate(std::nullptr_t) noexcept {}
+
+        /// Constructs a delegate from the given callable.
+        ///
+        /// @param callable
+        ///     The callable. This is copied or moved into the delegate.
+        ///
+        template <typename TCallable, typename = typename std::enable_if<!std::is_same<typename std::decay<TCallable>::type, SmallDelegate>::value>::type>
+        SmallDelegate(TCallable&& callable)
+        {
+            using CallableType = typename std::decay<TCallable>::type;
+            using Ops = typename std::conditional<IsStoredInline<CallableType>(), InlineOperations<CallableType>, HeapOperations<CallableType>>::type;
+
+            Ops::Construct(m_storage, std::forward<TCallable>(callable));
+            m_operations = &Ops::k_operations;
+        }
+
+        SmallDelegate(SmallDelegate&& toMove) noexcept
+        {
+            MoveFrom(toMove);
+        }
+
+        SmallDelegate& operator=(SmallDelegate&& toMove) noexcept
+        {
+            if (this != &toMove)
+            {
+                Reset();
+                MoveFrom(toMove);
+            }
+            return *this;
+        }
+
+        /// Destroys the stored callable, leaving the delegate empty.
+        ///
+        SmallDelegate& operator=(std::nullptr_t) noexcept
+        {
+            Reset();
+            return *this;
+        }
+
+        SmallDelegate(const SmallDelegate&) = delete;
+        SmallDelegate& operator=(const SmallDelegate&) = delete;
+
+        /// @return Whether or not the delegate holds a callable.
+        ///
+        explicit operator bool() const noexcept { return m_operations != nullptr; }
+
+        /// Invokes the stored callable. The delegate must not be empty.
+        ///
+        /// @param args
+        ///     The arguments to pass to the callable.
+        ///
+        /// @return The value returned by the callable.
+        ///
+        TReturnType operator()(TArgTypes... args) const
+        {
+            CS_ASSERT(m_operations != nullptr, "Cannot invoke an empty delegate.");
+            return m_operations->m_invoke(m_storage, std::forward<TArgTypes>(args)...);
+        }
+
+        ~SmallDelegate() noexcept
+        {
+            Reset();
+        }
+
+    private:
+        using Storage = typename std::aligned_storage<k_inlineSize, alignof(std::max_align_t)>::type;
+
+        /// The type specific operations for the stored callable.
+        ///
+        struct Operations final
+        {
+            TReturnType (*m_invoke)(Storage&, TArgTypes&&...);
+            void (*m_move)(Storage&, Storage&) noexcept;
+            void (*m_destroy)(Storage&) noexcept;
+        };
+
+        /// @return Whether or not a callable of the given type can be stored inline.
+        ///
+        template <typename TCallable> static constexpr bool IsStoredInline() noexcept
+        {
+            return sizeof(TCallable) <= sizeof(Storage) && alignof(Storage) % alignof(TCallable) == 0 && std::is_nothrow_move_constructible<TCallable>::value;
+        }
+
+        /// Operations for callables which are stored directly in the inline storage.
+        ///
+        template <typename TCallable> struct InlineOperations final
+        {
+            template <typename TCallableArg> static void Construct(Storage& storage, TCallableArg&& callable)
+            {
+                new (&storage) TCallable(std::forward<TCallableArg>(callable));
+            }
+
+            static TReturnType Invoke(Storage& storage, TArgTypes&&... args)
+            {
+                return static_cast<TReturnType>((*reinterpret_cast<TCallable*>(&storage))(std::forward<TArgTypes>(args)...));
+            }
+
+            static void Move(Storage& destination, Storage& source) noexcept
+            {
+                new (&destination) TCallable(std::move(*reinterpret_cast<TCallable*>(&source)));
+                reinterpret_cast<TCallable*>(&source)->~TCallable();
+            }
+
+            static void Destroy(Storage& storage) noexcept
+            {
+                reinterpret_cast<TCallable*>(&storage)->~TCallable();
+            }
+
+            static const Operations k_operations;
+        };
+
+        /// Operations for callables which are too large to store inline. The inline storage
+        /// holds a pointer to a heap allocated copy of the callable.
+        ///
+        template <typename TCallable> struct HeapOperations final
+        {
+            template <typename TCallableArg> static void Construct(Storage& storage, TCallableArg&& callable)
+            {
+                *reinterpret_cast<TCallable**>(&storage) = new TCallable(std::forward<TCallableArg>(callable));
+            }
+
+            static TReturnType Invoke(Storage& storage, TArgTypes&&... args)
+            {
+                return static_cast<TReturnType>((**reinterpret_cast<TCallable**>(&storage))(std::forward<TArgTypes>(args)...));
+            }
+
+            static void Move(Storage& destination, Storage& source) noexcept
+            {
+                *reinterpret_cast<TCallable**>(&destination) = *reinterpret_cast<TCallable**>(&source);
+            }
+
+            static void Destroy(Storage& storage) noexcept
+            {
+                delete *reinterpret_cast<TCallable**>(&storage);
+            }
+
+            static const Operations k_operations;
+        };
+
+        /// Moves the callable from the given delegate into this, which must be empty. The
+        /// given delegate is left empty.
+        ///
+        /// @param toMove
+        ///     The delegate to move from.
+        ///
+        void MoveFrom(SmallDelegate& toMove) noexcept
+        {
+            if (toMove.m_operations != nullptr)
+            {
+                toMove.m_operations->m_move(m_storage, toMove.m_storage);
+                m_operations = toMove.m_operations;
+                toMove.m_operations = nullptr;
+            }
+        }
+
+        /// Destroys the stored callable, if there is one.
+        ///
+        void Reset() noexcept
+        {
+            if (m_operations != nullptr)
+            {
+                auto operations = m_operations;
+                m_operations = nullptr;
+                operations->m_destroy(m_storage);
+            }
+        }
+
+        mutable Storage m_storage;
+        const Operations* m_operations = nullptr;
+    };
+
+    template <typename TReturnType, typename... TArgTypes> template <typename TCallable>
+    const typename SmallDelegate<TReturnType(TArgTypes...)>::Operations SmallDelegate<TReturnType(TArgTypes...)>::InlineOperations<TCallable>::k_operations =
+    {
+        &SmallDelegate<TReturnType(TArgTypes...)>::InlineOperations<TCallable>::Invoke,
+        &SmallDelegate<TReturnType(TArgTypes...)>::InlineOperations<TCallable>::Move,
+        &SmallDelegate<TReturnType(TArgTypes...)>::InlineOperations<TCallable>::Destroy
+    };
+
+    template <typename TReturnType, typename... TArgTypes> template <typename TCallable>
+    const typename SmallDelegate<TReturnType(TArgTypes...)>::Operations SmallDelegate<TReturnType(TArgTypes...)>::HeapOperations<TCallable>::k_operations =
+    {
+        &SmallDelegate<TReturnType(TArgTypes...)>::HeapOperations<TCallable>::Invoke,
+        &SmallDelegate<TReturnType(TArgTypes...)>::HeapOperations<TCallable>::Move,
+        &SmallDelegate<TReturnType(TArgTypes...)>::HeapOperations<TCallable>::Destroy
+    };
+
+    /// A callable which invokes a member function on an instance. Unlike the lambda
+    /// returned by MakeDelegate() this is small enough to be stored inline in a
+    /// SmallDelegate, and arguments are forwarded rather than copied.
+    ///
+    template <typename TSender, typename TMemberFunction> class MemberFunctionBinding final
+    {
+    public:
+        /// @param sender
+        ///     The instance to invoke the member function on.
+        /// @param memberFunction
+        ///     The member function.
+        ///
+        MemberFunctionBinding(TSender* sender, TMemberFunction memberFunction) noexcept
+            : m_sender(sender), m_memberFunction(memberFunction)
+        {
+        }
+
+        template <typename... TArgTypes> auto operator()(TArgTypes&&... args) const -> decltype((std::declval<TSender*>()->*std::declval<TMemberFunction>())(std::forward<TArgTypes>(args)...))
+        {
+            return (m_sender->*m_memberFunction)(std::forward<TArgTypes>(args)...);
+        }
+
+    private:
+        TSender* m_sender;
+        TMemberFunction m_memberFunction;
+    };
+
+    /// Converts a std::function type to the SmallDelegate type with the same signature.
+    ///
+    template <typename TFunctionType> struct SmallDelegateFromFunction;
+    template <typename TReturnType, typename... TArgTypes> struct SmallDelegateFromFunction<std::function<TReturnType(TArgTypes...)>> final
+    {
+        using Type = SmallDelegate<TReturnType(TArgTypes...)>;
+    };
+}
+
+#endif
@@ -140,6 +140,23 @@ namespace ChilliSource
         //----------------------------------------------------
         virtual void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept {};
         //----------------------------------------------------
+        /// Components which return true will have their
+        /// render snapshot event called on a background
+        /// thread, in parallel with other entity trees in the
+        /// scene. Such components must only modify state owned
+        /// by their own entity tree, must not access anything
+        /// which is restricted to the main thread, and must
+        /// only add to the given render snapshot. The frame
+        /// allocator is thread safe, so can be used freely.
+        ///
+        /// This is checked more than once per frame, so the
+        /// value must not change during the render snapshot.
+        ///
+        /// @return Whether or not the render snapshot event
+        /// can be called from a background thread.
+        //----------------------------------------------------
+        virtual bool IsRenderSnapshotThreadSafe() const noexcept { return false; }
+        //----------------------------------------------------
         /// Called when the application is backgrounded while
         /// the owning entity is in the scene. This will also
         /// be called when the owning entity is removed from
@@ -212,6 +212,8 @@ namespace ChilliSource
         
         if(GetScene() != nullptr)
         {
+            m_scene->RegisterComponent(in_component.get());
+            
             in_component->OnAddedToScene();
             if (m_appActive == true)
             {
@@ -245,6 +247,7 @@ namespace ChilliSource
                         in_component->OnSuspend();
                     }
                     in_component->OnRemovedFromScene();
+                    m_scene->DeregisterComponent(in_component);
                 }
                 
                 in_component->OnRemovedFromEntity();
@@ -275,6 +278,7 @@ namespace ChilliSource
                     component->OnSuspend();
                 }
                 component->OnRemovedFromScene();
+                m_scene->DeregisterComponent(component);
             }
             
             component->OnRemovedFromEntity();
@@ -450,6 +454,24 @@ namespace ChilliSource
     }
     //-------------------------------------------------------------
     //-------------------------------------------------------------
+    u32 Entity::OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator, bool threadSafeComponents) noexcept
+    {
+        u32 numSkipped = 0;
+        for(u32 i=0; i<m_components.size(); ++i)
+        {
+            if (m_components[i]->IsRenderSnapshotThreadSafe() == threadSafeComponents)
+            {
+                m_components[i]->OnRenderSnapshot(renderSnapshot, frameAllocator);
+            }
+            else
+            {
+                ++numSkipped;
+            }
+        }
+        return numSkipped;
+    }
+    //-------------------------------------------------------------
+    //-------------------------------------------------------------
     void Entity::OnBackground()
     {
         CS_ASSERT(m_appForegrounded == true, "Entity: Received background while already backgrounded.");
@@ -449,6 +449,23 @@ namespace ChilliSource
         //-------------------------------------------------------------
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept;
         //-------------------------------------------------------------
+        /// Sends the render snapshot event onto either the components
+        /// which can be snapshotted on a background thread, or those
+        /// which cannot.
+        ///
+        /// @author Ian Copland
+        ///
+        /// @param renderSnapshot - The render snapshot object which
+        /// contains all snapshotted data.
+        /// @param frameAllocator - Allocate any memory needed for rendering
+        /// a frame from here
+        /// @param threadSafeComponents - Whether to snapshot the components
+        /// which are render snapshot thread safe, or those which are not.
+        ///
+        /// @return The number of components which were skipped.
+        //-------------------------------------------------------------
+        u32 OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator, bool threadSafeComponents) noexcept;
+        //-------------------------------------------------------------
         /// Called when the application is backgrounded while the entity
         /// is in the scene. This will also be called when the entity is
         /// removed from the scene if the application is currently
@@ -28,6 +28,8 @@
 
 #include <ChilliSource/Core/Entity/Transform.h>
 
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+
 #include <algorithm>
 
 namespace ChilliSource
@@ -37,9 +39,18 @@ namespace ChilliSource
     ///
     /// Default
     //----------------------------------------------------------------
-    Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr)
+    Transform::Transform() : mbIsTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr)
     {
     
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    Transform::~Transform()
+    {
+        if (mpHierarchy != nullptr)
+        {
+            mpHierarchy->Remove(this);
+        }
     }
     //----------------------------------------------------------
     /// Set Look At
@@ -439,29 +450,20 @@ namespace ChilliSource
     //----------------------------------------------------------------
     const Matrix4& Transform::GetWorldTransform() const
     {
-        //If we have a parent transform we must apply it to
-        //our local transform to get the relative transformation
-        if(mpParentTransform)
+        //A clean world transform implies that all ancestors are also clean,
+        //so only dirty transforms need to look at their parent.
+        if(mbIsWorldTransformDirty)
         {
-            //Our parent has changed so we must re-calculate our transform
-            if(!mbIsParentTransformCacheValid)
+            if(mpParentTransform)
             {
-                mbIsParentTransformCacheValid = true;
-                
-                //Calculate the relative transform with our new parent transform
                 mmatWorldTransform = GetLocalTransform() * mpParentTransform->GetWorldTransform();
             }
-            //Our local transform has changed therefore we must update
-            else if(!mbIsTransformCacheValid)
+            else
             {
-                //Calculate the relative transformation from our cached parent
-                mmatWorldTransform = GetLocalTransform() * mpParentTransform->GetWorldTransform();
+                mmatWorldTransform = GetLocalTransform();
             }
-        }
-        //We do not have a parent so our relative transform is actually just our local one
-        else if(!mbIsTransformCacheValid)
-        {
-            mmatWorldTransform = GetLocalTransform();
+            
+            mbIsWorldTransformDirty = false;
         }
         
         return mmatWorldTransform;
@@ -490,7 +492,6 @@ namespace ChilliSource
         OnTransformChanged();
 
         mbIsTransformCacheValid = true;
-        mbIsParentTransformCacheValid = false;
     }
     //----------------------------------------------------------------
     /// Set Local Transform
@@ -516,7 +517,7 @@ namespace ChilliSource
     //----------------------------------------------------------------
     bool Transform::IsTransformValid() const
     {
-        return mbIsTransformCacheValid && mbIsParentTransformCacheValid;
+        return mbIsTransformCacheValid && !mbIsWorldTransformDirty;
     }
     //----------------------------------------------------------------
     /// Set Parent Transform
@@ -530,7 +531,8 @@ namespace ChilliSource
     {
         mpParentTransform = inpTransform;
         
-        OnParentTransformChanged();
+        OnHierarchyChanged();
+        OnTransformChanged();
     }
     //----------------------------------------------------------------
     /// Get Parent Transform
@@ -603,6 +605,12 @@ namespace ChilliSource
         return mTransformChangedEvent;
     }
     //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    IConnectableEvent<Transform::TransformChangedDelegate>& Transform::GetTransformInvalidatedEvent()
+    {
+        return mTransformInvalidatedEvent;
+    }
+    //----------------------------------------------------------------
     /// On Transform Changed 
     ///
     /// Triggered when our transform changes so we can 
@@ -611,37 +619,88 @@ namespace ChilliSource
     void Transform::OnTransformChanged()
     {
         mbIsTransformCacheValid = false;
+
+        if(mbIsWorldTransformDirty)
+        {
+            //The world getters of a transform without a parent don't clean
+            //the world transform, so caches may have been rebuilt while it
+            //was dirty. Descendants are always cleaned when read, so only
+            //this transform needs to be invalidated again.
+            mTransformInvalidatedEvent.NotifyConnections();
+        }
+        else
+        {
+            MarkWorldTransformDirty();
+        }
+
+        //Transforms in a hierarchy have their events, and those of their
+        //descendants, coalesced and sent during the hierarchy update.
+        if(mpHierarchy != nullptr)
+        {
+            mbHasPendingChangeEvent = true;
+        }
+        else
+        {
+            NotifyTransformChanged();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void Transform::MarkWorldTransformDirty()
+    {
+        if(mbIsWorldTransformDirty)
+        {
+            return;
+        }
         
-        for(std::vector<Transform*>::iterator it = mChildTransforms.begin(); it != mChildTransforms.end(); ++it)
+        mbIsWorldTransformDirty = true;
+        
+        //Caches derived from the world transform are invalidated immediately,
+        //even when the changed event is deferred to the hierarchy update.
+        mTransformInvalidatedEvent.NotifyConnections();
+        
+        for(auto childTransform : mChildTransforms)
         {
-            (*it)->OnParentTransformChanged();
+            childTransform->MarkWorldTransformDirty();
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void Transform::NotifyTransformChanged()
+    {
+        for(auto childTransform : mChildTransforms)
+        {
+            if(childTransform->mpHierarchy == nullptr)
+            {
+                childTransform->NotifyTransformChanged();
+            }
         }
         
         mTransformChangedEvent.NotifyConnections();
     }
     //----------------------------------------------------------------
-    /// On Parent Transform Changed 
-    ///
-    /// Triggered when our parent transform changes so we can 
-    /// recalculate our transform
     //----------------------------------------------------------------
-    void Transform::OnParentTransformChanged()
+    void Transform::OnHierarchyChanged()
     {
-        mbIsParentTransformCacheValid = false;
-        
-        OnTransformChanged();
+        if(mpHierarchy != nullptr)
+        {
+            mpHierarchy->OnHierarchyChanged();
+        }
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void Transform::Reset()
     {
         mbIsTransformCacheValid = false;
-        mbIsParentTransformCacheValid = false;
+        mbIsWorldTransformDirty = true;
+        mbHasPendingChangeEvent = false;
         mvPosition = Vector3::k_zero;
         mvScale = Vector3::k_one;
         mqWorldOrientation = Quaternion::k_identity;
         mpParentTransform = nullptr;
         mChildTransforms.clear();
+        OnHierarchyChanged();
         mTransformChangedEvent.CloseAllConnections();
+        mTransformInvalidatedEvent.CloseAllConnections();
     }
 }
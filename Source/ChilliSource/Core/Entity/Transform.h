@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_TRANSFORM_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/ForwardDeclarations.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Vector3.h>
@@ -45,6 +46,11 @@ namespace ChilliSource
         typedef std::function<void()> TransformChangedDelegate;
         
         Transform();
+        //----------------------------------------------------------------
+        /// Destructor. Removes the transform from its hierarchy, if it
+        /// is in one.
+        //----------------------------------------------------------------
+        ~Transform();
         //----------------------------------------------------------
         /// Set Look At
         ///
@@ -293,11 +299,28 @@ namespace ChilliSource
         /// Get Tranform Changed Event
         ///
         /// Subscribe to this event for notifications of when this
-        /// transform is invalidated
+        /// transform is invalidated. For transforms in a scene this is
+        /// sent at most once per scene transform update, regardless of
+        /// how many times the transform or its ancestors changed. See
+        /// Scene::UpdateTransforms().
         ///
         /// @return TransformChangedDelegate event
         //----------------------------------------------------------------
         IConnectableEvent<TransformChangedDelegate>& GetTransformChangedEvent();
+        //----------------------------------------------------------------
+        /// Get Transform Invalidated Event
+        ///
+        /// Subscribe to this event to invalidate anything cached from the
+        /// world transform. Unlike the transform changed event this is
+        /// sent immediately, from the setter, whenever the world
+        /// transform of this transform becomes invalid because it or one
+        /// of its ancestors changed. It is sent at most once until the
+        /// world transform is next read, so listeners should only clear
+        /// cached state; they should not read or modify transforms.
+        ///
+        /// @return TransformChangedDelegate event
+        //----------------------------------------------------------------
+        IConnectableEvent<TransformChangedDelegate>& GetTransformInvalidatedEvent();
         
         //----------------------------------------------------------------
         /// Resets the transform back to identity and removes any
@@ -310,6 +333,7 @@ namespace ChilliSource
     private:
         
         friend class Entity;
+        friend class TransformHierarchy;
         
         //----------------------------------------------------------------
         /// Set Parent Transform
@@ -351,17 +375,31 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// On Transform Changed 
         ///
-        /// Triggered when our transform changes so we can 
-        /// notify any dependant transforms
+        /// Triggered when our transform changes. This marks the world
+        /// transform of this and all descendants as dirty. If the
+        /// transform is in a hierarchy the transform changed events
+        /// are sent during the next hierarchy update, otherwise they
+        /// are sent immediately.
         //----------------------------------------------------------------
         void OnTransformChanged();
         //----------------------------------------------------------------
-        /// On Parent Transform Changed 
-        ///
-        /// Triggered when our parent transform changes so we can 
-        /// recalculate our transform
+        /// Marks the world transform of this and all descendants as
+        /// dirty. As a world transform can only be recalculated after
+        /// its parent's, the descendants of a dirty transform are always
+        /// dirty, so this stops at any transform which is already dirty.
+        //----------------------------------------------------------------
+        void MarkWorldTransformDirty();
+        //----------------------------------------------------------------
+        /// Sends the transform changed event for this and all
+        /// descendants. This is used for transforms which aren't in a
+        /// hierarchy.
         //----------------------------------------------------------------
-        void OnParentTransformChanged();
+        void NotifyTransformChanged();
+        //----------------------------------------------------------------
+        /// Informs the hierarchy, if there is one, that the parent child
+        /// relationships of its transforms have changed.
+        //----------------------------------------------------------------
+        void OnHierarchyChanged();
         
     private:
         
@@ -377,13 +415,18 @@ namespace ChilliSource
         mutable Quaternion mqWorldOrientation;
         
         Event<TransformChangedDelegate> mTransformChangedEvent;
+        Event<TransformChangedDelegate> mTransformInvalidatedEvent;
         
         Transform* mpParentTransform;
         
         std::vector<Transform*> mChildTransforms;
         
+        TransformHierarchy* mpHierarchy = nullptr;
+        u32 mudwHierarchyIndex = 0;
+        
         mutable bool mbIsTransformCacheValid;
-        mutable bool mbIsParentTransformCacheValid;
+        mutable bool mbIsWorldTransformDirty = true;
+        bool mbHasPendingChangeEvent = false;
     };
 }
 
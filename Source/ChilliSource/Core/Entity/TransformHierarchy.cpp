@@ -0,0 +1,206 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_minTransformsForParallelUpdate = 1024;
+        constexpr u32 k_targetTransformsPerBatch = 256;
+        constexpr u32 k_noParent = std::numeric_limits<u32>::max();
+    }
+
+    //------------------------------------------------------------------------------
+    void TransformHierarchy::Add(Transform* transform) noexcept
+    {
+        CS_ASSERT(transform != nullptr, "Cannot add a null transform.");
+        CS_ASSERT(transform->mpHierarchy == nullptr, "Cannot add a transform which is already in a hierarchy.");
+
+        transform->mpHierarchy = this;
+        transform->mudwHierarchyIndex = u32(m_transforms.size());
+
+        m_transforms.push_back(transform);
+        m_parentIndices.push_back(k_noParent);
+        ++m_numTransforms;
+        m_isOrderValid = false;
+    }
+
+    //------------------------------------------------------------------------------
+    void TransformHierarchy::Remove(Transform* transform) noexcept
+    {
+        CS_ASSERT(transform != nullptr, "Cannot remove a null transform.");
+        CS_ASSERT(transform->mpHierarchy == this, "Cannot remove a transform which is not in this hierarchy.");
+        CS_ASSERT(m_transforms[transform->mudwHierarchyIndex] == transform, "Transform hierarchy index is invalid.");
+
+        //The slot is left empty so that indices remain valid if this is called during
+        //the update. Empty slots are removed when the order is next rebuilt.
+        m_transforms[transform->mudwHierarchyIndex] = nullptr;
+        transform->mpHierarchy = nullptr;
+        transform->mbHasPendingChangeEvent = false;
+        --m_numTransforms;
+        m_isOrderValid = false;
+    }
+
+    //------------------------------------------------------------------------------
+    void TransformHierarchy::Update() noexcept
+    {
+        if (m_isUpdating)
+        {
+            return;
+        }
+
+        m_isUpdating = true;
+
+        if (!m_isOrderValid)
+        {
+            RebuildOrder();
+        }
+
+        u32 numTransforms = u32(m_transforms.size());
+        m_changedFlags.assign(numTransforms, 0);
+
+        if (numTransforms < k_minTransformsForParallelUpdate || m_rootIndices.size() < 2)
+        {
+            UpdateWorldTransforms(0, numTransforms);
+        }
+        else
+        {
+            //Each batch contains whole root subtrees, so no transform in a batch depends
+            //on a transform in another batch.
+            std::vector<Task> tasks;
+            u32 batchStart = 0;
+            for (u32 i = 1; i <= u32(m_rootIndices.size()); ++i)
+            {
+                u32 subtreeEnd = (i < u32(m_rootIndices.size())) ? m_rootIndices[i] : numTransforms;
+                if (subtreeEnd - batchStart >= k_targetTransformsPerBatch || subtreeEnd == numTransforms)
+                {
+                    tasks.push_back([=](const TaskContext&)
+                    {
+                        UpdateWorldTransforms(batchStart, subtreeEnd);
+                    });
+                    batchStart = subtreeEnd;
+                }
+            }
+
+            Application::Get()->GetTaskScheduler()->ScheduleTasksAndYield(TaskType::k_small, tasks);
+        }
+
+        //Events are sent on the main thread, after all world transforms are up to date.
+        //Events can add or remove transforms, so the list size and slots are re-checked
+        //on every iteration.
+        for (u32 i = 0; i < u32(m_changedFlags.size()); ++i)
+        {
+            if (m_changedFlags[i] != 0 && m_transforms[i] != nullptr)
+            {
+                m_transforms[i]->mTransformChangedEvent.NotifyConnections();
+            }
+        }
+
+        m_isUpdating = false;
+    }
+
+    //------------------------------------------------------------------------------
+    void TransformHierarchy::RebuildOrder() noexcept
+    {
+        std::vector<Transform*> transforms;
+        transforms.reserve(m_numTransforms);
+        std::vector<u32> parentIndices;
+        parentIndices.reserve(m_numTransforms);
+
+        m_rootIndices.clear();
+
+        for (auto transform : m_transforms)
+        {
+            if (transform != nullptr && (transform->mpParentTransform == nullptr || transform->mpParentTransform->mpHierarchy != this))
+            {
+                m_rootIndices.push_back(u32(transforms.size()));
+                AppendSubtree(transform, k_noParent, transforms, parentIndices);
+            }
+        }
+
+        CS_ASSERT(transforms.size() == m_numTransforms, "Transform hierarchy contains transforms which are not reachable from a root.");
+
+        m_transforms.swap(transforms);
+        m_parentIndices.swap(parentIndices);
+        m_isOrderValid = true;
+    }
+
+    //------------------------------------------------------------------------------
+    void TransformHierarchy::AppendSubtree(Transform* transform, u32 parentIndex, std::vector<Transform*>& out_transforms, std::vector<u32>& out_parentIndices) noexcept
+    {
+        u32 index = u32(out_transforms.size());
+        transform->mudwHierarchyIndex = index;
+
+        out_transforms.push_back(transform);
+        out_parentIndices.push_back(parentIndex);
+
+        for (auto childTransform : transform->mChildTransforms)
+        {
+            if (childTransform->mpHierarchy == this)
+            {
+                AppendSubtree(childTransform, index, out_transforms, out_parentIndices);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void TransformHierarchy::UpdateWorldTransforms(u32 start, u32 end) noexcept
+    {
+        for (u32 i = start; i < end; ++i)
+        {
+            auto transform = m_transforms[i];
+            u32 parentIndex = m_parentIndices[i];
+
+            //A transform has changed if it was changed directly, or if its parent has
+            //changed. Parents always precede their children, so the parent's flag and
+            //world transform are already up to date.
+            bool changed = transform->mbHasPendingChangeEvent || (parentIndex != k_noParent && m_changedFlags[parentIndex] != 0);
+            m_changedFlags[i] = changed ? 1 : 0;
+            transform->mbHasPendingChangeEvent = false;
+
+            transform->GetWorldTransform();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    TransformHierarchy::~TransformHierarchy() noexcept
+    {
+        for (auto transform : m_transforms)
+        {
+            if (transform != nullptr)
+            {
+                transform->mpHierarchy = nullptr;
+                transform->mbHasPendingChangeEvent = false;
+            }
+        }
+    }
+}
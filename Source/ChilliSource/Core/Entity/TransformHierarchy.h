@@ -0,0 +1,130 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_ENTITY_TRANSFORMHIERARCHY_H_
+#define _CHILLISOURCE_CORE_ENTITY_TRANSFORMHIERARCHY_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// Holds the transforms of all entities in a scene in flat lists, ordered such that
+    /// parents always precede their children and the subtree of each root transform is
+    /// contiguous. This allows world transforms to be updated in a single batched pass,
+    /// with independent subtrees updated in parallel, rather than on demand. Transform
+    /// changed events are coalesced, so each transform sends its event at most once per
+    /// update, no matter how many times it, or its ancestors, changed.
+    ///
+    /// Transforms are added and removed by the owning scene. Changes to the parent child
+    /// relationships of the transforms are detected automatically, and the order is
+    /// rebuilt during the next update.
+    ///
+    /// This is not thread-safe and should only be used on the main thread.
+    ///
+    class TransformHierarchy final
+    {
+    public:
+        CS_DECLARE_NOCOPY(TransformHierarchy);
+
+        TransformHierarchy() = default;
+
+        /// Adds the given transform to the hierarchy. The transform must not already be in
+        /// a hierarchy.
+        ///
+        /// @param transform
+        ///     The transform to add.
+        ///
+        void Add(Transform* transform) noexcept;
+
+        /// Removes the given transform from the hierarchy. Any pending transform changed
+        /// event for the transform is discarded. This is safe to call during Update(), for
+        /// example from a transform changed event.
+        ///
+        /// @param transform
+        ///     The transform to remove.
+        ///
+        void Remove(Transform* transform) noexcept;
+
+        /// Recalculates the world transform of every transform which has changed since the
+        /// last update, then sends the transform changed event of each, in parent before
+        /// child order. Any changes made during the events are sent in the next update.
+        /// Calls made while an update is already in progress are ignored.
+        ///
+        void Update() noexcept;
+
+        /// @return The number of transforms in the hierarchy.
+        ///
+        u32 GetNumTransforms() const noexcept { return m_numTransforms; }
+
+        ~TransformHierarchy() noexcept;
+
+    private:
+        friend class Transform;
+
+        /// Called by transforms in the hierarchy when their parent changes.
+        ///
+        void OnHierarchyChanged() noexcept { m_isOrderValid = false; }
+
+        /// Rebuilds the ordered lists from the current parent child relationships, removing
+        /// any gaps left by removed transforms.
+        ///
+        void RebuildOrder() noexcept;
+
+        /// Appends the given transform, and all of its descendants which are in this
+        /// hierarchy, to the given ordered lists.
+        ///
+        /// @param transform
+        ///     The transform.
+        /// @param parentIndex
+        ///     The index of the transform's parent, if it has one in the hierarchy.
+        /// @param out_transforms
+        ///     (Out) The ordered transform list.
+        /// @param out_parentIndices
+        ///     (Out) The ordered parent index list.
+        ///
+        void AppendSubtree(Transform* transform, u32 parentIndex, std::vector<Transform*>& out_transforms, std::vector<u32>& out_parentIndices) noexcept;
+
+        /// Recalculates the world transforms and works out which transforms have changed, for
+        /// the given range of the ordered lists. The range must only contain whole subtrees.
+        ///
+        /// @param start
+        ///     The first index in the range.
+        /// @param end
+        ///     The index after the last in the range.
+        ///
+        void UpdateWorldTransforms(u32 start, u32 end) noexcept;
+
+        std::vector<Transform*> m_transforms;
+        std::vector<u32> m_parentIndices;
+        std::vector<u8> m_changedFlags;
+        std::vector<u32> m_rootIndices;
+        u32 m_numTransforms = 0;
+        bool m_isOrderValid = true;
+        bool m_isUpdating = false;
+    };
+}
+
+#endif
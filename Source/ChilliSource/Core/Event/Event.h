@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
+#include <initializer_list>
 #include <vector>
 
 namespace ChilliSource
@@ -45,6 +46,10 @@ namespace ChilliSource
     /// Objects should though expose the IConnectableEvent interface
     /// to prevent other objects invoking the event.
     ///
+    /// Connections are stored in a slot list, and each connection
+    /// knows the index of its slot, so opening and closing a
+    /// connection are O(1). Closed slots are compacted lazily.
+    ///
     /// @author S Downie
     //-----------------------------------------------------------------
     template <typename TDelegateType> class Event final : public IConnectableEvent<TDelegateType>, public IDisconnectableEvent
@@ -84,14 +89,7 @@ namespace ChilliSource
         //-------------------------------------------------------------
         Event(Event&& in_moveFrom)
         {
-            CloseAllConnections();
-
-            m_isNotifying = in_moveFrom.m_isNotifying;
-            m_connections = std::move(in_moveFrom.m_connections);
-            for (auto& connectionContainer : m_connections)
-            {
-                connectionContainer.m_connection->SetOwningEvent(this);
-            }
+            MoveFrom(in_moveFrom);
         }
         //-------------------------------------------------------------
         /// Although we don't want events to be copyable, we do want
@@ -107,41 +105,16 @@ namespace ChilliSource
         Event& operator= (Event&& in_moveFrom)
         {
             CloseAllConnections();
-
-            m_isNotifying = in_moveFrom.m_isNotifying;
-            m_connections = std::move(in_moveFrom.m_connections);
-            for (auto& connectionContainer : m_connections)
-            {
-                connectionContainer.m_connection->SetOwningEvent(this);
-            }
+            MoveFrom(in_moveFrom);
 
             return *this;
         }
         //-------------------------------------------------------------
-        /// Opens a new connection to the event. While this connection
-        /// remains in scope the delegate will be notified of events
-        ///
-        /// @author S Downie
-        ///
-        /// @param Delegate to notify
-        ///
-        /// @return Scoped connection
-        //-------------------------------------------------------------
-        EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate) override
-        {
-            EventConnectionUPtr connection(new EventConnection());
-            connection->SetOwningEvent(this);
-        
-            ConnectionDesc desc;
-            desc.m_delegate = in_delegate;
-            desc.m_connection = connection.get();
-            m_connections.push_back(desc);
-        
-            return connection;
-        }
-        //-------------------------------------------------------------
         /// Close connection to the event. The connection will
-        /// no longer be notified of the event
+        /// no longer be notified of the event. This is O(1); the slot
+        /// used by the connection is reclaimed later, either after
+        /// the current notification or once enough slots have been
+        /// closed.
         ///
         /// @author S Downie
         ///
@@ -149,21 +122,23 @@ namespace ChilliSource
         //-------------------------------------------------------------
         void CloseConnection(EventConnection* in_connection) override
         {
-            for(u32 i=0; i<m_connections.size(); ++i)
+            u32 slotIndex = in_connection->GetSlotIndex();
+            ConnectionSlot& slot = (slotIndex < m_slots.size()) ? m_slots[slotIndex] : m_pendingSlots[slotIndex - m_slots.size()];
+            CS_ASSERT(slot.m_connection == in_connection, "Connection is not owned by this event.");
+
+            slot.m_connection = nullptr;
+            ++m_numClosedSlots;
+
+            if (m_notifyDepth == 0)
             {
-                ConnectionDesc& desc = m_connections[i];
-                if(desc.m_connection == in_connection)
+                //The delegate is moved out so that it is destroyed after the
+                //event is back in a consistent state, as destroying it may
+                //close further connections.
+                SmallDelegateType closedDelegate(std::move(slot.m_delegate));
+
+                if (m_numClosedSlots >= k_minClosedSlotsForCompaction && m_numClosedSlots * 2 >= m_slots.size())
                 {
-                    if(m_isNotifying == false)
-                    {
-                        m_connections.erase(m_connections.begin() + i);
-                    }
-                    else
-                    {
-                        desc.m_connection = nullptr;
-                    }
-                    
-                    return;
+                    RemoveClosedConnections();
                 }
             }
         }
@@ -176,22 +151,31 @@ namespace ChilliSource
         //-------------------------------------------------------------
         template <typename... TArgTypes> void NotifyConnections(TArgTypes&&... in_args)
         {
-            m_isNotifying = true;
+            ++m_notifyDepth;
             
-            //Take a snapshot of the number of delegates so any new ones added
-            //during the notify loop aren't notified themseleves.
-            auto numConnections = m_connections.size();
-            for (typename ConnectionList::size_type i = 0; i < numConnections; ++i)
+            //Connections opened during the notify loop are added to the pending
+            //list, so they aren't notified themselves and the slot list is never
+            //resized while a delegate is running.
+            auto numSlots = m_slots.size();
+            for (typename SlotList::size_type i = 0; i < numSlots; ++i)
             {
-                if(m_connections[i].m_connection != nullptr)
+                if(m_slots[i].m_connection != nullptr)
                 {
-                    m_connections[i].m_delegate(std::forward<TArgTypes>(in_args)...);
+                    m_slots[i].m_delegate(std::forward<TArgTypes>(in_args)...);
                 }
             }
             
-            m_isNotifying = false;
+            --m_notifyDepth;
             
-            RemoveClosedConnections();
+            if (m_notifyDepth == 0)
+            {
+                AddPendingConnections();
+                
+                if (m_numClosedSlots > 0)
+                {
+                    RemoveClosedConnections();
+                }
+            }
         }
         //-------------------------------------------------------------
         /// Closes all the currently open connections
@@ -200,51 +184,161 @@ namespace ChilliSource
         //-------------------------------------------------------------
         void CloseAllConnections()
         {
-            for(u32 i=0; i<m_connections.size(); ++i)
+            for (auto* slots : { &m_slots, &m_pendingSlots })
             {
-                if(m_connections[i].m_connection != nullptr)
+                for (auto& slot : *slots)
                 {
-                    m_connections[i].m_connection->SetOwningEvent(nullptr);
+                    if (slot.m_connection != nullptr)
+                    {
+                        slot.m_connection->SetOwningEvent(nullptr);
+                        slot.m_connection = nullptr;
+                        ++m_numClosedSlots;
+                    }
                 }
             }
             
-            m_connections.clear();
+            //If notifying, the closed slots are removed once the notify loop
+            //has finished, as one of the delegates is currently running.
+            if (m_notifyDepth == 0)
+            {
+                RemoveClosedConnections();
+            }
         }
 
     private:
-
+        
+        using SmallDelegateType = typename IConnectableEvent<TDelegateType>::SmallDelegateType;
+        
+        //-------------------------------------------------------------
+        /// Opens a new connection to the event with the given delegate.
+        /// The connection is appended to the list of connections,
+        /// preserving the order in which connections are notified.
+        ///
+        /// @param Delegate to notify
+        ///
+        /// @return Scoped connection
+        //-------------------------------------------------------------
+        EventConnectionUPtr OpenDelegateConnection(SmallDelegateType&& in_delegate) override
+        {
+            EventConnectionUPtr connection(new EventConnection());
+            connection->SetOwningEvent(this);
+            connection->SetSlotIndex(u32(m_slots.size() + m_pendingSlots.size()));
+            
+            ConnectionSlot slot;
+            slot.m_delegate = std::move(in_delegate);
+            slot.m_connection = connection.get();
+            
+            if (m_notifyDepth == 0)
+            {
+                m_slots.push_back(std::move(slot));
+            }
+            else
+            {
+                m_pendingSlots.push_back(std::move(slot));
+            }
+        
+            return connection;
+        }
+        //-------------------------------------------------------------
+        /// Moves the connections from the given event into this, which
+        /// must not have any connections.
+        ///
+        /// @param The event to move from.
+        //-------------------------------------------------------------
+        void MoveFrom(Event& in_moveFrom)
+        {
+            m_slots = std::move(in_moveFrom.m_slots);
+            m_pendingSlots = std::move(in_moveFrom.m_pendingSlots);
+            m_numClosedSlots = in_moveFrom.m_numClosedSlots;
+            m_notifyDepth = in_moveFrom.m_notifyDepth;
+            
+            in_moveFrom.m_slots.clear();
+            in_moveFrom.m_pendingSlots.clear();
+            in_moveFrom.m_numClosedSlots = 0;
+            
+            for (auto* slots : { &m_slots, &m_pendingSlots })
+            {
+                for (auto& slot : *slots)
+                {
+                    if (slot.m_connection != nullptr)
+                    {
+                        slot.m_connection->SetOwningEvent(this);
+                    }
+                }
+            }
+        }
+        //-------------------------------------------------------------
+        /// Appends any connections which were opened during
+        /// notification to the main list of connections. The slot
+        /// indices assigned on opening remain valid.
+        //-------------------------------------------------------------
+        void AddPendingConnections()
+        {
+            if (m_pendingSlots.empty())
+            {
+                return;
+            }
+            
+            m_slots.reserve(m_slots.size() + m_pendingSlots.size());
+            for (auto& slot : m_pendingSlots)
+            {
+                m_slots.push_back(std::move(slot));
+            }
+            m_pendingSlots.clear();
+        }
         //-------------------------------------------------------------------------
-        /// Remove from the list any connections that have been flagged as closed
+        /// Remove from the list any connections that have been flagged as closed.
+        /// The order of the remaining connections is preserved and their slot
+        /// indices are updated. This must not be called during notification.
         ///
         /// @author S Downie
         //-------------------------------------------------------------------------
         void RemoveClosedConnections()
         {
-            for(typename ConnectionList::iterator it = m_connections.begin(); it != m_connections.end(); )
+            CS_ASSERT(m_notifyDepth == 0 && m_pendingSlots.empty(), "Cannot remove closed connections during notification.");
+            
+            //Closed delegates are destroyed after the list has been compacted, as
+            //destroying them may close further connections.
+            SlotList closedSlots;
+            
+            u32 numOpenSlots = 0;
+            for (u32 i = 0; i < m_slots.size(); ++i)
             {
-                if(it->m_connection == nullptr)
+                if (m_slots[i].m_connection != nullptr)
                 {
-                    it = m_connections.erase(it);
+                    if (numOpenSlots != i)
+                    {
+                        m_slots[numOpenSlots] = std::move(m_slots[i]);
+                        m_slots[numOpenSlots].m_connection->SetSlotIndex(numOpenSlots);
+                    }
+                    ++numOpenSlots;
                 }
-                else
+                else if (m_slots[i].m_delegate)
                 {
-                    ++it;
+                    closedSlots.push_back(std::move(m_slots[i]));
                 }
             }
+            
+            m_slots.erase(m_slots.begin() + numOpenSlots, m_slots.end());
+            m_numClosedSlots = 0;
         }
 
     private:
+        
+        static constexpr u32 k_minClosedSlotsForCompaction = 8;
                                 
-        struct ConnectionDesc
+        struct ConnectionSlot
         {
-            TDelegateType m_delegate;
+            SmallDelegateType m_delegate;
             EventConnection* m_connection = nullptr;
         };
 
-        typedef std::vector<ConnectionDesc> ConnectionList;
-        ConnectionList m_connections;
+        typedef std::vector<ConnectionSlot> SlotList;
+        SlotList m_slots;
+        SlotList m_pendingSlots;
     
-        bool m_isNotifying = false;
+        u32 m_numClosedSlots = 0;
+        u32 m_notifyDepth = 0;
     };
 }
 
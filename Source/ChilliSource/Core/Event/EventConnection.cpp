@@ -40,6 +40,18 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
+    void EventConnection::SetSlotIndex(u32 in_slotIndex)
+    {
+        m_slotIndex = in_slotIndex;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    u32 EventConnection::GetSlotIndex() const
+    {
+        return m_slotIndex;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
     void EventConnection::Close()
     {
         if(m_owningEvent != nullptr)
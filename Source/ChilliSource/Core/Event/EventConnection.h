@@ -61,6 +61,19 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void SetOwningEvent(IDisconnectableEvent* in_owningEvent);
         //----------------------------------------------------------------
+        /// Sets the index of the connection within the owning event's
+        /// list of connections. This should only be called by Event
+        /// itself, don't call manually.
+        ///
+        /// @param The slot index.
+        //----------------------------------------------------------------
+        void SetSlotIndex(u32 in_slotIndex);
+        //----------------------------------------------------------------
+        /// @return The index of the connection within the owning event's
+        /// list of connections.
+        //----------------------------------------------------------------
+        u32 GetSlotIndex() const;
+        //----------------------------------------------------------------
         /// Manually close the connection so that it no longer receieves
         /// any events
         ///
@@ -71,6 +84,7 @@ namespace ChilliSource
     private:
         
         IDisconnectableEvent* m_owningEvent = nullptr;
+        u32 m_slotIndex = 0;
     };
 }
 
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/ForwardDeclarations.h>
+#include <ChilliSource/Core/Delegate/SmallDelegate.h>
 
 namespace ChilliSource
 {
@@ -72,13 +73,58 @@ namespace ChilliSource
         ///
         /// @return Scoped connection
         //-------------------------------------------------------------
-        virtual EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate) = 0;
+        EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate)
+        {
+            return OpenDelegateConnection(SmallDelegateType(in_delegate));
+        }
+        //-------------------------------------------------------------
+        /// Opens a new connection to the event, taking ownership of
+        /// the given delegate rather than copying it.
+        ///
+        /// @param Delegate to notify
+        ///
+        /// @return Scoped connection
+        //-------------------------------------------------------------
+        EventConnectionUPtr OpenConnection(TDelegateType&& in_delegate)
+        {
+            return OpenDelegateConnection(SmallDelegateType(std::move(in_delegate)));
+        }
+        //-------------------------------------------------------------
+        /// Opens a new connection to the event which calls the given
+        /// member function on the given instance. This should be
+        /// preferred over passing the result of MakeDelegate() as the
+        /// binding is stored without any heap allocation.
+        ///
+        /// @param Instance whose function to call
+        /// @param Member function ptr
+        ///
+        /// @return Scoped connection
+        //-------------------------------------------------------------
+        template <typename TSender, typename TMemberFunction> EventConnectionUPtr OpenConnection(TSender* in_sender, TMemberFunction in_memberFunction)
+        {
+            return OpenDelegateConnection(SmallDelegateType(MemberFunctionBinding<TSender, TMemberFunction>(in_sender, in_memberFunction)));
+        }
         //-------------------------------------------------------------
         /// Virtual destructor
         ///
         /// @author Ian Copland
         //-------------------------------------------------------------
         virtual ~IConnectableEvent() {};
+        
+    protected:
+        
+        using SmallDelegateType = typename SmallDelegateFromFunction<TDelegateType>::Type;
+        
+        //-------------------------------------------------------------
+        /// Opens a new connection to the event with the given delegate.
+        /// All of the OpenConnection() overloads are implemented in
+        /// terms of this.
+        ///
+        /// @param Delegate to notify
+        ///
+        /// @return Scoped connection
+        //-------------------------------------------------------------
+        virtual EventConnectionUPtr OpenDelegateConnection(SmallDelegateType&& in_delegate) = 0;
     };
 }
 
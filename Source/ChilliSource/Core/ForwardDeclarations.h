@@ -84,6 +84,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(Entity);
     CS_FORWARDDECLARE_CLASS(PrimitiveEntityFactory);
     CS_FORWARDDECLARE_CLASS(Transform);
+    CS_FORWARDDECLARE_CLASS(TransformHierarchy);
     //---------------------------------------------------------
     /// Event
     //---------------------------------------------------------
@@ -163,8 +164,12 @@ namespace ChilliSource
     //---------------------------------------------------------
     /// Memory
     //---------------------------------------------------------
+    CS_FORWARDDECLARE_STRUCT(AllocatorStats);
+    CS_FORWARDDECLARE_TEMPLATECLASS(ConcurrentObjectPoolAllocator, T);
+    CS_FORWARDDECLARE_CLASS(ConcurrentPagedLinearAllocator);
     CS_FORWARDDECLARE_CLASS(IAllocator);
     CS_FORWARDDECLARE_CLASS(LinearAllocator);
+    CS_FORWARDDECLARE_CLASS(MemoryTracker);
     CS_FORWARDDECLARE_CLASS(PagedLinearAllocator);
     CS_FORWARDDECLARE_TEMPLATECLASS(ObjectPoolAllocator, T);
     //---------------------------------------------------------
@@ -196,6 +201,7 @@ namespace ChilliSource
     //---------------------------------------------------------
     /// Scene
     //---------------------------------------------------------
+    CS_FORWARDDECLARE_CLASS(ComponentRegistry);
     CS_FORWARDDECLARE_CLASS(Scene);
     //---------------------------------------------------------
     /// State
@@ -215,12 +221,17 @@ namespace ChilliSource
     //---------------------------------------------------------
     /// Threading
     //---------------------------------------------------------
+    CS_FORWARDDECLARE_CLASS(FileTaskQueue);
     CS_FORWARDDECLARE_CLASS(SingleThreadTaskPool);
     CS_FORWARDDECLARE_CLASS(TaskContext);
+    CS_FORWARDDECLARE_CLASS(TaskGraph);
+    CS_FORWARDDECLARE_CLASS(TaskGroup);
     CS_FORWARDDECLARE_CLASS(TaskPool);
+    CS_FORWARDDECLARE_CLASS(TaskProfiler);
     CS_FORWARDDECLARE_CLASS(TaskScheduler);
     CS_FORWARDDECLARE_CLASS(TaskScheduler);
     CS_FORWARDDECLARE_CLASS(ThreadPool);
+    enum class FileTaskPriority;
     enum class TaskType;
     //---------------------------------------------------------
     /// Time
@@ -235,6 +246,7 @@ namespace ChilliSource
     //---------------------------------------------------------
     /// Volume
     //---------------------------------------------------------
+    CS_FORWARDDECLARE_CLASS(BoundingVolumeHierarchy);
     CS_FORWARDDECLARE_CLASS(VolumeComponent);
     //---------------------------------------------------------
     /// XML
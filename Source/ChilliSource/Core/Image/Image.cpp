@@ -96,4 +96,10 @@ namespace ChilliSource
     {
         return m_dataDesc.m_dataSize;
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    std::size_t Image::GetEstimatedMemoryUsage() const
+    {
+        return m_imageData ? std::size_t(m_dataDesc.m_dataSize) : 0;
+    }
 }
@@ -118,6 +118,11 @@ namespace ChilliSource
         /// @return Image data.
         //----------------------------------------------------------------
         const u8* GetData() const;
+        //----------------------------------------------------------------
+        /// @return The size of the image data held in memory, or
+        /// zero if the data has been moved out of the image.
+        //----------------------------------------------------------------
+        std::size_t GetEstimatedMemoryUsage() const override;
         
     private:
         friend class ResourcePool;
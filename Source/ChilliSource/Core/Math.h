@@ -30,12 +30,14 @@
 #define _CHILLISOURCE_CORE_MATH_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/BatchMath.h>
 #include <ChilliSource/Core/Math/Interpolate.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Core/Math/Matrix3.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Math/UnifiedCoordinates.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
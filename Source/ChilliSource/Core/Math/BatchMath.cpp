@@ -0,0 +1,268 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Math/BatchMath.h>
+
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/SIMD.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ChilliSource
+{
+    namespace BatchMath
+    {
+        namespace
+        {
+            /// @param in_matrix
+            ///     The matrix to check.
+            ///
+            /// @return Whether or not the final column of the matrix is (0, 0, 0, 1), in which case
+            ///     transforming a point will always give a w of 1.
+            ///
+            bool IsAffine(const Matrix4& in_matrix) noexcept
+            {
+                return (in_matrix.m[3] == 0.0f && in_matrix.m[7] == 0.0f && in_matrix.m[11] == 0.0f && in_matrix.m[15] == 1.0f);
+            }
+            
+#ifdef CS_SIMD
+            /// The rows of a matrix, loaded once so that they can be applied to many elements.
+            ///
+            struct MatrixRows final
+            {
+                explicit MatrixRows(const Matrix4& in_matrix) noexcept
+                    : m_row0(SIMD::Load(in_matrix.m)), m_row1(SIMD::Load(in_matrix.m + 4)), m_row2(SIMD::Load(in_matrix.m + 8)), m_row3(SIMD::Load(in_matrix.m + 12))
+                {
+                }
+                
+                SIMD::Float4 m_row0;
+                SIMD::Float4 m_row1;
+                SIMD::Float4 m_row2;
+                SIMD::Float4 m_row3;
+            };
+            
+            /// Transforms a point by the given matrix rows, in the same order as Vector3 * Matrix4.
+            ///
+            /// @param in_point
+            ///     The point to transform.
+            /// @param in_rows
+            ///     The rows of the matrix.
+            ///
+            /// @return The transformed point, with w in the fourth lane.
+            ///
+            SIMD::Float4 TransformPoint(const Vector3& in_point, const MatrixRows& in_rows) noexcept
+            {
+                SIMD::Float4 c = SIMD::Mul(SIMD::Splat(in_point.x), in_rows.m_row0);
+                c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_point.y), in_rows.m_row1));
+                c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_point.z), in_rows.m_row2));
+                return SIMD::Add(c, in_rows.m_row3);
+            }
+            
+            /// Multiplies the given matrix by the given matrix rows, in the same order as
+            /// Matrix4 * Matrix4. All rows are calculated before any are stored, so the output may
+            /// be the same as the input.
+            ///
+            /// @param in_a
+            ///     The left hand side of the multiplication.
+            /// @param in_rows
+            ///     The rows of the right hand side of the multiplication.
+            /// @param out_matrix
+            ///     (Out) The result.
+            ///
+            void MultiplyMatrix(const Matrix4& in_a, const MatrixRows& in_rows, Matrix4& out_matrix) noexcept
+            {
+                const f32* a = in_a.m;
+                SIMD::Float4 rows[4];
+                for (u32 i = 0; i < 4; ++i, a += 4)
+                {
+                    rows[i] = SIMD::Mul(SIMD::Splat(a[0]), in_rows.m_row0);
+                    rows[i] = SIMD::Add(rows[i], SIMD::Mul(SIMD::Splat(a[1]), in_rows.m_row1));
+                    rows[i] = SIMD::Add(rows[i], SIMD::Mul(SIMD::Splat(a[2]), in_rows.m_row2));
+                    rows[i] = SIMD::Add(rows[i], SIMD::Mul(SIMD::Splat(a[3]), in_rows.m_row3));
+                }
+                
+                SIMD::Store(out_matrix.m, rows[0]);
+                SIMD::Store(out_matrix.m + 4, rows[1]);
+                SIMD::Store(out_matrix.m + 8, rows[2]);
+                SIMD::Store(out_matrix.m + 12, rows[3]);
+            }
+            
+            /// Vector3 is only 12 bytes, so the result of a transform is written out through a
+            /// temporary rather than storing all four lanes directly.
+            ///
+            /// @param in_values
+            ///     The vector to store. The fourth lane is discarded.
+            ///
+            /// @return The first three lanes as a Vector3.
+            ///
+            Vector3 ToVector3(SIMD::Float4 in_values) noexcept
+            {
+                f32 values[4];
+                SIMD::Store(values, in_values);
+                return Vector3(values[0], values[1], values[2]);
+            }
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        void TransformPoints(const Vector3* in_points, u32 in_numPoints, const Matrix4& in_matrix, Vector3* out_points) noexcept
+        {
+#ifdef CS_SIMD
+            MatrixRows rows(in_matrix);
+            if (IsAffine(in_matrix))
+            {
+                for (u32 i = 0; i < in_numPoints; ++i)
+                {
+                    out_points[i] = ToVector3(TransformPoint(in_points[i], rows));
+                }
+            }
+            else
+            {
+                for (u32 i = 0; i < in_numPoints; ++i)
+                {
+                    SIMD::Float4 c = TransformPoint(in_points[i], rows);
+                    out_points[i] = ToVector3(SIMD::Mul(c, SIMD::Splat(1.0f / SIMD::GetW(c))));
+                }
+            }
+#else
+            if (IsAffine(in_matrix))
+            {
+                for (u32 i = 0; i < in_numPoints; ++i)
+                {
+                    const auto& point = in_points[i];
+                    out_points[i] = Vector3(point.x * in_matrix.m[0] + point.y * in_matrix.m[4] + point.z * in_matrix.m[8] + in_matrix.m[12],
+                                            point.x * in_matrix.m[1] + point.y * in_matrix.m[5] + point.z * in_matrix.m[9] + in_matrix.m[13],
+                                            point.x * in_matrix.m[2] + point.y * in_matrix.m[6] + point.z * in_matrix.m[10] + in_matrix.m[14]);
+                }
+            }
+            else
+            {
+                for (u32 i = 0; i < in_numPoints; ++i)
+                {
+                    out_points[i] = in_points[i] * in_matrix;
+                }
+            }
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        void MultiplyMatrices(const Matrix4* in_matrices, u32 in_numMatrices, const Matrix4& in_matrix, Matrix4* out_matrices) noexcept
+        {
+#ifdef CS_SIMD
+            MatrixRows rows(in_matrix);
+            for (u32 i = 0; i < in_numMatrices; ++i)
+            {
+                MultiplyMatrix(in_matrices[i], rows, out_matrices[i]);
+            }
+#else
+            // in_matrix is copied in case it is one of the output matrices.
+            Matrix4 matrix = in_matrix;
+            for (u32 i = 0; i < in_numMatrices; ++i)
+            {
+                out_matrices[i] = in_matrices[i] * matrix;
+            }
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        void MultiplyMatrices(const Matrix4* in_matricesA, const Matrix4* in_matricesB, u32 in_numMatrices, Matrix4* out_matrices) noexcept
+        {
+#ifdef CS_SIMD
+            for (u32 i = 0; i < in_numMatrices; ++i)
+            {
+                MultiplyMatrix(in_matricesA[i], MatrixRows(in_matricesB[i]), out_matrices[i]);
+            }
+#else
+            for (u32 i = 0; i < in_numMatrices; ++i)
+            {
+                out_matrices[i] = in_matricesA[i] * in_matricesB[i];
+            }
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        AABB CalculateAABB(const Vector3* in_points, u32 in_numPoints) noexcept
+        {
+            CS_ASSERT(in_numPoints > 0, "Cannot calculate the AABB of zero points.");
+            
+#ifdef CS_SIMD
+            SIMD::Float4 min = SIMD::Set(in_points[0].x, in_points[0].y, in_points[0].z, 0.0f);
+            SIMD::Float4 max = min;
+            for (u32 i = 1; i < in_numPoints; ++i)
+            {
+                SIMD::Float4 point = SIMD::Set(in_points[i].x, in_points[i].y, in_points[i].z, 0.0f);
+                min = SIMD::Min(min, point);
+                max = SIMD::Max(max, point);
+            }
+            
+            Vector3 minPoint = ToVector3(min);
+            Vector3 maxPoint = ToVector3(max);
+#else
+            Vector3 minPoint = in_points[0];
+            Vector3 maxPoint = in_points[0];
+            for (u32 i = 1; i < in_numPoints; ++i)
+            {
+                minPoint = Vector3::Min(minPoint, in_points[i]);
+                maxPoint = Vector3::Max(maxPoint, in_points[i]);
+            }
+#endif
+            
+            Vector3 size = maxPoint - minPoint;
+            return AABB(minPoint + 0.5f * size, size);
+        }
+        
+        //------------------------------------------------------------------------------
+        void TransformSpheres(const Sphere* in_spheres, u32 in_numSpheres, const Matrix4& in_matrix, Sphere* out_spheres) noexcept
+        {
+            f32 rightLengthSquared = in_matrix.m[0] * in_matrix.m[0] + in_matrix.m[1] * in_matrix.m[1] + in_matrix.m[2] * in_matrix.m[2];
+            f32 upLengthSquared = in_matrix.m[4] * in_matrix.m[4] + in_matrix.m[5] * in_matrix.m[5] + in_matrix.m[6] * in_matrix.m[6];
+            f32 forwardLengthSquared = in_matrix.m[8] * in_matrix.m[8] + in_matrix.m[9] * in_matrix.m[9] + in_matrix.m[10] * in_matrix.m[10];
+            f32 radiusScale = std::sqrt(std::max(std::max(rightLengthSquared, upLengthSquared), forwardLengthSquared));
+            
+#ifdef CS_SIMD
+            MatrixRows rows(in_matrix);
+            bool isAffine = IsAffine(in_matrix);
+            for (u32 i = 0; i < in_numSpheres; ++i)
+            {
+                SIMD::Float4 centre = TransformPoint(in_spheres[i].vOrigin, rows);
+                if (isAffine == false)
+                {
+                    centre = SIMD::Mul(centre, SIMD::Splat(1.0f / SIMD::GetW(centre)));
+                }
+                
+                out_spheres[i] = Sphere(ToVector3(centre), in_spheres[i].fRadius * radiusScale);
+            }
+#else
+            for (u32 i = 0; i < in_numSpheres; ++i)
+            {
+                out_spheres[i] = Sphere(in_spheres[i].vOrigin * in_matrix, in_spheres[i].fRadius * radiusScale);
+            }
+#endif
+        }
+    }
+}
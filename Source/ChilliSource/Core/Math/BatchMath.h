@@ -0,0 +1,115 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_BATCHMATH_H_
+#define _CHILLISOURCE_CORE_MATH_BATCHMATH_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    /// A collection of functions which apply the same operation to an array of math types in
+    /// a single call. The matrix is only read once per call, and where SIMD is available (see
+    /// SIMD.h) each element is processed using the vector registers. The results are identical
+    /// to applying the equivalent scalar operation to each element in turn.
+    ///
+    /// In all functions the output array may be the same as an input array, but otherwise the
+    /// arrays must not overlap.
+    ///
+    namespace BatchMath
+    {
+        /// Transforms each of the given points by the given matrix. This is equivalent to
+        /// out_points[i] = in_points[i] * in_matrix, including the division by w. The division
+        /// is skipped for affine matrices, where w is always 1.
+        ///
+        /// @param in_points
+        ///     The points to transform.
+        /// @param in_numPoints
+        ///     The number of points.
+        /// @param in_matrix
+        ///     The matrix to transform the points by.
+        /// @param out_points
+        ///     (Out) The transformed points. Must contain at least in_numPoints elements.
+        ///
+        void TransformPoints(const Vector3* in_points, u32 in_numPoints, const Matrix4& in_matrix, Vector3* out_points) noexcept;
+        
+        /// Multiplies each of the given matrices by the given matrix. This is equivalent to
+        /// out_matrices[i] = in_matrices[i] * in_matrix.
+        ///
+        /// @param in_matrices
+        ///     The matrices to multiply.
+        /// @param in_numMatrices
+        ///     The number of matrices.
+        /// @param in_matrix
+        ///     The matrix to multiply each matrix by.
+        /// @param out_matrices
+        ///     (Out) The resulting matrices. Must contain at least in_numMatrices elements.
+        ///
+        void MultiplyMatrices(const Matrix4* in_matrices, u32 in_numMatrices, const Matrix4& in_matrix, Matrix4* out_matrices) noexcept;
+        
+        /// Multiplies each of the given pairs of matrices. This is equivalent to
+        /// out_matrices[i] = in_matricesA[i] * in_matricesB[i].
+        ///
+        /// @param in_matricesA
+        ///     The left hand side of each multiplication.
+        /// @param in_matricesB
+        ///     The right hand side of each multiplication.
+        /// @param in_numMatrices
+        ///     The number of matrices in each array.
+        /// @param out_matrices
+        ///     (Out) The resulting matrices. Must contain at least in_numMatrices elements.
+        ///
+        void MultiplyMatrices(const Matrix4* in_matricesA, const Matrix4* in_matricesB, u32 in_numMatrices, Matrix4* out_matrices) noexcept;
+        
+        /// Calculates the axis aligned bounding box which encloses all of the given points.
+        ///
+        /// @param in_points
+        ///     The points. There must be at least one.
+        /// @param in_numPoints
+        ///     The number of points.
+        ///
+        /// @return The smallest AABB which contains all of the points.
+        ///
+        AABB CalculateAABB(const Vector3* in_points, u32 in_numPoints) noexcept;
+        
+        /// Transforms each of the given spheres by the given matrix. The centre of each sphere
+        /// is transformed as a point, and the radius is scaled by the largest scale factor of
+        /// the matrix, so the result encloses the transformed sphere even when the matrix has
+        /// a non-uniform scale.
+        ///
+        /// @param in_spheres
+        ///     The spheres to transform.
+        /// @param in_numSpheres
+        ///     The number of spheres.
+        /// @param in_matrix
+        ///     The matrix to transform the spheres by.
+        /// @param out_spheres
+        ///     (Out) The transformed spheres. Must contain at least in_numSpheres elements.
+        ///
+        void TransformSpheres(const Sphere* in_spheres, u32 in_numSpheres, const Matrix4& in_matrix, Sphere* out_spheres) noexcept;
+    }
+}
+
+#endif
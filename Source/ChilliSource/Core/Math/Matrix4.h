@@ -656,6 +656,7 @@ namespace ChilliSource
 // which is enough for the classes included to use it.
 //----------------------------------------------------
 #include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Vector4.h>
 
@@ -1221,28 +1222,9 @@ namespace ChilliSource
     //------------------------------------------------------
     template <typename TType> GenericMatrix4<TType>& GenericMatrix4<TType>::operator*=(const GenericMatrix4<TType>& in_b)
     {
-        GenericMatrix4<TType> c = *this;
-
-        m[0] = c.m[0] * in_b.m[0] + c.m[1] * in_b.m[4] + c.m[2] * in_b.m[8] + c.m[3] * in_b.m[12];
-        m[1] = c.m[0] * in_b.m[1] + c.m[1] * in_b.m[5] + c.m[2] * in_b.m[9] + c.m[3] * in_b.m[13];
-        m[2] = c.m[0] * in_b.m[2] + c.m[1] * in_b.m[6] + c.m[2] * in_b.m[10] + c.m[3] * in_b.m[14];
-        m[3] = c.m[0] * in_b.m[3] + c.m[1] * in_b.m[7] + c.m[2] * in_b.m[11] + c.m[3] * in_b.m[15];
-
-        m[4] = c.m[4] * in_b.m[0] + c.m[5] * in_b.m[4] + c.m[6] * in_b.m[8] + c.m[7] * in_b.m[12];
-        m[5] = c.m[4] * in_b.m[1] + c.m[5] * in_b.m[5] + c.m[6] * in_b.m[9] + c.m[7] * in_b.m[13];
-        m[6] = c.m[4] * in_b.m[2] + c.m[5] * in_b.m[6] + c.m[6] * in_b.m[10] + c.m[7] * in_b.m[14];
-        m[7] = c.m[4] * in_b.m[3] + c.m[5] * in_b.m[7] + c.m[6] * in_b.m[11] + c.m[7] * in_b.m[15];
-
-        m[8] = c.m[8] * in_b.m[0] + c.m[9] * in_b.m[4] + c.m[10] * in_b.m[8] + c.m[11] * in_b.m[12];
-        m[9] = c.m[8] * in_b.m[1] + c.m[9] * in_b.m[5] + c.m[10] * in_b.m[9] + c.m[11] * in_b.m[13];
-        m[10] = c.m[8] * in_b.m[2] + c.m[9] * in_b.m[6] + c.m[10] * in_b.m[10] + c.m[11] * in_b.m[14];
-        m[11] = c.m[8] * in_b.m[3] + c.m[9] * in_b.m[7] + c.m[10] * in_b.m[11] + c.m[11] * in_b.m[15];
-
-        m[12] = c.m[12] * in_b.m[0] + c.m[13] * in_b.m[4] + c.m[14] * in_b.m[8] + c.m[15] * in_b.m[12];
-        m[13] = c.m[12] * in_b.m[1] + c.m[13] * in_b.m[5] + c.m[14] * in_b.m[9] + c.m[15] * in_b.m[13];
-        m[14] = c.m[12] * in_b.m[2] + c.m[13] * in_b.m[6] + c.m[14] * in_b.m[10] + c.m[15] * in_b.m[14];
-        m[15] = c.m[12] * in_b.m[3] + c.m[13] * in_b.m[7] + c.m[14] * in_b.m[11] + c.m[15] * in_b.m[15];
-
+        // This is implemented in terms of the binary operator so that it remains correct
+        // when in_b is this matrix.
+        *this = *this * in_b;
         return *this;
     }
     //------------------------------------------------------
@@ -1340,6 +1322,114 @@ namespace ChilliSource
     {
         return !(in_a == in_b);
     }
+#ifdef CS_SIMD
+    //------------------------------------------------------
+    /// SIMD specialisation of the matrix product. Each row
+    /// of the result is the sum of the rows of b weighted by
+    /// the elements of the equivalent row of a. The sum is
+    /// evaluated in the same order as the generic version so
+    /// the result is identical.
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> operator*(const GenericMatrix4<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        SIMD::Float4 b0 = SIMD::Load(in_b.m);
+        SIMD::Float4 b1 = SIMD::Load(in_b.m + 4);
+        SIMD::Float4 b2 = SIMD::Load(in_b.m + 8);
+        SIMD::Float4 b3 = SIMD::Load(in_b.m + 12);
+
+        // All rows are calculated before any are stored so that the compiler can discard
+        // the identity written by the default constructor.
+        const f32* a = in_a.m;
+        SIMD::Float4 r0 = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(a[0]), b0), SIMD::Mul(SIMD::Splat(a[1]), b1)), SIMD::Mul(SIMD::Splat(a[2]), b2)), SIMD::Mul(SIMD::Splat(a[3]), b3));
+        SIMD::Float4 r1 = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(a[4]), b0), SIMD::Mul(SIMD::Splat(a[5]), b1)), SIMD::Mul(SIMD::Splat(a[6]), b2)), SIMD::Mul(SIMD::Splat(a[7]), b3));
+        SIMD::Float4 r2 = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(a[8]), b0), SIMD::Mul(SIMD::Splat(a[9]), b1)), SIMD::Mul(SIMD::Splat(a[10]), b2)), SIMD::Mul(SIMD::Splat(a[11]), b3));
+        SIMD::Float4 r3 = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(a[12]), b0), SIMD::Mul(SIMD::Splat(a[13]), b1)), SIMD::Mul(SIMD::Splat(a[14]), b2)), SIMD::Mul(SIMD::Splat(a[15]), b3));
+
+        GenericMatrix4<f32> c;
+        SIMD::Store(c.m, r0);
+        SIMD::Store(c.m + 4, r1);
+        SIMD::Store(c.m + 8, r2);
+        SIMD::Store(c.m + 12, r3);
+        return c;
+    }
+    //------------------------------------------------------
+    /// SIMD specialisation of the creation of a transform.
+    /// The rows of the rotation matrix are scaled four lanes
+    /// at a time, which gives the same result as the generic
+    /// version.
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> GenericMatrix4<f32>::CreateTransform(const GenericVector3<f32>& in_translation, const GenericVector3<f32>& in_scale, const GenericQuaternion<f32>& in_rotation)
+    {
+        GenericMatrix4<f32> rotation = CreateRotation(in_rotation);
+
+        GenericMatrix4<f32> c;
+        SIMD::Store(c.m, SIMD::Mul(SIMD::Splat(in_scale.x), SIMD::Load(rotation.m)));
+        SIMD::Store(c.m + 4, SIMD::Mul(SIMD::Splat(in_scale.y), SIMD::Load(rotation.m + 4)));
+        SIMD::Store(c.m + 8, SIMD::Mul(SIMD::Splat(in_scale.z), SIMD::Load(rotation.m + 8)));
+        SIMD::Store(c.m + 12, SIMD::Set(in_translation.x, in_translation.y, in_translation.z, 1.0f));
+
+        // A negative scale would otherwise leave -0 in the final column.
+        c.m[3] = 0.0f;
+        c.m[7] = 0.0f;
+        c.m[11] = 0.0f;
+        return c;
+    }
+    //------------------------------------------------------
+    /// SIMD specialisation of the inverse. This uses the
+    /// 2x2 sub-determinants of the upper and lower halves of
+    /// the matrix to calculate the adjugate a row at a time,
+    /// so while the result is equivalent to the generic
+    /// version it may differ in the last bits of precision.
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> GenericMatrix4<f32>::Inverse(const GenericMatrix4<f32>& in_a)
+    {
+        const f32* a = in_a.m;
+
+        f32 s0 = a[0] * a[5] - a[4] * a[1];
+        f32 s1 = a[0] * a[6] - a[4] * a[2];
+        f32 s2 = a[0] * a[7] - a[4] * a[3];
+        f32 s3 = a[1] * a[6] - a[5] * a[2];
+        f32 s4 = a[1] * a[7] - a[5] * a[3];
+        f32 s5 = a[2] * a[7] - a[6] * a[3];
+
+        f32 c0 = a[8] * a[13] - a[12] * a[9];
+        f32 c1 = a[8] * a[14] - a[12] * a[10];
+        f32 c2 = a[8] * a[15] - a[12] * a[11];
+        f32 c3 = a[9] * a[14] - a[13] * a[10];
+        f32 c4 = a[9] * a[15] - a[13] * a[11];
+        f32 c5 = a[10] * a[15] - a[14] * a[11];
+
+        f32 det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (det == 0.0f)
+        {
+            return in_a;
+        }
+
+        // The columns of the matrix with each pair of rows swapped, and the pairs of
+        // sub-determinants needed by each half of a row of the adjugate.
+        SIMD::Float4 col0 = SIMD::Set(a[4], a[0], a[12], a[8]);
+        SIMD::Float4 col1 = SIMD::Set(a[5], a[1], a[13], a[9]);
+        SIMD::Float4 col2 = SIMD::Set(a[6], a[2], a[14], a[10]);
+        SIMD::Float4 col3 = SIMD::Set(a[7], a[3], a[15], a[11]);
+        SIMD::Float4 d0 = SIMD::Set(c0, c0, s0, s0);
+        SIMD::Float4 d1 = SIMD::Set(c1, c1, s1, s1);
+        SIMD::Float4 d2 = SIMD::Set(c2, c2, s2, s2);
+        SIMD::Float4 d3 = SIMD::Set(c3, c3, s3, s3);
+        SIMD::Float4 d4 = SIMD::Set(c4, c4, s4, s4);
+        SIMD::Float4 d5 = SIMD::Set(c5, c5, s5, s5);
+
+        f32 invDet = 1.0f / det;
+        SIMD::Float4 evenScale = SIMD::Set(invDet, -invDet, invDet, -invDet);
+        SIMD::Float4 oddScale = SIMD::Set(-invDet, invDet, -invDet, invDet);
+
+        GenericMatrix4<f32> b;
+        SIMD::Store(b.m, SIMD::Mul(SIMD::Add(SIMD::Sub(SIMD::Mul(col1, d5), SIMD::Mul(col2, d4)), SIMD::Mul(col3, d3)), evenScale));
+        SIMD::Store(b.m + 4, SIMD::Mul(SIMD::Add(SIMD::Sub(SIMD::Mul(col0, d5), SIMD::Mul(col2, d2)), SIMD::Mul(col3, d1)), oddScale));
+        SIMD::Store(b.m + 8, SIMD::Mul(SIMD::Add(SIMD::Sub(SIMD::Mul(col0, d4), SIMD::Mul(col1, d2)), SIMD::Mul(col3, d0)), evenScale));
+        SIMD::Store(b.m + 12, SIMD::Mul(SIMD::Add(SIMD::Sub(SIMD::Mul(col0, d3), SIMD::Mul(col1, d1)), SIMD::Mul(col2, d0)), oddScale));
+        return b;
+    }
+#endif
 }
 
 #endif
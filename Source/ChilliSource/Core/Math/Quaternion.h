@@ -378,6 +378,7 @@ namespace ChilliSource
 // which is enough for the classes included to use it.
 //----------------------------------------------------
 #include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 
 #include <cmath>
@@ -691,11 +692,13 @@ namespace ChilliSource
     //-----------------------------------------------
     template <typename TType> GenericQuaternion<TType>& GenericQuaternion<TType>::operator *= (const GenericQuaternion<TType>& in_b)
     {
+        // in_b is also copied so that this remains correct when in_b is this quaternion.
         GenericQuaternion<TType> copy = *this;
-        w = in_b.w * copy.w - in_b.x *copy.x - in_b.y * copy.y - in_b.z * copy.z;
-        x = in_b.w * copy.x + in_b.x *copy.w + in_b.y * copy.z - in_b.z * copy.y;
-        y = in_b.w * copy.y - in_b.x *copy.z + in_b.y * copy.w + in_b.z * copy.x;
-        z = in_b.w * copy.z + in_b.x *copy.y - in_b.y * copy.x + in_b.z * copy.w;
+        GenericQuaternion<TType> b = in_b;
+        w = b.w * copy.w - b.x * copy.x - b.y * copy.y - b.z * copy.z;
+        x = b.w * copy.x + b.x * copy.w + b.y * copy.z - b.z * copy.y;
+        y = b.w * copy.y - b.x * copy.z + b.y * copy.w + b.z * copy.x;
+        z = b.w * copy.z + b.x * copy.y - b.y * copy.x + b.z * copy.w;
         return *this;
     }
     //-----------------------------------------------
@@ -766,6 +769,85 @@ namespace ChilliSource
     {
         return !(in_a == in_b);
     }
+#ifdef CS_SIMD
+    //-----------------------------------------------
+    /// SIMD specialisation of the quaternion product.
+    /// Each term of the generic version is calculated
+    /// for all four components at once by permuting
+    /// the copy of this quaternion; the signs are
+    /// applied by multiplying by +/-1, which is exact,
+    /// so the result is identical.
+    //-----------------------------------------------
+    template <> inline GenericQuaternion<f32>& GenericQuaternion<f32>::operator*=(const GenericQuaternion<f32>& in_b)
+    {
+        SIMD::Float4 copy = SIMD::Set(x, y, z, w);
+
+        SIMD::Float4 c = SIMD::Mul(SIMD::Splat(in_b.w), copy);
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Mul(SIMD::Splat(in_b.x), SIMD::Reverse(copy)), SIMD::Set(1.0f, -1.0f, 1.0f, -1.0f)));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Mul(SIMD::Splat(in_b.y), SIMD::SwapHalves(copy)), SIMD::Set(1.0f, 1.0f, -1.0f, -1.0f)));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Mul(SIMD::Splat(in_b.z), SIMD::SwapPairs(copy)), SIMD::Set(-1.0f, 1.0f, 1.0f, -1.0f)));
+
+        f32 values[4];
+        SIMD::Store(values, c);
+        x = values[0];
+        y = values[1];
+        z = values[2];
+        w = values[3];
+        return *this;
+    }
+    //--------------------------------------------
+    /// SIMD specialisation of Slerp. The weights are
+    /// calculated as in the generic version and the
+    /// two quaternions are then blended four lanes
+    /// at a time, so the result is identical.
+    //--------------------------------------------
+    template <> inline void GenericQuaternion<f32>::Slerp(const GenericQuaternion<f32>& in_b, f32 in_t)
+    {
+        const f32 k_epsilon = 0.0001f;
+        
+        if (in_t <= 0)
+        {
+            return;
+        }
+        if (in_t >= 1)
+        {
+            *this = in_b;
+        }
+        
+        SIMD::Float4 a = SIMD::Set(x, y, z, w);
+        SIMD::Float4 b = SIMD::Set(in_b.x, in_b.y, in_b.z, in_b.w);
+        f32 aDotB = Dot(*this, in_b);
+        if (aDotB < 0)
+        {
+            b = SIMD::Mul(b, SIMD::Splat(-1.0f));
+            aDotB = -aDotB;
+        }
+        
+        SIMD::Float4 c;
+        if (aDotB > 1 - k_epsilon)
+        {
+            c = SIMD::Add(a, SIMD::Mul(SIMD::Splat(in_t), SIMD::Sub(b, a)));
+        }
+        else
+        {
+            f32 acosADotB = std::acos(aDotB);
+            c = SIMD::Add(SIMD::Mul(SIMD::Splat(std::sin((1 - in_t) * acosADotB)), a), SIMD::Mul(SIMD::Splat(std::sin(in_t * acosADotB)), b));
+            c = SIMD::Div(c, SIMD::Splat(std::sin(acosADotB)));
+        }
+        
+        f32 values[4];
+        SIMD::Store(values, c);
+        x = values[0];
+        y = values[1];
+        z = values[2];
+        w = values[3];
+        
+        if (aDotB > 1 - k_epsilon)
+        {
+            Normalise();
+        }
+    }
+#endif
 }
 
 #endif
@@ -0,0 +1,256 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_MATH_SIMD_H_
+#define _CHILLISOURCE_CORE_MATH_SIMD_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+/// Selects the SIMD instruction set used to accelerate the f32 math types. SSE2 is used on
+/// x86 and x64, and NEON is used on ARM. Defining CS_DISABLE_SIMD will force the scalar
+/// implementations to be used on all platforms. CS_SIMD is defined if either instruction
+/// set is available.
+///
+#ifndef CS_DISABLE_SIMD
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define CS_SIMD_SSE2
+#       define CS_SIMD
+#       include <emmintrin.h>
+#   elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#       define CS_SIMD_NEON
+#       define CS_SIMD
+#       include <arm_neon.h>
+#   endif
+#endif
+
+#ifdef CS_SIMD
+
+namespace ChilliSource
+{
+    /// A thin, platform independent wrapper over the subset of SSE2 and NEON that is needed
+    /// by the math library. Every operation is performed independently on each of the four
+    /// lanes and uses IEEE single precision arithmetic, so the results are identical to the
+    /// equivalent scalar code evaluated in the same order.
+    ///
+    /// Loads and stores are unaligned, as the math types are used directly within vertex
+    /// formats and other packed structures which cannot guarantee 16 byte alignment.
+    ///
+    namespace SIMD
+    {
+#if defined(CS_SIMD_SSE2)
+        using Float4 = __m128;
+#else
+        using Float4 = float32x4_t;
+#endif
+        
+        /// @param values
+        ///     The four values to load. This does not need to be aligned.
+        ///
+        /// @return A vector containing the given values.
+        ///
+        inline Float4 Load(const f32* values) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_loadu_ps(values);
+#else
+            return vld1q_f32(values);
+#endif
+        }
+        
+        /// @param out_values
+        ///     (Out) The memory the four lanes of the vector should be written to. This does
+        ///     not need to be aligned.
+        /// @param a
+        ///     The vector to store.
+        ///
+        inline void Store(f32* out_values, Float4 a) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            _mm_storeu_ps(out_values, a);
+#else
+            vst1q_f32(out_values, a);
+#endif
+        }
+        
+        /// @return A vector containing the given values, in lane order.
+        ///
+        inline Float4 Set(f32 x, f32 y, f32 z, f32 w) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_setr_ps(x, y, z, w);
+#else
+            const f32 values[4] = { x, y, z, w };
+            return vld1q_f32(values);
+#endif
+        }
+        
+        /// @return A vector with the given value in all four lanes.
+        ///
+        inline Float4 Splat(f32 value) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_set1_ps(value);
+#else
+            return vdupq_n_f32(value);
+#endif
+        }
+        
+        /// @return The first lane of the vector.
+        ///
+        inline f32 GetX(Float4 a) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_cvtss_f32(a);
+#else
+            return vgetq_lane_f32(a, 0);
+#endif
+        }
+        
+        /// @return The fourth lane of the vector.
+        ///
+        inline f32 GetW(Float4 a) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_cvtss_f32(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)));
+#else
+            return vgetq_lane_f32(a, 3);
+#endif
+        }
+        
+        /// @return The lane-wise sum of the two vectors.
+        ///
+        inline Float4 Add(Float4 a, Float4 b) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_add_ps(a, b);
+#else
+            return vaddq_f32(a, b);
+#endif
+        }
+        
+        /// @return The lane-wise difference of the two vectors.
+        ///
+        inline Float4 Sub(Float4 a, Float4 b) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_sub_ps(a, b);
+#else
+            return vsubq_f32(a, b);
+#endif
+        }
+        
+        /// @return The lane-wise product of the two vectors.
+        ///
+        inline Float4 Mul(Float4 a, Float4 b) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_mul_ps(a, b);
+#else
+            return vmulq_f32(a, b);
+#endif
+        }
+        
+        /// @return The lane-wise quotient of the two vectors.
+        ///
+        inline Float4 Div(Float4 a, Float4 b) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_div_ps(a, b);
+#elif defined(__aarch64__)
+            return vdivq_f32(a, b);
+#else
+            // ARMv7 NEON only has a reciprocal estimate, which would not match the scalar
+            // result, so the division is performed per lane.
+            f32 aValues[4];
+            f32 bValues[4];
+            vst1q_f32(aValues, a);
+            vst1q_f32(bValues, b);
+            for (u32 i = 0; i < 4; ++i)
+            {
+                aValues[i] /= bValues[i];
+            }
+            return vld1q_f32(aValues);
+#endif
+        }
+        
+        /// @return The lane-wise minimum of the two vectors.
+        ///
+        inline Float4 Min(Float4 a, Float4 b) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_min_ps(a, b);
+#else
+            return vminq_f32(a, b);
+#endif
+        }
+        
+        /// @return The lane-wise maximum of the two vectors.
+        ///
+        inline Float4 Max(Float4 a, Float4 b) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_max_ps(a, b);
+#else
+            return vmaxq_f32(a, b);
+#endif
+        }
+        
+        /// @return The vector with the lanes of each pair swapped: (y, x, w, z).
+        ///
+        inline Float4 SwapPairs(Float4 a) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+#else
+            return vrev64q_f32(a);
+#endif
+        }
+        
+        /// @return The vector with its two halves swapped: (z, w, x, y).
+        ///
+        inline Float4 SwapHalves(Float4 a) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2));
+#else
+            return vextq_f32(a, a, 2);
+#endif
+        }
+        
+        /// @return The vector with its lanes in reverse order: (w, z, y, x).
+        ///
+        inline Float4 Reverse(Float4 a) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+#else
+            return SwapHalves(SwapPairs(a));
+#endif
+        }
+    }
+}
+
+#endif
+
+#endif
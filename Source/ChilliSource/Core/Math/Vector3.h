@@ -526,6 +526,7 @@ namespace ChilliSource
 #include <ChilliSource/Core/Math/Matrix3.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 
 #include <algorithm>
@@ -953,6 +954,26 @@ namespace ChilliSource
         in_a.z = -in_a.z;
         return in_a;
     }
+#ifdef CS_SIMD
+    //------------------------------------------------------
+    /// SIMD specialisation of the transformation of a point
+    /// by a matrix. All four components, including w, are
+    /// calculated at once, in the same order as the generic
+    /// version.
+    //------------------------------------------------------
+    template <> inline GenericVector3<f32> operator*(const GenericVector3<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        SIMD::Float4 c = SIMD::Mul(SIMD::Splat(in_a.x), SIMD::Load(in_b.m));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_a.y), SIMD::Load(in_b.m + 4)));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_a.z), SIMD::Load(in_b.m + 8)));
+        c = SIMD::Add(c, SIMD::Load(in_b.m + 12));
+        c = SIMD::Mul(c, SIMD::Splat(1.0f / SIMD::GetW(c)));
+
+        f32 values[4];
+        SIMD::Store(values, c);
+        return GenericVector3<f32>(values[0], values[1], values[2]);
+    }
+#endif
 }
 
 #endif
@@ -455,6 +455,7 @@ namespace ChilliSource
 // which is enough for the classes included to use it.
 //----------------------------------------------------
 #include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 
@@ -827,6 +828,25 @@ namespace ChilliSource
         in_a.w = -in_a.w;
         return in_a;
     }
+#ifdef CS_SIMD
+    //------------------------------------------------------
+    /// SIMD specialisation of the vector-matrix product. The
+    /// result is the sum of the rows of the matrix weighted
+    /// by the components of the vector, evaluated in the same
+    /// order as the generic version.
+    //------------------------------------------------------
+    template <> inline GenericVector4<f32> operator*(const GenericVector4<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        SIMD::Float4 c = SIMD::Mul(SIMD::Splat(in_a.x), SIMD::Load(in_b.m));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_a.y), SIMD::Load(in_b.m + 4)));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_a.z), SIMD::Load(in_b.m + 8)));
+        c = SIMD::Add(c, SIMD::Mul(SIMD::Splat(in_a.w), SIMD::Load(in_b.m + 12)));
+
+        f32 values[4];
+        SIMD::Store(values, c);
+        return GenericVector4<f32>(values[0], values[1], values[2], values[3]);
+    }
+#endif
 }
 
 #endif
@@ -26,8 +26,11 @@
 #define _CHILLISOURCE_CORE_MEMORY_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Memory/ConcurrentObjectPoolAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentPagedLinearAllocator.h>
 #include <ChilliSource/Core/Memory/IAllocator.h>
 #include <ChilliSource/Core/Memory/LinearAllocator.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Core/Memory/MemoryUtils.h>
 #include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
 #include <ChilliSource/Core/Memory/PagedLinearAllocator.h>
@@ -0,0 +1,564 @@
+//
+// The MIT License(MIT)
+// 
+// Copyright(c) 2017 Tag Games Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_MEMORY_CONCURRENTOBJECTPOOLALLOCATOR_H_
+#define _CHILLISOURCE_CORE_MEMORY_CONCURRENTOBJECTPOOLALLOCATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Memory/IAllocator.h>
+#include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace ChilliSource
+{
+    /// An object pool allocator which is optimised for concurrent use. This provides the
+    /// same interface and limit policies as ObjectPoolAllocator, but rather than taking a
+    /// lock on every allocation, each thread which uses the pool keeps a small cache of
+    /// free objects. Cache misses fall back on a lock-free global free list, and the only
+    /// lock is taken when an expanding pool adds a new page.
+    ///
+    /// Objects are allocated in pages of the initial pool size:
+    /// * FIXED: The pool has a single page, and will assert if out of memory. Up to
+    ///   k_threadCacheSize free objects can be held in each thread's cache, so fixed pools
+    ///   which are used on several threads should allow for this.
+    /// * EXPAND: Once all pages are in use a new page is added.
+    ///
+    /// Unlike ObjectPoolAllocator, only single objects can be allocated.
+    ///
+    /// This is thread-safe.
+    ///
+    template <typename T> class ConcurrentObjectPoolAllocator final : public IAllocator
+    {
+    public:
+        CS_DECLARE_NOCOPY(ConcurrentObjectPoolAllocator);
+
+        static constexpr u32 k_maxPages = 1024;
+        static constexpr u32 k_maxThreadCaches = 32;
+        static constexpr u32 k_threadCacheSize = 32;
+
+        /// Initialises the pool with a single page of the given number of objects. The
+        /// page will be allocated from the free store.
+        ///
+        /// @param numObjectsPerPage
+        ///     The number of objects in each page of the pool.
+        /// @param limitPolicy
+        ///     How to handle the case where pool limit is reached
+        ///
+        ConcurrentObjectPoolAllocator(std::size_t numObjectsPerPage, ObjectPoolAllocatorLimitPolicy limitPolicy = ObjectPoolAllocatorLimitPolicy::k_fixed) noexcept;
+
+        /// @return the maximum allocation size allowed by the allocator. This is always the
+        ///     size of a single object.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return sizeof(T); };
+
+        /// @return The number of objects the pool can currently hold without expanding.
+        ///
+        std::size_t GetCapacity() const noexcept { return std::size_t(m_numPages.load(std::memory_order_acquire)) * m_numObjectsPerPage; }
+
+        /// The allocation counts are kept per thread to avoid contention, so the peak usage
+        /// is only updated when this is called, and the result may be slightly out of date
+        /// if other threads are using the pool.
+        ///
+        /// @return The current memory usage of the pool.
+        ///
+        AllocatorStats GetStats() const noexcept override;
+
+        /// Allocates the memory for a single object. This will assert if the given size
+        /// is not sizeof(T).
+        ///
+        /// If the limit is reached will obey the limit policy
+        ///
+        /// NOTE: Used via STL container allocation interface and is NOT constructed using placement new
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation, which must be sizeof(T).
+        ///
+        /// @return The allocated memory (not yet constructed).
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new object from the pool (if the limit is reached will obey the limit policy)
+        ///
+        /// NOTE: Use this if you are using the pool directly and not via STL containers
+        ///
+        /// @return The allocated object (equivalent to calling new T()).
+        ///
+        T* Allocate() noexcept;
+
+        /// Returns the memory held by the object to the pool. It must have been allocated from
+        /// this pool or will assert
+        ///
+        /// NOTE: Used via STL container allocation interface and is not destructed
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        /// @param allocationSize
+        ///     Initial allocation size, which must be sizeof(T).
+        ///
+        void Deallocate(void* pointer, std::size_t allocationSize) noexcept override;
+
+        /// Returns the memory held by the object to the pool. It must have been allocated from
+        /// this pool or will assert.
+        ///
+        /// NOTE: Use this if you are using the pool directly and not via STL containers
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate and destruct
+        ///
+        void Deallocate(T* pointer) noexcept;
+
+        /// All allocations must have been deallocated prior to the pool being destroyed.
+        ///
+        ~ConcurrentObjectPoolAllocator() noexcept;
+
+    private:
+        static constexpr u32 k_nullIndex = std::numeric_limits<u32>::max();
+
+        /// A cache of free objects which is only accessed by a single thread.
+        ///
+        struct ThreadCache final
+        {
+            std::atomic<std::thread::id> m_threadId;
+            u32 m_numObjects;
+            std::array<u32, k_threadCacheSize> m_objectIndices;
+            std::atomic<u64> m_numAllocations;
+            std::atomic<u64> m_numDeallocations;
+        };
+
+        /// A page of objects, along with the index of the next object in the global
+        /// free list for each object in the page.
+        ///
+        struct Page final
+        {
+            T* m_objects;
+            std::atomic<u32>* m_nextFreeIndices;
+#ifdef CS_ENABLE_DEBUG
+            std::atomic<bool>* m_isAllocated;
+#endif
+        };
+
+        /// Packs an object index and a tag, which is incremented every time the head of the
+        /// free list changes, into the value stored for the head of the free list. The tag
+        /// prevents the ABA problem.
+        ///
+        /// @param objectIndex
+        ///     The index of the object at the head of the list.
+        /// @param tag
+        ///     The tag.
+        ///
+        /// @return The packed head.
+        ///
+        static u64 PackHead(u32 objectIndex, u32 tag) noexcept { return (u64(tag) << 32) | u64(objectIndex); }
+
+        /// Increments a counter which is only ever written by a single thread. This avoids
+        /// the cost of an atomic increment, while still allowing other threads to read it.
+        ///
+        /// @param counter
+        ///     The counter to increment.
+        ///
+        static void IncrementOwnedCounter(std::atomic<u64>& counter) noexcept { counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+        /// @param objectIndex
+        ///     The index of the object.
+        ///
+        /// @return The page containing the object with the given index.
+        ///
+        const Page& GetPage(u32 objectIndex) const noexcept;
+
+        /// @param objectIndex
+        ///     The index of the object.
+        ///
+        /// @return The object with the given index.
+        ///
+        T* GetObject(u32 objectIndex) const noexcept;
+
+        /// @param pointer
+        ///     The pointer to an object.
+        ///
+        /// @return The index of the given object, or k_nullIndex if it is not owned by the
+        ///     pool.
+        ///
+        u32 GetObjectIndex(const T* pointer) const noexcept;
+
+        /// @return The cache for the calling thread, or null if all caches are in use by
+        ///     other threads.
+        ///
+        ThreadCache* GetCurrentThreadCache() noexcept;
+
+        /// Pushes a chain of objects, which are already linked together, onto the global
+        /// free list.
+        ///
+        /// @param firstIndex
+        ///     The index of the first object in the chain.
+        /// @param lastIndex
+        ///     The index of the last object in the chain.
+        ///
+        void PushGlobal(u32 firstIndex, u32 lastIndex) noexcept;
+
+        /// Pops an object from the global free list.
+        ///
+        /// @return The index of the object, or k_nullIndex if the list is empty.
+        ///
+        u32 PopGlobal() noexcept;
+
+        /// Adds a new page to the pool and pushes its objects onto the global free list, if
+        /// the global list is still empty.
+        ///
+        void Expand() noexcept;
+
+        const ObjectPoolAllocatorLimitPolicy m_limitPolicy;
+        const u32 m_numObjectsPerPage;
+
+        std::array<Page, k_maxPages> m_pages;
+        std::atomic<u32> m_numPages;
+        std::mutex m_expandMutex;
+
+        std::atomic<u64> m_globalHead;
+
+        std::array<ThreadCache, k_maxThreadCaches> m_threadCaches;
+        std::atomic<u32> m_numThreadCaches;
+
+        // Allocations by threads which have no cache are counted here.
+        std::atomic<u64> m_numUncachedAllocations;
+        std::atomic<u64> m_numUncachedDeallocations;
+        mutable std::atomic<std::size_t> m_peakAllocatedBytes;
+
+#ifdef CS_ENABLE_DEBUG
+        std::atomic<s64> m_activeAllocationCount;
+#endif
+    };
+
+    template <typename T> constexpr u32 ConcurrentObjectPoolAllocator<T>::k_maxPages;
+    template <typename T> constexpr u32 ConcurrentObjectPoolAllocator<T>::k_maxThreadCaches;
+    template <typename T> constexpr u32 ConcurrentObjectPoolAllocator<T>::k_threadCacheSize;
+    template <typename T> constexpr u32 ConcurrentObjectPoolAllocator<T>::k_nullIndex;
+
+    //-----------------------------------------------------------------------------
+    template <typename T> ConcurrentObjectPoolAllocator<T>::ConcurrentObjectPoolAllocator(std::size_t numObjectsPerPage, ObjectPoolAllocatorLimitPolicy limitPolicy) noexcept
+        : m_limitPolicy(limitPolicy), m_numObjectsPerPage(u32(numObjectsPerPage)), m_numPages(0), m_globalHead(PackHead(k_nullIndex, 0)), m_numThreadCaches(0),
+          m_numUncachedAllocations(0), m_numUncachedDeallocations(0), m_peakAllocatedBytes(0)
+    {
+        CS_ASSERT(numObjectsPerPage > 0, "Cannot create a pool of size 0");
+        CS_ASSERT(numObjectsPerPage * k_maxPages < std::size_t(k_nullIndex), "Pool page size is too large.");
+
+        for (auto& threadCache : m_threadCaches)
+        {
+            threadCache.m_threadId.store(std::thread::id(), std::memory_order_relaxed);
+            threadCache.m_numObjects = 0;
+            threadCache.m_numAllocations.store(0, std::memory_order_relaxed);
+            threadCache.m_numDeallocations.store(0, std::memory_order_relaxed);
+        }
+
+#ifdef CS_ENABLE_DEBUG
+        m_activeAllocationCount.store(0, std::memory_order_relaxed);
+#endif
+
+        Expand();
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> AllocatorStats ConcurrentObjectPoolAllocator<T>::GetStats() const noexcept
+    {
+        u64 numAllocations = m_numUncachedAllocations.load(std::memory_order_relaxed);
+        u64 numDeallocations = m_numUncachedDeallocations.load(std::memory_order_relaxed);
+
+        auto numThreadCaches = std::min(m_numThreadCaches.load(std::memory_order_acquire), k_maxThreadCaches);
+        for (u32 i = 0; i < numThreadCaches; ++i)
+        {
+            numAllocations += m_threadCaches[i].m_numAllocations.load(std::memory_order_relaxed);
+            numDeallocations += m_threadCaches[i].m_numDeallocations.load(std::memory_order_relaxed);
+        }
+
+        AllocatorStats stats;
+        stats.m_reservedBytes = GetCapacity() * sizeof(T);
+        stats.m_allocatedBytes = numAllocations > numDeallocations ? std::size_t(numAllocations - numDeallocations) * sizeof(T) : 0;
+        stats.m_numAllocations = numAllocations;
+
+        auto peakAllocatedBytes = m_peakAllocatedBytes.load(std::memory_order_relaxed);
+        while (peakAllocatedBytes < stats.m_allocatedBytes && !m_peakAllocatedBytes.compare_exchange_weak(peakAllocatedBytes, stats.m_allocatedBytes, std::memory_order_relaxed))
+        {
+        }
+        stats.m_peakAllocatedBytes = std::max(peakAllocatedBytes, stats.m_allocatedBytes);
+
+        return stats;
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> void* ConcurrentObjectPoolAllocator<T>::Allocate(std::size_t allocationSize) noexcept
+    {
+        CS_ASSERT(allocationSize == sizeof(T), "Only single objects can be allocated from a concurrent object pool.");
+
+        u32 objectIndex = k_nullIndex;
+
+        auto threadCache = GetCurrentThreadCache();
+        if (threadCache)
+        {
+            IncrementOwnedCounter(threadCache->m_numAllocations);
+        }
+        else
+        {
+            ++m_numUncachedAllocations;
+        }
+
+        if (threadCache && threadCache->m_numObjects > 0)
+        {
+            objectIndex = threadCache->m_objectIndices[--threadCache->m_numObjects];
+        }
+        else
+        {
+            objectIndex = PopGlobal();
+            while (objectIndex == k_nullIndex)
+            {
+                switch (m_limitPolicy)
+                {
+                    case ObjectPoolAllocatorLimitPolicy::k_fixed:
+                        CS_LOG_FATAL("ObjectPool out of memory. Allocate more upfront or change to an expansion policy");
+                        return nullptr;
+                    case ObjectPoolAllocatorLimitPolicy::k_expand:
+                        Expand();
+                        break;
+                }
+
+                objectIndex = PopGlobal();
+            }
+        }
+
+#ifdef CS_ENABLE_DEBUG
+        GetPage(objectIndex).m_isAllocated[objectIndex % m_numObjectsPerPage].store(true, std::memory_order_relaxed);
+        ++m_activeAllocationCount;
+#endif
+
+        return GetObject(objectIndex);
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> T* ConcurrentObjectPoolAllocator<T>::Allocate() noexcept
+    {
+        void* memory = Allocate(sizeof(T));
+        T* object = new (memory) T();
+        return object;
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> void ConcurrentObjectPoolAllocator<T>::Deallocate(void* pointer, std::size_t allocationSize) noexcept
+    {
+        CS_ASSERT(allocationSize == sizeof(T), "Only single objects can be allocated from a concurrent object pool.");
+
+        u32 objectIndex = GetObjectIndex((T*)pointer);
+        CS_ASSERT(objectIndex != k_nullIndex, "Pointer you are trying to deallocate from pool is not managed by this pool");
+
+#ifdef CS_ENABLE_DEBUG
+        bool wasAllocated = GetPage(objectIndex).m_isAllocated[objectIndex % m_numObjectsPerPage].exchange(false, std::memory_order_relaxed);
+        CS_ASSERT(wasAllocated, "Pointer you are trying to deallocate from pool has not been allocated");
+        --m_activeAllocationCount;
+#endif
+
+        auto threadCache = GetCurrentThreadCache();
+        if (!threadCache)
+        {
+            ++m_numUncachedDeallocations;
+            PushGlobal(objectIndex, objectIndex);
+            return;
+        }
+
+        IncrementOwnedCounter(threadCache->m_numDeallocations);
+
+        if (threadCache->m_numObjects == k_threadCacheSize)
+        {
+            // Half of the cache is returned to the global list so that alternating
+            // allocations and deallocations don't repeatedly hit the global list.
+            constexpr u32 k_numToReturn = k_threadCacheSize / 2;
+            u32 firstIndex = threadCache->m_objectIndices[k_threadCacheSize - k_numToReturn];
+            for (u32 i = k_threadCacheSize - k_numToReturn; i < k_threadCacheSize - 1; ++i)
+            {
+                auto currentIndex = threadCache->m_objectIndices[i];
+                GetPage(currentIndex).m_nextFreeIndices[currentIndex % m_numObjectsPerPage].store(threadCache->m_objectIndices[i + 1], std::memory_order_relaxed);
+            }
+
+            PushGlobal(firstIndex, threadCache->m_objectIndices[k_threadCacheSize - 1]);
+            threadCache->m_numObjects -= k_numToReturn;
+        }
+
+        threadCache->m_objectIndices[threadCache->m_numObjects++] = objectIndex;
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> void ConcurrentObjectPoolAllocator<T>::Deallocate(T* pointer) noexcept
+    {
+        pointer->~T();
+        Deallocate((void*)pointer, sizeof(T));
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> const typename ConcurrentObjectPoolAllocator<T>::Page& ConcurrentObjectPoolAllocator<T>::GetPage(u32 objectIndex) const noexcept
+    {
+        return m_pages[objectIndex / m_numObjectsPerPage];
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> T* ConcurrentObjectPoolAllocator<T>::GetObject(u32 objectIndex) const noexcept
+    {
+        return GetPage(objectIndex).m_objects + (objectIndex % m_numObjectsPerPage);
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> u32 ConcurrentObjectPoolAllocator<T>::GetObjectIndex(const T* pointer) const noexcept
+    {
+        auto numPages = m_numPages.load(std::memory_order_acquire);
+        for (u32 i = 0; i < numPages; ++i)
+        {
+            if (pointer >= m_pages[i].m_objects && pointer < m_pages[i].m_objects + m_numObjectsPerPage)
+            {
+                return i * m_numObjectsPerPage + u32(pointer - m_pages[i].m_objects);
+            }
+        }
+
+        return k_nullIndex;
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> typename ConcurrentObjectPoolAllocator<T>::ThreadCache* ConcurrentObjectPoolAllocator<T>::GetCurrentThreadCache() noexcept
+    {
+        auto threadId = std::this_thread::get_id();
+
+        auto numThreadCaches = std::min(m_numThreadCaches.load(std::memory_order_acquire), k_maxThreadCaches);
+        for (u32 i = 0; i < numThreadCaches; ++i)
+        {
+            if (m_threadCaches[i].m_threadId.load(std::memory_order_relaxed) == threadId)
+            {
+                return &m_threadCaches[i];
+            }
+        }
+
+        if (numThreadCaches == k_maxThreadCaches)
+        {
+            return nullptr;
+        }
+
+        // Caches are claimed but never released. Other threads skip claimed caches which
+        // have not yet been published, as they can never belong to them.
+        auto cacheIndex = m_numThreadCaches.fetch_add(1);
+        if (cacheIndex >= k_maxThreadCaches)
+        {
+            return nullptr;
+        }
+
+        auto& threadCache = m_threadCaches[cacheIndex];
+        threadCache.m_threadId.store(threadId, std::memory_order_release);
+        return &threadCache;
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> void ConcurrentObjectPoolAllocator<T>::PushGlobal(u32 firstIndex, u32 lastIndex) noexcept
+    {
+        auto& lastNextFreeIndex = GetPage(lastIndex).m_nextFreeIndices[lastIndex % m_numObjectsPerPage];
+
+        auto head = m_globalHead.load(std::memory_order_relaxed);
+        do
+        {
+            lastNextFreeIndex.store(u32(head), std::memory_order_relaxed);
+        }
+        while (!m_globalHead.compare_exchange_weak(head, PackHead(firstIndex, u32(head >> 32) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> u32 ConcurrentObjectPoolAllocator<T>::PopGlobal() noexcept
+    {
+        auto head = m_globalHead.load(std::memory_order_acquire);
+        while (u32(head) != k_nullIndex)
+        {
+            // If another thread takes the head first the next index may be stale, but the
+            // tag will have changed so the exchange will fail.
+            auto objectIndex = u32(head);
+            auto nextIndex = GetPage(objectIndex).m_nextFreeIndices[objectIndex % m_numObjectsPerPage].load(std::memory_order_relaxed);
+            if (m_globalHead.compare_exchange_weak(head, PackHead(nextIndex, u32(head >> 32) + 1), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return objectIndex;
+            }
+        }
+
+        return k_nullIndex;
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> void ConcurrentObjectPoolAllocator<T>::Expand() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_expandMutex);
+
+        // Another thread may have expanded the pool while this was waiting on the lock.
+        auto numPages = m_numPages.load(std::memory_order_relaxed);
+        if (numPages > 0 && u32(m_globalHead.load(std::memory_order_acquire)) != k_nullIndex)
+        {
+            return;
+        }
+
+        CS_RELEASE_ASSERT(numPages < k_maxPages, "ObjectPool has reached the maximum number of pages.");
+
+        auto& page = m_pages[numPages];
+        page.m_objects = (T*)malloc(sizeof(T) * m_numObjectsPerPage);
+        page.m_nextFreeIndices = new std::atomic<u32>[m_numObjectsPerPage];
+#ifdef CS_ENABLE_DEBUG
+        page.m_isAllocated = new std::atomic<bool>[m_numObjectsPerPage];
+#endif
+
+        u32 firstIndex = numPages * m_numObjectsPerPage;
+        for (u32 i = 0; i < m_numObjectsPerPage; ++i)
+        {
+            page.m_nextFreeIndices[i].store(firstIndex + i + 1, std::memory_order_relaxed);
+#ifdef CS_ENABLE_DEBUG
+            page.m_isAllocated[i].store(false, std::memory_order_relaxed);
+#endif
+        }
+
+        m_numPages.store(numPages + 1, std::memory_order_release);
+        PushGlobal(firstIndex, firstIndex + m_numObjectsPerPage - 1);
+    }
+
+    //-----------------------------------------------------------------------------
+    template <typename T> ConcurrentObjectPoolAllocator<T>::~ConcurrentObjectPoolAllocator() noexcept
+    {
+#ifdef CS_ENABLE_DEBUG
+        CS_ASSERT(m_activeAllocationCount == 0, "Cannot destroy the pool before all allocations have been deallocated.");
+#endif
+
+        auto numPages = m_numPages.load(std::memory_order_acquire);
+        for (u32 i = 0; i < numPages; ++i)
+        {
+            free(m_pages[i].m_objects);
+            delete[] m_pages[i].m_nextFreeIndices;
+#ifdef CS_ENABLE_DEBUG
+            delete[] m_pages[i].m_isAllocated;
+#endif
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,254 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Memory/ConcurrentPagedLinearAllocator.h>
+
+#include <ChilliSource/Core/Memory/MemoryUtils.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr std::size_t k_alignment = sizeof(std::intptr_t);
+    }
+
+    constexpr std::size_t ConcurrentPagedLinearAllocator::k_defaultPageSize;
+    constexpr u32 ConcurrentPagedLinearAllocator::k_maxArenas;
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::ConcurrentPagedLinearAllocator(std::size_t pageSize) noexcept
+        : m_pageSize(pageSize), m_numArenas(0)
+    {
+        CS_ASSERT(MemoryUtils::IsAligned(m_pageSize, k_alignment), "Page size must be pointer aligned.");
+
+        for (auto& arena : m_arenas)
+        {
+            arena.m_threadId.store(std::thread::id(), std::memory_order_relaxed);
+            arena.m_nextPointer = nullptr;
+            arena.m_pageEnd = nullptr;
+            arena.m_allocatedBytes.store(0, std::memory_order_relaxed);
+            arena.m_numAllocations.store(0, std::memory_order_relaxed);
+        }
+
+        m_sharedArena.m_nextPointer = nullptr;
+        m_sharedArena.m_pageEnd = nullptr;
+        m_sharedArena.m_allocatedBytes.store(0, std::memory_order_relaxed);
+        m_sharedArena.m_numAllocations.store(0, std::memory_order_relaxed);
+
+#ifdef CS_ENABLE_DEBUG
+        m_activeAllocationCount.store(0, std::memory_order_relaxed);
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t ConcurrentPagedLinearAllocator::GetNumPages() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+        return m_pages.size();
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Stats ConcurrentPagedLinearAllocator::GetCurrentStats() const noexcept
+    {
+        Stats stats;
+        stats.m_allocatedBytes = m_sharedArena.m_allocatedBytes.load(std::memory_order_relaxed);
+
+        auto numArenas = std::min(m_numArenas.load(std::memory_order_acquire), k_maxArenas);
+        for (u32 i = 0; i < numArenas; ++i)
+        {
+            stats.m_allocatedBytes += m_arenas[i].m_allocatedBytes.load(std::memory_order_relaxed);
+        }
+
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+        stats.m_numPagesUsed = m_numPagesUsed;
+
+        return stats;
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Stats ConcurrentPagedLinearAllocator::GetLastResetStats() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+        return m_lastResetStats;
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Stats ConcurrentPagedLinearAllocator::GetPeakStats() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+        return m_peakStats;
+    }
+
+    //------------------------------------------------------------------------------
+    AllocatorStats ConcurrentPagedLinearAllocator::GetStats() const noexcept
+    {
+        AllocatorStats stats;
+        stats.m_allocatedBytes = GetCurrentStats().m_allocatedBytes;
+        stats.m_numAllocations = m_sharedArena.m_numAllocations.load(std::memory_order_relaxed);
+
+        auto numArenas = std::min(m_numArenas.load(std::memory_order_acquire), k_maxArenas);
+        for (u32 i = 0; i < numArenas; ++i)
+        {
+            stats.m_numAllocations += m_arenas[i].m_numAllocations.load(std::memory_order_relaxed);
+        }
+
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+        stats.m_reservedBytes = m_pages.size() * m_pageSize;
+        stats.m_peakAllocatedBytes = std::max(m_peakStats.m_allocatedBytes, stats.m_allocatedBytes);
+
+        return stats;
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentPagedLinearAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        CS_ASSERT(allocationSize <= GetMaxAllocationSize(), "Allocation size is too big.");
+
+#ifdef CS_ENABLE_DEBUG
+        ++m_activeAllocationCount;
+#endif
+
+        auto arena = GetCurrentThreadArena();
+        if (arena)
+        {
+            return AllocateFromArena(*arena, allocationSize);
+        }
+
+        std::unique_lock<std::mutex> lock(m_sharedArenaMutex);
+        return AllocateFromArena(m_sharedArena, allocationSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::Deallocate(void* pointer, std::size_t allocationSize) noexcept
+    {
+#ifdef CS_ENABLE_DEBUG
+        CS_ASSERT(m_activeAllocationCount > 0, "Cannot deallocate a pointer that did not originate from this allocator.");
+        --m_activeAllocationCount;
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::Reset() noexcept
+    {
+#ifdef CS_ENABLE_DEBUG
+        CS_ASSERT(m_activeAllocationCount == 0, "Cannot reset before all allocations have been deallocated.");
+#endif
+
+        auto currentStats = GetCurrentStats();
+
+        auto numArenas = std::min(m_numArenas.load(std::memory_order_acquire), k_maxArenas);
+        for (u32 i = 0; i < numArenas; ++i)
+        {
+            m_arenas[i].m_nextPointer = nullptr;
+            m_arenas[i].m_pageEnd = nullptr;
+            m_arenas[i].m_allocatedBytes.store(0, std::memory_order_relaxed);
+        }
+
+        m_sharedArena.m_nextPointer = nullptr;
+        m_sharedArena.m_pageEnd = nullptr;
+        m_sharedArena.m_allocatedBytes.store(0, std::memory_order_relaxed);
+
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+        m_numPagesUsed = 0;
+        m_lastResetStats = currentStats;
+        m_peakStats.m_allocatedBytes = std::max(m_peakStats.m_allocatedBytes, currentStats.m_allocatedBytes);
+        m_peakStats.m_numPagesUsed = std::max(m_peakStats.m_numPagesUsed, currentStats.m_numPagesUsed);
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Arena* ConcurrentPagedLinearAllocator::GetCurrentThreadArena() noexcept
+    {
+        auto threadId = std::this_thread::get_id();
+
+        auto numArenas = std::min(m_numArenas.load(std::memory_order_acquire), k_maxArenas);
+        for (u32 i = 0; i < numArenas; ++i)
+        {
+            if (m_arenas[i].m_threadId.load(std::memory_order_relaxed) == threadId)
+            {
+                return &m_arenas[i];
+            }
+        }
+
+        if (numArenas == k_maxArenas)
+        {
+            return nullptr;
+        }
+
+        // Arenas are claimed but never released. Other threads skip claimed arenas which
+        // have not yet been published, as they can never belong to them.
+        auto arenaIndex = m_numArenas.fetch_add(1);
+        if (arenaIndex >= k_maxArenas)
+        {
+            return nullptr;
+        }
+
+        auto& arena = m_arenas[arenaIndex];
+        arena.m_threadId.store(threadId, std::memory_order_release);
+        return &arena;
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentPagedLinearAllocator::AllocateFromArena(Arena& arena, std::size_t allocationSize) noexcept
+    {
+        if (arena.m_nextPointer == nullptr || std::size_t(arena.m_pageEnd - arena.m_nextPointer) < allocationSize)
+        {
+            TakePage(arena);
+        }
+
+        u8* output = arena.m_nextPointer;
+        arena.m_nextPointer = std::min(MemoryUtils::Align(arena.m_nextPointer + allocationSize, k_alignment), arena.m_pageEnd);
+
+        // Only the owning thread writes the count, so it doesn't need to be atomically incremented.
+        arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(std::memory_order_relaxed) + allocationSize, std::memory_order_relaxed);
+        arena.m_numAllocations.store(arena.m_numAllocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::TakePage(Arena& arena) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_pageMutex);
+
+        if (m_numPagesUsed == m_pages.size())
+        {
+            m_pages.push_back(std::unique_ptr<u8[]>(new u8[m_pageSize]));
+        }
+
+        u8* page = m_pages[m_numPagesUsed++].get();
+        arena.m_nextPointer = page;
+        arena.m_pageEnd = page + m_pageSize;
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::~ConcurrentPagedLinearAllocator() noexcept
+    {
+#ifdef CS_ENABLE_DEBUG
+        CS_ASSERT(m_activeAllocationCount == 0, "Cannot destroy the allocator before all allocations have been deallocated.");
+#endif
+    }
+}
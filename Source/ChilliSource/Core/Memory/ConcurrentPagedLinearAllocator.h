@@ -0,0 +1,198 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MEMORY_CONCURRENTPAGEDLINEARALLOCATOR_H_
+#define _CHILLISOURCE_CORE_MEMORY_CONCURRENTPAGEDLINEARALLOCATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Memory/IAllocator.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A thread-safe version of the paged linear allocator. Each thread which allocates
+    /// from it is given its own linear arena, which moves through pages taken from a
+    /// shared set of pages. Allocating therefore only requires a lock when an arena
+    /// needs a new page. All arenas are reset together, returning every page to the
+    /// shared set. Pages are never deallocated until the allocator is destroyed.
+    ///
+    /// Usage statistics are tracked, so that the memory required each frame can be
+    /// determined when this is used as a frame allocator.
+    ///
+    /// Allocating, deallocating and querying statistics is thread-safe, but Reset() must not
+    /// be called while any other thread is allocating from the allocator.
+    ///
+    class ConcurrentPagedLinearAllocator final : public IAllocator
+    {
+    public:
+        CS_DECLARE_NOCOPY(ConcurrentPagedLinearAllocator);
+
+        static constexpr std::size_t k_defaultPageSize = 64 * 1024;
+        static constexpr u32 k_maxArenas = 32;
+
+        /// Usage statistics for the period between two resets.
+        ///
+        struct Stats final
+        {
+            std::size_t m_allocatedBytes = 0;
+            std::size_t m_numPagesUsed = 0;
+        };
+
+        /// Initialises a new allocator with the given page size. Pages will be allocated from
+        /// the free store.
+        ///
+        /// @param pageSize
+        ///     The size of a page.
+        ///
+        ConcurrentPagedLinearAllocator(std::size_t pageSize = k_defaultPageSize) noexcept;
+
+        /// @return The maximum allocation size from this allocator. This will always be the
+        ///     size of a page.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return m_pageSize; }
+
+        /// @return The size of a page.
+        ///
+        std::size_t GetPageSize() const noexcept { return m_pageSize; }
+
+        /// @return The total number of pages held by the allocator, whether or not they are in
+        ///     use.
+        ///
+        std::size_t GetNumPages() const noexcept;
+
+        /// @return The usage of the allocator since it was last reset.
+        ///
+        Stats GetCurrentStats() const noexcept;
+
+        /// @return The usage of the allocator immediately prior to it last being reset.
+        ///
+        Stats GetLastResetStats() const noexcept;
+
+        /// @return The peak usage of the allocator between any two resets. Each statistic is
+        ///     the peak for that value, so they may be from different periods.
+        ///
+        Stats GetPeakStats() const noexcept;
+
+        /// @return The current memory usage of the allocator, in the general allocator form.
+        ///
+        AllocatorStats GetStats() const noexcept override;
+
+        /// Allocates a new block of memory of the requested size from the calling thread's
+        /// arena. If there is no space left in the arena's current page then it will take
+        /// a new page. Allocations must be no larger than a single page.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Deallocates the given memory. The memory isn't reused until the allocator is reset,
+        /// so this only tracks the number of active allocations in debug builds. This can be
+        /// called from a different thread to the one which allocated the memory.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        /// @param allocationSize
+        ///     Size of the initial allocation
+        ///
+        void Deallocate(void* pointer, std::size_t allocationSize) noexcept override;
+
+        /// Resets all arenas, allowing all previously allocated memory to be reused.
+        /// Deallocate() must have been called for all allocated blocks prior to this being
+        /// called, and no other thread can be using the allocator.
+        ///
+        void Reset() noexcept;
+
+        ~ConcurrentPagedLinearAllocator() noexcept;
+
+    private:
+        /// The linear arena for a single thread.
+        ///
+        struct Arena final
+        {
+            std::atomic<std::thread::id> m_threadId;
+            u8* m_nextPointer;
+            u8* m_pageEnd;
+            std::atomic<std::size_t> m_allocatedBytes;
+            std::atomic<u64> m_numAllocations;
+        };
+
+        /// @return The arena for the calling thread, or null if all arenas are in use by
+        ///     other threads.
+        ///
+        Arena* GetCurrentThreadArena() noexcept;
+
+        /// Allocates the given number of bytes from the given arena, taking a new page if
+        /// required.
+        ///
+        /// @param arena
+        ///     The arena to allocate from.
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* AllocateFromArena(Arena& arena, std::size_t allocationSize) noexcept;
+
+        /// Takes a free page from the shared pages for the given arena, allocating a new page
+        /// if there are none free.
+        ///
+        /// @param arena
+        ///     The arena to give the page to.
+        ///
+        void TakePage(Arena& arena) noexcept;
+
+        const std::size_t m_pageSize;
+
+        mutable std::mutex m_pageMutex;
+        std::vector<std::unique_ptr<u8[]>> m_pages;
+        std::size_t m_numPagesUsed = 0;
+
+        std::array<Arena, k_maxArenas> m_arenas;
+        std::atomic<u32> m_numArenas;
+
+        // Threads which have no arena of their own share an arena under a lock.
+        std::mutex m_sharedArenaMutex;
+        Arena m_sharedArena;
+
+        // Guarded by the page mutex.
+        Stats m_lastResetStats;
+        Stats m_peakStats;
+
+#ifdef CS_ENABLE_DEBUG
+        std::atomic<s64> m_activeAllocationCount;
+#endif
+    };
+}
+
+#endif
@@ -32,6 +32,21 @@
 
 namespace ChilliSource
 {
+    /// A snapshot of the memory usage of an allocator, for use in memory reporting.
+    ///
+    /// The reserved bytes are the memory owned by the allocator, whether or not it is in
+    /// use. The allocated bytes are the requested bytes which are currently in use, and
+    /// therefore cannot be reused; for linear allocators this is everything allocated since
+    /// the last reset. The number of allocations is the total over the allocator's lifetime.
+    ///
+    struct AllocatorStats final
+    {
+        std::size_t m_reservedBytes = 0;
+        std::size_t m_allocatedBytes = 0;
+        std::size_t m_peakAllocatedBytes = 0;
+        u64 m_numAllocations = 0;
+    };
+
     /// An interface for all allocator types. This provides the allocation and deallocation
     /// methods which all allocators should implement.
     ///
@@ -47,6 +62,14 @@ namespace ChilliSource
         ///
         virtual std::size_t GetMaxAllocationSize() const noexcept = 0;
 
+        /// Memory reporting is opt-in: allocators which do not track their usage can leave
+        /// this unimplemented, in which case empty stats are returned.
+        ///
+        /// @return The current memory usage of the allocator. This is thread-safe if the
+        ///     allocator is thread-safe.
+        ///
+        virtual AllocatorStats GetStats() const noexcept { return AllocatorStats(); }
+
         /// Allocates a new block of memory of the requested size. Note that the underlying
         /// implemention may allocate more memory than has been requested.
         ///
@@ -26,6 +26,7 @@
 
 #include <ChilliSource/Core/Memory/MemoryUtils.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace ChilliSource
@@ -54,6 +55,17 @@ namespace ChilliSource
         return freeSpaceAligned;
     }
 
+    //------------------------------------------------------------------------------
+    AllocatorStats LinearAllocator::GetStats() const noexcept
+    {
+        AllocatorStats stats;
+        stats.m_reservedBytes = m_bufferSize;
+        stats.m_allocatedBytes = m_allocatedBytes;
+        stats.m_peakAllocatedBytes = m_peakAllocatedBytes;
+        stats.m_numAllocations = m_numAllocations;
+        return stats;
+    }
+
     //------------------------------------------------------------------------------
     void* LinearAllocator::Allocate(std::size_t allocationSize) noexcept
     {
@@ -64,6 +76,10 @@ namespace ChilliSource
 
         ++m_activeAllocationCount;
 
+        m_allocatedBytes += allocationSize;
+        m_peakAllocatedBytes = std::max(m_peakAllocatedBytes, m_allocatedBytes);
+        ++m_numAllocations;
+
         return output;
     }
 
@@ -87,6 +103,7 @@ namespace ChilliSource
         CS_ASSERT(m_activeAllocationCount == 0, "Cannot reset before all allocations have been deallocated.");
 
         m_nextPointer = MemoryUtils::Align(m_buffer, sizeof(std::intptr_t));
+        m_allocatedBytes = 0;
     }
 
     //------------------------------------------------------------------------------
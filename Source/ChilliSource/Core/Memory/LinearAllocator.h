@@ -81,6 +81,10 @@ namespace ChilliSource
         ///
         std::size_t GetRemainingSpace() const noexcept;
 
+        /// @return The current memory usage of the allocator.
+        ///
+        AllocatorStats GetStats() const noexcept override;
+
         /// Allocates a new block of memory of the requested size. If there is no space left in the
         /// buffer for the alloaction then this will assert.
         ///
@@ -132,6 +136,10 @@ namespace ChilliSource
         std::uint8_t* m_nextPointer = nullptr;
 
         std::size_t m_activeAllocationCount = 0;
+
+        std::size_t m_allocatedBytes = 0;
+        std::size_t m_peakAllocatedBytes = 0;
+        u64 m_numAllocations = 0;
     };
 }
 
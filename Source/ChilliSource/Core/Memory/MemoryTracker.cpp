@@ -0,0 +1,209 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Json/JsonUtils.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    CS_DEFINE_NAMEDTYPE(MemoryTracker);
+
+    //------------------------------------------------------------------------------
+    MemoryTrackerUPtr MemoryTracker::Create() noexcept
+    {
+        return MemoryTrackerUPtr(new MemoryTracker());
+    }
+
+    //------------------------------------------------------------------------------
+    bool MemoryTracker::IsA(InterfaceIDType interfaceId) const noexcept
+    {
+        return (MemoryTracker::InterfaceID == interfaceId);
+    }
+
+    //------------------------------------------------------------------------------
+    bool MemoryTracker::IsEnabled() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_isEnabled;
+    }
+
+    //------------------------------------------------------------------------------
+    void MemoryTracker::SetEnabled(bool isEnabled) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (isEnabled && !m_isEnabled)
+        {
+            for (auto& entry : m_allocators)
+            {
+                entry.m_numAllocationsAtFrameStart = entry.m_allocator->GetStats().m_numAllocations;
+                entry.m_numAllocationsLastFrame = 0;
+            }
+        }
+
+        m_isEnabled = isEnabled;
+    }
+
+    //------------------------------------------------------------------------------
+    void MemoryTracker::RegisterAllocator(const std::string& name, const IAllocator* allocator) noexcept
+    {
+        CS_ASSERT(allocator, "Cannot register a null allocator.");
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        CS_ASSERT(std::find_if(m_allocators.begin(), m_allocators.end(), [=](const AllocatorEntry& entry) { return entry.m_allocator == allocator; }) == m_allocators.end(),
+                  "Allocator '" + name + "' is already registered.");
+
+        AllocatorEntry entry;
+        entry.m_name = name;
+        entry.m_allocator = allocator;
+        entry.m_numAllocationsAtFrameStart = allocator->GetStats().m_numAllocations;
+        m_allocators.push_back(std::move(entry));
+    }
+
+    //------------------------------------------------------------------------------
+    void MemoryTracker::DeregisterAllocator(const IAllocator* allocator) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        auto it = std::find_if(m_allocators.begin(), m_allocators.end(), [=](const AllocatorEntry& entry) { return entry.m_allocator == allocator; });
+        CS_ASSERT(it != m_allocators.end(), "Cannot deregister an allocator which is not registered.");
+
+        m_allocators.erase(it);
+    }
+
+    //------------------------------------------------------------------------------
+    std::vector<MemoryTracker::AllocatorReport> MemoryTracker::GetAllocatorReports() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        std::vector<AllocatorReport> reports;
+        reports.reserve(m_allocators.size());
+
+        for (const auto& entry : m_allocators)
+        {
+            AllocatorReport report;
+            report.m_name = entry.m_name;
+            report.m_stats = entry.m_allocator->GetStats();
+            report.m_numAllocationsLastFrame = entry.m_numAllocationsLastFrame;
+            reports.push_back(std::move(report));
+        }
+
+        return reports;
+    }
+
+    //------------------------------------------------------------------------------
+    std::vector<ResourcePool::ResourceTypeMemoryUsage> MemoryTracker::GetResourceReports() const noexcept
+    {
+        auto resourcePool = Application::Get()->GetResourcePool();
+        CS_ASSERT(resourcePool, "Resource pool must exist.");
+
+        return resourcePool->GetMemoryUsage();
+    }
+
+    //------------------------------------------------------------------------------
+    Json::Value MemoryTracker::ToJson() const noexcept
+    {
+        std::size_t totalReservedBytes = 0;
+        Json::Value allocatorsJson(Json::arrayValue);
+        for (const auto& report : GetAllocatorReports())
+        {
+            Json::Value allocatorJson(Json::objectValue);
+            allocatorJson["Name"] = report.m_name;
+            allocatorJson["ReservedBytes"] = Json::UInt64(report.m_stats.m_reservedBytes);
+            allocatorJson["AllocatedBytes"] = Json::UInt64(report.m_stats.m_allocatedBytes);
+            allocatorJson["PeakAllocatedBytes"] = Json::UInt64(report.m_stats.m_peakAllocatedBytes);
+            allocatorJson["NumAllocations"] = Json::UInt64(report.m_stats.m_numAllocations);
+            allocatorJson["NumAllocationsLastFrame"] = Json::UInt64(report.m_numAllocationsLastFrame);
+            allocatorsJson.append(allocatorJson);
+
+            totalReservedBytes += report.m_stats.m_reservedBytes;
+        }
+
+        std::size_t totalResourceBytes = 0;
+        Json::Value resourcesJson(Json::arrayValue);
+        for (const auto& report : GetResourceReports())
+        {
+            Json::Value resourceJson(Json::objectValue);
+            resourceJson["Type"] = report.m_typeName;
+            resourceJson["NumResources"] = report.m_numResources;
+            resourceJson["EstimatedBytes"] = Json::UInt64(report.m_estimatedBytes);
+            resourcesJson.append(resourceJson);
+
+            totalResourceBytes += report.m_estimatedBytes;
+        }
+
+        Json::Value json(Json::objectValue);
+        json["Allocators"] = allocatorsJson;
+        json["TotalAllocatorReservedBytes"] = Json::UInt64(totalReservedBytes);
+        json["Resources"] = resourcesJson;
+        json["TotalResourceEstimatedBytes"] = Json::UInt64(totalResourceBytes);
+        return json;
+    }
+
+    //------------------------------------------------------------------------------
+    bool MemoryTracker::WriteJson(StorageLocation storageLocation, const std::string& filePath) const noexcept
+    {
+        return JsonUtils::WriteJson(storageLocation, filePath, ToJson());
+    }
+
+    //------------------------------------------------------------------------------
+    void MemoryTracker::OnUpdate(f32 deltaTime) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (!m_isEnabled)
+        {
+            return;
+        }
+
+        for (auto& entry : m_allocators)
+        {
+            auto numAllocations = entry.m_allocator->GetStats().m_numAllocations;
+            entry.m_numAllocationsLastFrame = numAllocations - entry.m_numAllocationsAtFrameStart;
+            entry.m_numAllocationsAtFrameStart = numAllocations;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void MemoryTracker::OnDestroy() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+#ifdef CS_ENABLE_DEBUG
+        for (const auto& entry : m_allocators)
+        {
+            CS_LOG_ERROR("Allocator still registered with the memory tracker: " + entry.m_name);
+        }
+#endif
+
+        m_allocators.clear();
+    }
+}
@@ -0,0 +1,178 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_MEMORY_MEMORYTRACKER_H_
+#define _CHILLISOURCE_CORE_MEMORY_MEMORYTRACKER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Memory/IAllocator.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <json/forwards.h>
+
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A system for reporting the memory used by the engine, intended to help tune
+    /// memory budgets. This reports on two things:
+    ///
+    /// * Named allocators, which are registered by the systems that own them. The
+    ///   reserved, allocated and peak bytes of each are reported, along with the number
+    ///   of allocations made during the last frame.
+    /// * The estimated memory used by the resources cached in the resource pool,
+    ///   grouped by resource type.
+    ///
+    /// Tracking is opt-in: allocators can always be registered, but the per frame
+    /// allocation counts are only sampled while tracking is enabled. Reports can be
+    /// queried at any time, or written to a JSON file.
+    ///
+    /// The stats of registered allocators are read on the main thread, so allocators
+    /// which are not thread-safe should only be registered if they are only used on the
+    /// main thread.
+    ///
+    /// This is thread-safe.
+    ///
+    class MemoryTracker final : public AppSystem
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(MemoryTracker);
+
+        /// The memory usage of a single registered allocator.
+        ///
+        struct AllocatorReport final
+        {
+            std::string m_name;
+            AllocatorStats m_stats;
+            u64 m_numAllocationsLastFrame = 0;
+        };
+
+        /// Allows querying of whether or not this system implements the interface described by the
+        /// given interface Id. Typically this is not called directly as the templated equivalent
+        /// IsA<Interface>() is preferred.
+        ///
+        /// @param interfaceId
+        ///     The Id of the interface.
+        ///
+        /// @return Whether or not the interface is implemented.
+        ///
+        bool IsA(InterfaceIDType interfaceId) const noexcept override;
+
+        /// @return Whether or not per frame tracking is enabled.
+        ///
+        bool IsEnabled() const noexcept;
+
+        /// Enables or disables per frame tracking. This is disabled by default.
+        ///
+        /// @param isEnabled
+        ///     Whether or not tracking should be enabled.
+        ///
+        void SetEnabled(bool isEnabled) noexcept;
+
+        /// Registers an allocator for reporting under the given name. The allocator must
+        /// be deregistered before it is destroyed.
+        ///
+        /// @param name
+        ///     The name the allocator is reported under. This typically describes the
+        ///     system which owns it.
+        /// @param allocator
+        ///     The allocator.
+        ///
+        void RegisterAllocator(const std::string& name, const IAllocator* allocator) noexcept;
+
+        /// Deregisters a previously registered allocator.
+        ///
+        /// @param allocator
+        ///     The allocator.
+        ///
+        void DeregisterAllocator(const IAllocator* allocator) noexcept;
+
+        /// @return The current memory usage of each registered allocator, in the order they
+        ///     were registered.
+        ///
+        std::vector<AllocatorReport> GetAllocatorReports() const noexcept;
+
+        /// @return The estimated memory usage of the cached resources of each type.
+        ///
+        std::vector<ResourcePool::ResourceTypeMemoryUsage> GetResourceReports() const noexcept;
+
+        /// @return A JSON representation of the current allocator and resource reports.
+        ///
+        Json::Value ToJson() const noexcept;
+
+        /// Writes the current allocator and resource reports to the given JSON file.
+        ///
+        /// @param storageLocation
+        ///     The storage location to write to.
+        /// @param filePath
+        ///     The file path to write to.
+        ///
+        /// @return Whether or not the file was successfully written.
+        ///
+        bool WriteJson(StorageLocation storageLocation, const std::string& filePath) const noexcept;
+
+    private:
+        friend class Application;
+
+        /// A registered allocator, along with its allocation count at the start of the
+        /// current frame.
+        ///
+        struct AllocatorEntry final
+        {
+            std::string m_name;
+            const IAllocator* m_allocator = nullptr;
+            u64 m_numAllocationsAtFrameStart = 0;
+            u64 m_numAllocationsLastFrame = 0;
+        };
+
+        /// A factory method for creating new instances of the system. This must be called by
+        /// Application.
+        ///
+        /// @return The new instance of the system.
+        ///
+        static MemoryTrackerUPtr Create() noexcept;
+
+        MemoryTracker() = default;
+
+        /// Samples the allocation count of each registered allocator if tracking is
+        /// enabled.
+        ///
+        /// @param deltaTime
+        ///     The time since the last update.
+        ///
+        void OnUpdate(f32 deltaTime) noexcept override;
+
+        /// Checks that all allocators have been deregistered.
+        ///
+        void OnDestroy() noexcept override;
+
+        mutable std::mutex m_mutex;
+        bool m_isEnabled = false;
+        std::vector<AllocatorEntry> m_allocators;
+    };
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Memory/IAllocator.h>
 
+#include <algorithm>
 #include <mutex>
 #include <vector>
 
@@ -67,6 +68,10 @@ namespace ChilliSource
         ///
         std::size_t GetMaxAllocationSize() const noexcept override { return m_capacityObjects * sizeof(T); };
         
+        /// @return The current memory usage of the pool.
+        ///
+        AllocatorStats GetStats() const noexcept override;
+        
         /// Should be used to allocate only a single object and will
         /// assert if the given size is not aligned with sizeof(T).
         ///
@@ -146,9 +151,11 @@ namespace ChilliSource
         
         ObjectPoolAllocatorLimitPolicy m_limitPolicy;
         std::size_t m_activeAllocationCount = 0;
+        std::size_t m_peakActiveAllocationCount = 0;
+        u64 m_numAllocations = 0;
 		std::size_t m_capacityObjects;
 
-        std::mutex m_mutex;
+        mutable std::mutex m_mutex;
         
         //Buffers are paged to accomodate expansion without invalidating the existing pointers
         //Fixed size only has a single buffer
@@ -173,6 +180,19 @@ namespace ChilliSource
         Reset();
     }
     
+    //-----------------------------------------------------------------------------
+    template <typename T> AllocatorStats ObjectPoolAllocator<T>::GetStats() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        AllocatorStats stats;
+        stats.m_reservedBytes = m_capacityObjects * sizeof(T);
+        stats.m_allocatedBytes = m_activeAllocationCount * sizeof(T);
+        stats.m_peakAllocatedBytes = m_peakActiveAllocationCount * sizeof(T);
+        stats.m_numAllocations = m_numAllocations;
+        return stats;
+    }
+    
     //-----------------------------------------------------------------------------
     template <typename T> void* ObjectPoolAllocator<T>::Allocate(std::size_t allocationSize) noexcept
     {
@@ -200,6 +220,8 @@ namespace ChilliSource
         T* free = *m_freeStoreHead;
         m_freeStoreHead += numToAllocate;
         m_activeAllocationCount += numToAllocate;
+        m_peakActiveAllocationCount = std::max(m_peakActiveAllocationCount, m_activeAllocationCount);
+        ++m_numAllocations;
         return free;
     }
     
@@ -24,6 +24,7 @@
 
 #include <ChilliSource/Core/Memory/PagedLinearAllocator.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace ChilliSource
@@ -55,11 +56,26 @@ namespace ChilliSource
         }
     }
 
+    //------------------------------------------------------------------------------
+    AllocatorStats PagedLinearAllocator::GetStats() const noexcept
+    {
+        AllocatorStats stats;
+        stats.m_reservedBytes = GetNumPages() * m_pageSize;
+        stats.m_allocatedBytes = m_allocatedBytes;
+        stats.m_peakAllocatedBytes = m_peakAllocatedBytes;
+        stats.m_numAllocations = m_numAllocations;
+        return stats;
+    }
+
     //------------------------------------------------------------------------------
     void* PagedLinearAllocator::Allocate(std::size_t allocationSize) noexcept
     {
         CS_ASSERT(allocationSize <= GetMaxAllocationSize(), "Allocation size is too big.");
 
+        m_allocatedBytes += allocationSize;
+        m_peakAllocatedBytes = std::max(m_peakAllocatedBytes, m_allocatedBytes);
+        ++m_numAllocations;
+
         if (m_parentAllocator)
         {
             for (const auto& allocator : m_parentAllocatorLinearAllocators)
@@ -118,6 +134,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PagedLinearAllocator::Reset() noexcept
     {
+        m_allocatedBytes = 0;
+
         if (m_parentAllocator)
         {
             for (auto& allocator : m_parentAllocatorLinearAllocators)
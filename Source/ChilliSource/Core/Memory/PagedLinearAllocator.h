@@ -86,6 +86,10 @@ namespace ChilliSource
         ///
         std::size_t GetNumPages() const noexcept;
 
+        /// @return The current memory usage of the allocator.
+        ///
+        AllocatorStats GetStats() const noexcept override;
+
         /// Allocates a new block of memory of the requested size. If there is no space left in the
         /// buffer for the alloaction then a new page will be allocated. Allocations must be smaller
         /// than the size of a single page.
@@ -128,6 +132,10 @@ namespace ChilliSource
 
         IAllocator* m_parentAllocator = nullptr;
 
+        std::size_t m_allocatedBytes = 0;
+        std::size_t m_peakAllocatedBytes = 0;
+        u64 m_numAllocations = 0;
+
         union
         {
             std::vector<std::unique_ptr<LinearAllocator>> m_freeStoreLinearAllocators;
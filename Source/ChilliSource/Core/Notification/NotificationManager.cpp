@@ -29,7 +29,6 @@
 #include <ChilliSource/Core/Notification/NotificationManager.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Notification/AppNotificationSystem.h>
 #include <ChilliSource/Core/Notification/LocalNotificationSystem.h>
 #include <ChilliSource/Core/Notification/RemoteNotificationSystem.h>
@@ -187,21 +186,21 @@ namespace ChilliSource
         m_appNotificationSystem = Application::Get()->GetSystem<AppNotificationSystem>();
         if (m_appNotificationSystem != nullptr)
         {
-            m_appReceivedConnection = m_appNotificationSystem->GetReceivedEvent().OpenConnection(MakeDelegate(this, &NotificationManager::OnNotificationReceived));
+            m_appReceivedConnection = m_appNotificationSystem->GetReceivedEvent().OpenConnection(this, &NotificationManager::OnNotificationReceived);
         }
         
         //setup the local notification system
         m_localNotificationSystem = Application::Get()->GetSystem<LocalNotificationSystem>();
         if (m_localNotificationSystem != nullptr)
         {
-            m_localReceivedConnection = m_localNotificationSystem->GetReceivedEvent().OpenConnection(MakeDelegate(this, &NotificationManager::OnNotificationReceived));
+            m_localReceivedConnection = m_localNotificationSystem->GetReceivedEvent().OpenConnection(this, &NotificationManager::OnNotificationReceived);
         }
         
         //setup the remote notification system
         m_remoteNotificationSystem = Application::Get()->GetSystem<RemoteNotificationSystem>();
         if (m_remoteNotificationSystem != nullptr)
         {
-            m_remoteReceivedConnection = m_remoteNotificationSystem->GetReceivedEvent().OpenConnection(MakeDelegate(this, &NotificationManager::OnNotificationReceived));
+            m_remoteReceivedConnection = m_remoteNotificationSystem->GetReceivedEvent().OpenConnection(this, &NotificationManager::OnNotificationReceived);
         }
     }
     //------------------------------------------------
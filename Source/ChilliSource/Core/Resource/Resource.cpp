@@ -35,7 +35,7 @@ namespace ChilliSource
     //-------------------------------------------------------
     //-------------------------------------------------------
     Resource::Resource()
-    : m_location(StorageLocation::k_none), m_loadState(LoadState::k_loading)
+    : m_location(StorageLocation::k_none), m_loadPriority(FileTaskPriority::k_immediate), m_loadState(LoadState::k_loading)
     {
     }
     //-------------------------------------------------------
@@ -113,4 +113,22 @@ namespace ChilliSource
     {
         return m_location;
     }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    std::size_t Resource::GetEstimatedMemoryUsage() const
+    {
+        return 0;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void Resource::SetLoadPriority(FileTaskPriority in_priority)
+    {
+        m_loadPriority = in_priority;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    FileTaskPriority Resource::GetLoadPriority() const
+    {
+        return m_loadPriority;
+    }
 }
@@ -33,6 +33,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
+#include <ChilliSource/Core/Threading/FileTaskPriority.h>
 
 #include <atomic>
 
@@ -111,6 +112,12 @@ namespace ChilliSource
         //-------------------------------------------------------
         StorageLocation GetStorageLocation() const;
         //-------------------------------------------------------
+        /// @return The priority of the file task which should
+        /// be used when the resource is loaded asynchronously.
+        /// Providers should schedule their file tasks with this.
+        //-------------------------------------------------------
+        FileTaskPriority GetLoadPriority() const;
+        //-------------------------------------------------------
         /// NOTE: This is used by the resource providers and
         /// should not be called by the general application unless
         /// they are manually constructing resources. The application
@@ -132,6 +139,17 @@ namespace ChilliSource
         //-------------------------------------------------------
         LoadState GetLoadState() const;
         //-------------------------------------------------------
+        /// Used for memory reporting. Resources which hold
+        /// significant amounts of data, such as decoded image
+        /// or mesh data, should override this. Dependent
+        /// resources owned by the resource pool should not be
+        /// included, as they are reported separately.
+        ///
+        /// @return An estimate of the memory used by the
+        /// resource in bytes. Defaults to zero.
+        //-------------------------------------------------------
+        virtual std::size_t GetEstimatedMemoryUsage() const;
+        //-------------------------------------------------------
         /// Virtual desctructor
         ///
         /// @author S Downie
@@ -190,6 +208,14 @@ namespace ChilliSource
         /// loading.
         //-------------------------------------------------------
         const IResourceOptionsBaseCSPtr& GetOptions() const;
+        //-------------------------------------------------------
+        /// Sets the priority of the file task used to load the
+        /// resource asynchronously. This should only be set by
+        /// the resource pool.
+        ///
+        /// @param The load priority.
+        //-------------------------------------------------------
+        void SetLoadPriority(FileTaskPriority in_priority);
         
     private:
         
@@ -199,6 +225,7 @@ namespace ChilliSource
         std::string m_name;
         StorageLocation m_location;
         ResourceId m_id;
+        FileTaskPriority m_loadPriority;
     
         std::atomic<LoadState> m_loadState;
     };
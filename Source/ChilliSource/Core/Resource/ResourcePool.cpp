@@ -172,6 +172,36 @@ namespace ChilliSource
         }
     }
     //------------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------
+    std::vector<ResourcePool::ResourceTypeMemoryUsage> ResourcePool::GetMemoryUsage() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        std::vector<ResourceTypeMemoryUsage> output;
+        
+        for(const auto& descEntry : m_descriptors)
+        {
+            const auto& cachedResources = descEntry.second.m_cachedResources;
+            if(cachedResources.empty() == true)
+            {
+                continue;
+            }
+            
+            ResourceTypeMemoryUsage usage;
+            usage.m_typeName = cachedResources.begin()->second->GetInterfaceTypeName();
+            usage.m_numResources = u32(cachedResources.size());
+            
+            for(const auto& resource : cachedResources)
+            {
+                usage.m_estimatedBytes += resource.second->GetEstimatedMemoryUsage();
+            }
+            
+            output.push_back(std::move(usage));
+        }
+        
+        return output;
+    }
+    //------------------------------------------------------------------------------------
     /// At this stage in the app lifecycle all app and system references to resource
     /// should have been released. If the resource pool still has resources then this
     /// indicated leaks.
@@ -58,6 +58,16 @@ namespace ChilliSource
         
         CS_DECLARE_NAMEDTYPE(ResourcePool);
         
+        //------------------------------------------------------------------------------------
+        /// The estimated memory usage of all cached resources of a single type.
+        //------------------------------------------------------------------------------------
+        struct ResourceTypeMemoryUsage
+        {
+            std::string m_typeName;
+            u32 m_numResources = 0;
+            std::size_t m_estimatedBytes = 0;
+        };
+        
         //------------------------------------------------------------------------------------
         /// Factory method for creating the system
         ///
@@ -187,8 +197,10 @@ namespace ChilliSource
         /// initialisation
         /// @param Delegate to trigger when the resource is loaded or failed. Note: Always
         /// called on the main thread
+        /// @param [Optional] The priority of the file task used to load the resource. If
+        /// the resource is already loading this has no effect. Defaults to immediate.
         //-------------------------------------------------------------------------------------
-        template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+        template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate, FileTaskPriority in_priority = FileTaskPriority::k_immediate);
         //------------------------------------------------------------------------------------
         /// Load the resource of given type from the file location. If the resource at this
         /// location has previously been loaded then the cached version will be returned in the
@@ -207,8 +219,10 @@ namespace ChilliSource
         /// @param File path
         /// @param Delegate to trigger when the resource is loaded or failed. Note: Always
         /// called on the main thread
+        /// @param [Optional] The priority of the file task used to load the resource. If
+        /// the resource is already loading this has no effect. Defaults to immediate.
         //-------------------------------------------------------------------------------------
-        template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+        template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate, FileTaskPriority in_priority = FileTaskPriority::k_immediate);
         //-------------------------------------------------------------------------------------
         /// Forces the pool to release its handle to any unused resources of the given type.
         /// If a resource is still in use the pool will keep it in the cache. The pool is
@@ -244,6 +258,15 @@ namespace ChilliSource
         //-------------------------------------------------------------------------------------
         void Release(const Resource* in_resource);
         //------------------------------------------------------------------------------------
+        /// Calculates the estimated memory usage of the cached resources, grouped by type.
+        /// The estimates are provided by each resource, so types which do not provide an
+        /// estimate will report zero bytes. This is thread-safe.
+        ///
+        /// @return The memory usage of each resource type which currently has cached
+        /// resources.
+        //------------------------------------------------------------------------------------
+        std::vector<ResourceTypeMemoryUsage> GetMemoryUsage() const;
+        //------------------------------------------------------------------------------------
         /// Called when the system is destroyed after the system lifecycle destroy.
         /// Flushes the resource caches and errors if any resources are still in use
         ///
@@ -551,13 +574,13 @@ namespace ChilliSource
     }
     //-------------------------------------------------------------------------------------
     //-------------------------------------------------------------------------------------
-    template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
+    template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate, FileTaskPriority in_priority)
     {
-        LoadResourceAsync(in_location, in_filePath, IResourceOptionsCSPtr<TResourceType>(), in_delegate);
+        LoadResourceAsync(in_location, in_filePath, IResourceOptionsCSPtr<TResourceType>(), in_delegate, in_priority);
     }
     //-------------------------------------------------------------------------------------
     //-------------------------------------------------------------------------------------
-    template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate)
+    template <typename TResourceType> void ResourcePool::LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate, FileTaskPriority in_priority)
     {
         CS_ASSERT(in_filePath.empty() == false, "Cannot load resource async with no file path");
         CS_ASSERT(in_delegate != nullptr, "Cannot load resource async with null delegate");
@@ -607,6 +630,7 @@ namespace ChilliSource
         resource->SetName(in_filePath);
         resource->SetOptions(options);
         resource->SetId(resourceId);
+        resource->SetLoadPriority(in_priority);
 
         //Add it to the cache
         desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_SCENE_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Scene/ComponentRegistry.h>
 #include <ChilliSource/Core/Scene/Scene.h>
 
 #endif
@@ -0,0 +1,110 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Scene/ComponentRegistry.h>
+
+#include <ChilliSource/Core/Entity/Component.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    void ComponentRegistry::Add(Component* component) noexcept
+    {
+        CS_ASSERT(component != nullptr, "Cannot add a null component.");
+
+        m_allComponents.Add(component);
+
+        for (auto& interfaceList : m_interfaceLists)
+        {
+            if (component->IsA(interfaceList.first))
+            {
+                interfaceList.second.Add(component);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void ComponentRegistry::Remove(Component* component) noexcept
+    {
+        CS_ASSERT(component != nullptr, "Cannot remove a null component.");
+        CS_ASSERT(m_allComponents.m_indices.count(component) != 0, "Cannot remove a component which is not in the registry.");
+
+        m_allComponents.Remove(component);
+
+        for (auto& interfaceList : m_interfaceLists)
+        {
+            interfaceList.second.Remove(component);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    const std::vector<Component*>& ComponentRegistry::GetComponents(InterfaceIDType interfaceId) noexcept
+    {
+        auto it = m_interfaceLists.find(interfaceId);
+        if (it == m_interfaceLists.end())
+        {
+            it = m_interfaceLists.emplace(interfaceId, ComponentList()).first;
+
+            for (auto component : m_allComponents.m_components)
+            {
+                if (component->IsA(interfaceId))
+                {
+                    it->second.Add(component);
+                }
+            }
+        }
+
+        return it->second.m_components;
+    }
+
+    //------------------------------------------------------------------------------
+    void ComponentRegistry::ComponentList::Add(Component* component) noexcept
+    {
+        CS_ASSERT(m_indices.count(component) == 0, "Component has already been added.");
+
+        m_indices.emplace(component, u32(m_components.size()));
+        m_components.push_back(component);
+    }
+
+    //------------------------------------------------------------------------------
+    void ComponentRegistry::ComponentList::Remove(const Component* component) noexcept
+    {
+        auto it = m_indices.find(component);
+        if (it == m_indices.end())
+        {
+            return;
+        }
+
+        u32 index = it->second;
+        m_indices.erase(it);
+
+        if (index + 1 != u32(m_components.size()))
+        {
+            m_components[index] = m_components.back();
+            m_indices[m_components[index]] = index;
+        }
+
+        m_components.pop_back();
+    }
+}
@@ -0,0 +1,111 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_SCENE_COMPONENTREGISTRY_H_
+#define _CHILLISOURCE_CORE_SCENE_COMPONENTREGISTRY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/QueryableInterface.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// Keeps lists of the components in a scene, one per queried component interface, so
+    /// that the scene can be queried for components of a given type without visiting every
+    /// entity.
+    ///
+    /// A component can implement many interfaces, and these cannot be enumerated, so the list
+    /// for an interface is built the first time it is queried by testing every component in
+    /// the scene. From then on it is kept up to date as components join and leave the scene.
+    ///
+    /// The order of components within a list is undefined.
+    ///
+    /// This is not thread-safe and should only be used on the main thread.
+    ///
+    class ComponentRegistry final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ComponentRegistry);
+
+        ComponentRegistry() = default;
+
+        /// Adds the given component to the registry. The component must not already be in
+        /// the registry.
+        ///
+        /// @param component
+        ///     The component to add.
+        ///
+        void Add(Component* component) noexcept;
+
+        /// Removes the given component from the registry.
+        ///
+        /// @param component
+        ///     The component to remove.
+        ///
+        void Remove(Component* component) noexcept;
+
+        /// @param interfaceId
+        ///     The interface to query.
+        ///
+        /// @return The list of components in the registry which implement the given
+        ///     interface. This is only valid until the registry is next changed.
+        ///
+        const std::vector<Component*>& GetComponents(InterfaceIDType interfaceId) noexcept;
+
+        /// @return The total number of components in the registry.
+        ///
+        u32 GetNumComponents() const noexcept { return u32(m_allComponents.m_components.size()); }
+
+    private:
+        /// A list of components which allows O(1) removal.
+        ///
+        struct ComponentList final
+        {
+            std::vector<Component*> m_components;
+            std::unordered_map<const Component*, u32> m_indices;
+
+            /// Adds the given component to the end of the list.
+            ///
+            /// @param component
+            ///     The component to add.
+            ///
+            void Add(Component* component) noexcept;
+
+            /// Removes the given component, if it is in the list, by swapping the last
+            /// component in to its place.
+            ///
+            /// @param component
+            ///     The component to remove.
+            ///
+            void Remove(const Component* component) noexcept;
+        };
+
+        ComponentList m_allComponents;
+        std::unordered_map<InterfaceIDType, ComponentList> m_interfaceLists;
+    };
+}
+
+#endif
@@ -28,12 +28,20 @@
 
 #include <ChilliSource/Core/Scene/Scene.h>
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Target/TargetGroup.h>
 
 #include <algorithm>
 
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr u32 k_rootEntitiesPerSnapshotBatch = 64;
+        constexpr u32 k_minThreadSafeComponentsForParallelSnapshot = 256;
+    }
+    
     CS_DEFINE_NAMEDTYPE(Scene);
     
     //-------------------------------------------------------
@@ -105,11 +113,106 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void Scene::UpdateTransforms() noexcept
+    {
+        m_transformHierarchy.Update();
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void Scene::RenderSnapshotEntities(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
     {
+        //This also ensures all world transforms are up to date, so they aren't lazily
+        //recalculated from multiple threads during the snapshot.
+        UpdateTransforms();
+        
+        u32 initialNumRebuiltRenderObjects = renderSnapshot.GetNumRebuiltRenderObjects();
+        
+        std::vector<Entity*> rootEntities;
         for(u32 i=0; i<m_entities.size(); ++i)
         {
-            m_entities[i]->OnRenderSnapshot(renderSnapshot, frameAllocator);
+            if (m_entities[i]->GetParent() == nullptr)
+            {
+                rootEntities.push_back(m_entities[i].get());
+            }
+        }
+        
+        //If there are too few entity trees to batch, every component is snapshotted in a single pass.
+        if (rootEntities.size() <= k_rootEntitiesPerSnapshotBatch)
+        {
+            for(u32 i=0; i<m_entities.size(); ++i)
+            {
+                m_entities[i]->OnRenderSnapshot(renderSnapshot, frameAllocator);
+            }
+        }
+        else
+        {
+            u32 numThreadSafeComponents = 0;
+            for(u32 i=0; i<m_entities.size(); ++i)
+            {
+                numThreadSafeComponents += m_entities[i]->OnRenderSnapshot(renderSnapshot, frameAllocator, false);
+            }
+            
+            //The parallel snapshot only pays for the tasks and bucket merging when there are enough
+            //thread safe components, otherwise they are snapshotted in place.
+            if (numThreadSafeComponents >= k_minThreadSafeComponentsForParallelSnapshot)
+            {
+                RenderSnapshotThreadSafeEntityTreesInParallel(rootEntities, renderSnapshot, frameAllocator);
+            }
+            else if (numThreadSafeComponents > 0)
+            {
+                for (auto rootEntity : rootEntities)
+                {
+                    RenderSnapshotThreadSafeEntityTree(rootEntity, renderSnapshot, frameAllocator);
+                }
+            }
+        }
+        
+        m_numRebuiltRenderObjects = renderSnapshot.GetNumRebuiltRenderObjects() - initialNumRebuiltRenderObjects;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void Scene::RenderSnapshotThreadSafeEntityTree(Entity* entity, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
+    {
+        entity->OnRenderSnapshot(renderSnapshot, frameAllocator, true);
+        
+        for (const auto& child : entity->m_children)
+        {
+            RenderSnapshotThreadSafeEntityTree(child.get(), renderSnapshot, frameAllocator);
+        }
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    void Scene::RenderSnapshotThreadSafeEntityTreesInParallel(const std::vector<Entity*>& rootEntities, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
+    {
+        u32 numBatches = (u32(rootEntities.size()) + k_rootEntitiesPerSnapshotBatch - 1) / k_rootEntitiesPerSnapshotBatch;
+        
+        std::vector<RenderSnapshot> buckets;
+        buckets.reserve(numBatches);
+        
+        std::vector<Task> tasks;
+        tasks.reserve(numBatches);
+        
+        for (u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+        {
+            buckets.push_back(renderSnapshot.CreateBucket());
+            
+            tasks.push_back([=, &rootEntities, &buckets](const TaskContext&)
+            {
+                u32 start = batchIndex * k_rootEntitiesPerSnapshotBatch;
+                u32 end = std::min(start + k_rootEntitiesPerSnapshotBatch, u32(rootEntities.size()));
+                
+                for (u32 i = start; i < end; ++i)
+                {
+                    RenderSnapshotThreadSafeEntityTree(rootEntities[i], buckets[batchIndex], frameAllocator);
+                }
+            });
+        }
+        
+        Application::Get()->GetTaskScheduler()->ScheduleTasksAndYield(TaskType::k_small, tasks);
+        
+        for (auto& bucket : buckets)
+        {
+            renderSnapshot.MergeBucket(std::move(bucket));
         }
     }
     //-------------------------------------------------------
@@ -147,6 +250,11 @@ namespace ChilliSource
                   + ToString(std::numeric_limits<u32>::max()) + ".");
         
         m_entities.push_back(in_entity);
+        m_transformHierarchy.Add(&in_entity->GetTransform());
+        for (const auto& component : in_entity->GetComponents())
+        {
+            RegisterComponent(component.get());
+        }
 
         in_entity->SetScene(this);
         in_entity->OnAddedToScene();
@@ -181,6 +289,11 @@ namespace ChilliSource
                 
                 ent->OnRemovedFromScene();
                 ent->SetScene(nullptr);
+                m_transformHierarchy.Remove(&ent->GetTransform());
+                for (const auto& component : ent->GetComponents())
+                {
+                    DeregisterComponent(component.get());
+                }
             }
         }
         
@@ -225,24 +338,34 @@ namespace ChilliSource
     //--------------------------------------------------------------------------------------------------
     void Scene::QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents)
     {
-        std::vector<VolumeComponent*> intersectableComponents;
-        QuerySceneForComponents(intersectableComponents);
+        //Volume components rely on transform changed events to invalidate their bounds.
+        UpdateTransforms();
         
-        //Loop through the render components and check for intersection
-        //If any intersect then add them to the intersect list
-        for(std::vector<VolumeComponent*>::iterator it = intersectableComponents.begin(); it != intersectableComponents.end(); ++it)
-        {
-            VolumeComponent* component = (*it);
-            
-            f32 nearIntersection, farIntersection = 0.0f;
-            
-            if(component->GetOOBB().Contains(in_ray, nearIntersection, farIntersection))
-            {
-                //We use this to sort by
-                component->mfQueryIntersectionValue = nearIntersection;
-                out_volumeComponents.push_back(component);
-            }
-        }
+        m_volumeHierarchy.RaycastAll(in_ray, out_volumeComponents);
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    VolumeComponent* Scene::QuerySceneForNearestIntersection(const Ray& in_ray) noexcept
+    {
+        UpdateTransforms();
+        
+        return m_volumeHierarchy.RaycastNearest(in_ray);
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::QuerySceneForOverlaps(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumeComponents) noexcept
+    {
+        UpdateTransforms();
+        
+        m_volumeHierarchy.QueryOverlaps(in_sphere, out_volumeComponents);
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::QuerySceneForOverlaps(const AABB& in_aabb, std::vector<VolumeComponent*>& out_volumeComponents) noexcept
+    {
+        UpdateTransforms();
+        
+        m_volumeHierarchy.QueryOverlaps(in_aabb, out_volumeComponents);
     }
     //--------------------------------------------------------------------------------------------------
     //--------------------------------------------------------------------------------------------------
@@ -272,6 +395,11 @@ namespace ChilliSource
             
             in_entity->OnRemovedFromScene();
             in_entity->SetScene(nullptr);
+            m_transformHierarchy.Remove(&in_entity->GetTransform());
+            for (const auto& component : in_entity->GetComponents())
+            {
+                DeregisterComponent(component.get());
+            }
             
             //the iterator may have been invalidated during OnBackground, OnSuspend or OnRemovedFromScene, so re-calculate it
             it = std::find_if(m_entities.begin(), m_entities.end(), searchPredicate);
@@ -282,6 +410,28 @@ namespace ChilliSource
     }
     //--------------------------------------------------------------------------------------------------
     //--------------------------------------------------------------------------------------------------
+    void Scene::RegisterComponent(Component* component) noexcept
+    {
+        m_componentRegistry.Add(component);
+        
+        if (component->IsA(VolumeComponent::InterfaceID))
+        {
+            m_volumeHierarchy.Add(static_cast<VolumeComponent*>(component));
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void Scene::DeregisterComponent(Component* component) noexcept
+    {
+        m_componentRegistry.Remove(component);
+        
+        if (component->IsA(VolumeComponent::InterfaceID))
+        {
+            m_volumeHierarchy.Remove(static_cast<VolumeComponent*>(component));
+        }
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
     void Scene::OnDestroy() noexcept
     {
         m_renderTarget.reset();
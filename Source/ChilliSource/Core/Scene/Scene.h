@@ -32,8 +32,11 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+#include <ChilliSource/Core/Scene/ComponentRegistry.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
 #include <ChilliSource/Core/System/StateSystem.h>
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 #include <ChilliSource/Rendering/Target/TargetGroup.h>
 
@@ -149,6 +152,12 @@ namespace ChilliSource
         /// @return The render target, if nullptr then renders to screen
         //------------------------------------------------------
         TargetGroup* GetRenderTarget() const noexcept { return m_renderTarget.get(); }
+        //------------------------------------------------------
+        /// @return The number of render objects which had to be
+        /// rebuilt, rather than retained from a previous frame,
+        /// during the last render snapshot of the scene.
+        //------------------------------------------------------
+        u32 GetNumRebuiltRenderObjects() const noexcept { return m_numRebuiltRenderObjects; }
         //-------------------------------------------------------
         /// Sends the resume event on to the entities.
         ///
@@ -178,8 +187,21 @@ namespace ChilliSource
         //-------------------------------------------------------
         void FixedUpdateEntities(f32 in_timeSinceLastUpdate);
         //-------------------------------------------------------
+        /// Recalculates the world transforms of all entities in
+        /// the scene which have changed, and sends their transform
+        /// changed events. This is called automatically prior to
+        /// taking the render snapshot each frame, and before
+        /// querying the scene for intersections, but can be called
+        /// manually if transform changed events are needed sooner.
+        //-------------------------------------------------------
+        void UpdateTransforms() noexcept;
+        //-------------------------------------------------------
         /// Sends the render snapshot event to all entities in
-        /// the scene.
+        /// the scene. Components which are not render snapshot
+        /// thread safe are snapshotted on the calling thread in
+        /// entity order; the remainder are then snapshotted in
+        /// parallel, one batch of entity trees per task, into
+        /// separate buckets which are merged in order.
         ///
         /// @author Ian Copland
         ///
@@ -217,8 +239,9 @@ namespace ChilliSource
         void Render(TargetGroup* target = nullptr) noexcept;
         
         //--------------------------------------------------------------------------------------------------
-        /// Traverses the contents of the scene and adds any objects that intersect with the ray to the
-        /// list. The list order is undefined. Use the query intersection value on the volume component
+        /// Adds any volume components in the scene that intersect with the ray to the list. The scene
+        /// keeps a bounding volume hierarchy over the volume components, so only those near the ray are
+        /// tested. The list order is undefined. Use the query intersection value on the volume component
         /// to sort by depth
         ///
         /// @author S Downie
@@ -228,52 +251,75 @@ namespace ChilliSource
         //--------------------------------------------------------------------------------------------------
         void QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents);
         //--------------------------------------------------------------------------------------------------
-        /// Traverse the scene for the given component type and fill the list with those components
+        /// Finds the volume component in the scene with the nearest intersection with the ray.
+        ///
+        /// @param in_ray - The ray to check intersection with.
+        ///
+        /// @return The nearest intersecting volume component, or null if there isn't one. Its query
+        /// intersection value is set to the distance of the intersection along the ray.
+        //--------------------------------------------------------------------------------------------------
+        VolumeComponent* QuerySceneForNearestIntersection(const Ray& in_ray) noexcept;
+        //--------------------------------------------------------------------------------------------------
+        /// Adds any volume components in the scene whose AABB overlaps the sphere to the list. The
+        /// list order is undefined.
+        ///
+        /// @param in_sphere - The sphere to check overlap with.
+        /// @param out_volumeComponents - [Out] Container to fill with overlapping components.
+        //--------------------------------------------------------------------------------------------------
+        void QuerySceneForOverlaps(const Sphere& in_sphere, std::vector<VolumeComponent*>& out_volumeComponents) noexcept;
+        //--------------------------------------------------------------------------------------------------
+        /// Adds any volume components in the scene whose AABB overlaps the given AABB to the list. The
+        /// list order is undefined.
+        ///
+        /// @param in_aabb - The AABB to check overlap with.
+        /// @param out_volumeComponents - [Out] Container to fill with overlapping components.
+        //--------------------------------------------------------------------------------------------------
+        void QuerySceneForOverlaps(const AABB& in_aabb, std::vector<VolumeComponent*>& out_volumeComponents) noexcept;
+        //--------------------------------------------------------------------------------------------------
+        /// Fills the list with all components in the scene of the given type. This does not visit the
+        /// entities in the scene; the scene keeps a list of components for each queried type. The
+        /// order of the components is undefined.
         ///
         /// @author S Downie
         ///
-        /// @param [Out] Empty container to be filled
+        /// @param [Out] Container to be filled
         //--------------------------------------------------------------------------------------------------
         template <typename TComponentType>
         void QuerySceneForComponents(std::vector<TComponentType*>& out_components)
         {
-            for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-            {
-                (*it)->GetComponents<TComponentType>(out_components);
-            }
+            AppendComponents(m_componentRegistry.GetComponents(TComponentType::InterfaceID), out_components);
         }
         //--------------------------------------------------------------------------------------------------
-        /// Traverse the scene for the given component types and fill the lists with those components
-        //
+        /// Fills the lists with all components in the scene of the given types. The order of the
+        /// components is undefined.
+        ///
         /// @author S Downie
         ///
-        /// @param [Out] Empty container to be filled with T1
-        /// @param [Out] Empty container to be filled with T2
+        /// @param [Out] Container to be filled with T1
+        /// @param [Out] Container to be filled with T2
         //--------------------------------------------------------------------------------------------------
         template <typename TComponentType1, typename TComponentType2>
         void QuerySceneForComponents(std::vector<TComponentType1*>& out_components1, std::vector<TComponentType2*>& out_components2)
         {
-            for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-            {
-                (*it)->GetComponents<TComponentType1, TComponentType2>(out_components1, out_components2);
-            }
+            QuerySceneForComponents(out_components1);
+            QuerySceneForComponents(out_components2);
         }
         //--------------------------------------------------------------------------------------------------
-        /// Traverse the scene for the given component types and fill the lists with those components
+        /// Fills the lists with all components in the scene of the given types. The order of the
+        /// components is undefined.
         ///
         /// @author S Downie
         ///
-        /// @param [Out] Empty container to be filled with T1
-        /// @param [Out] Empty container to be filled with T2
-        /// @param [Out] Empty container to be filled with T3
+        /// @param [Out] Container to be filled with T1
+        /// @param [Out] Container to be filled with T2
+        /// @param [Out] Container to be filled with T3
         //--------------------------------------------------------------------------------------------------
         template <typename TComponentType1, typename TComponentType2, typename TComponentType3>
         void QuerySceneForComponents(std::vector<TComponentType1*>& out_components1, std::vector<TComponentType2*>& out_components2, std::vector<TComponentType3*>& out_components3)
         {
-            for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-            {
-                (*it)->GetComponents<TComponentType1, TComponentType2, TComponentType3>(out_components1, out_components2, out_components3);
-            }
+            QuerySceneForComponents(out_components1);
+            QuerySceneForComponents(out_components2);
+            QuerySceneForComponents(out_components3);
         }
         
     private:
@@ -296,6 +342,62 @@ namespace ChilliSource
         /// @param Entity
         //-------------------------------------------------------
         void Remove(Entity* inpEntity);
+        //-------------------------------------------------------
+        /// Adds the given component to the lists the scene keeps
+        /// for queries. Called when the component's entity is
+        /// added to the scene, or the component is added to an
+        /// entity already in the scene.
+        ///
+        /// @param component - The component.
+        //-------------------------------------------------------
+        void RegisterComponent(Component* component) noexcept;
+        //-------------------------------------------------------
+        /// Removes the given component from the lists the scene
+        /// keeps for queries.
+        ///
+        /// @param component - The component.
+        //-------------------------------------------------------
+        void DeregisterComponent(Component* component) noexcept;
+        //-------------------------------------------------------
+        /// Sends the render snapshot event to the thread safe
+        /// components of the given entity and all of its
+        /// descendants.
+        ///
+        /// @param entity - The root of the entity tree.
+        /// @param renderSnapshot - The render snapshot object
+        /// which contains all snapshotted data.
+        /// @param frameAllocator - The frame allocator.
+        //-------------------------------------------------------
+        static void RenderSnapshotThreadSafeEntityTree(Entity* entity, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept;
+        //-------------------------------------------------------
+        /// Sends the render snapshot event to the thread safe
+        /// components of the given entity trees, snapshotting
+        /// batches of trees on the small task pool and merging
+        /// the results back in order.
+        ///
+        /// @param rootEntities - The roots of the entity trees.
+        /// @param renderSnapshot - The render snapshot object
+        /// which contains all snapshotted data.
+        /// @param frameAllocator - The frame allocator.
+        //-------------------------------------------------------
+        static void RenderSnapshotThreadSafeEntityTreesInParallel(const std::vector<Entity*>& rootEntities, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept;
+        //-------------------------------------------------------
+        /// Appends the given components to the given list, cast
+        /// to the list's component type.
+        ///
+        /// @param in_components - The components, which must all
+        /// be of the given type.
+        /// @param out_components - [Out] The list to append to.
+        //-------------------------------------------------------
+        template <typename TComponentType>
+        static void AppendComponents(const std::vector<Component*>& in_components, std::vector<TComponentType*>& out_components)
+        {
+            out_components.reserve(out_components.size() + in_components.size());
+            for (auto component : in_components)
+            {
+                out_components.push_back(static_cast<TComponentType*>(component));
+            }
+        }
         
         //------------------------------------------------
         /// Called when the owning state is being destroyed.
@@ -307,6 +409,9 @@ namespace ChilliSource
         
     private:
         
+        TransformHierarchy m_transformHierarchy;
+        ComponentRegistry m_componentRegistry;
+        BoundingVolumeHierarchy m_volumeHierarchy;
         SharedEntityList m_entities;
         Colour m_clearColour;
         bool m_entitiesActive = false;
@@ -314,6 +419,7 @@ namespace ChilliSource
         bool m_enabled = true;
         CameraComponent* m_activeCameraComponent = nullptr;
         TargetGroupUPtr m_renderTarget;
+        u32 m_numRebuiltRenderObjects = 0;
     };		
 }
 
@@ -30,10 +30,15 @@
 #define _CHILLISOURCE_CORE_THREADING_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/FileTaskPriority.h>
+#include <ChilliSource/Core/Threading/FileTaskQueue.h>
 #include <ChilliSource/Core/Threading/SingleThreadTaskPool.h>
 #include <ChilliSource/Core/Threading/Task.h>
 #include <ChilliSource/Core/Threading/TaskContext.h>
+#include <ChilliSource/Core/Threading/TaskGraph.h>
+#include <ChilliSource/Core/Threading/TaskGroup.h>
 #include <ChilliSource/Core/Threading/TaskPool.h>
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 
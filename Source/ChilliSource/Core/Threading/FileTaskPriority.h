@@ -0,0 +1,56 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_FILETASKPRIORITY_H_
+#define _CHILLISOURCE_CORE_THREADING_FILETASKPRIORITY_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    /// The priority of a file task. Queued file tasks are always started in priority
+    /// order, so lower priority tasks will not start while higher priority tasks are
+    /// waiting. Within a priority the most recently scheduled tasks are started first,
+    /// as file tasks always have been, while tasks scheduled together keep their order.
+    ///
+    /// Immediate: The result is needed as soon as possible, typically within the
+    /// next few frames. File tasks scheduled with a task type rather than an explicit
+    /// priority use this.
+    ///
+    /// Prefetch: The result will be needed soon, for example assets for the next
+    /// screen or level.
+    ///
+    /// Background: The result is not needed for the foreseeable future, for example
+    /// populating a cache or writing save data.
+    ///
+    enum class FileTaskPriority
+    {
+        k_immediate,
+        k_prefetch,
+        k_background
+    };
+}
+
+#endif
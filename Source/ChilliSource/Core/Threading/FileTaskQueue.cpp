@@ -0,0 +1,200 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Threading/FileTaskQueue.h>
+
+#include <ChilliSource/Core/Threading/TaskContext.h>
+#include <ChilliSource/Core/Threading/TaskPool.h>
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
+#include <ChilliSource/Core/Threading/TaskType.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+    constexpr u32 FileTaskQueue::k_numPriorities;
+
+    //------------------------------------------------------------------------------
+    FileTaskQueue::FileTaskQueue(TaskPool* taskPool, u32 maxConcurrentTasks) noexcept
+        : m_taskPool(taskPool), m_maxConcurrentTasks(maxConcurrentTasks)
+    {
+        CS_ASSERT(m_taskPool, "File task queue must have a task pool.");
+        CS_ASSERT(m_maxConcurrentTasks > 0, "File task queue must allow at least one concurrent task.");
+    }
+
+    //------------------------------------------------------------------------------
+    u32 FileTaskQueue::GetMaxConcurrentTasks() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_maxConcurrentTasks;
+    }
+
+    //------------------------------------------------------------------------------
+    void FileTaskQueue::SetMaxConcurrentTasks(u32 maxConcurrentTasks) noexcept
+    {
+        CS_ASSERT(maxConcurrentTasks > 0, "File task queue must allow at least one concurrent task.");
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_maxConcurrentTasks = maxConcurrentTasks;
+        StartProcessing(lock);
+    }
+
+    //------------------------------------------------------------------------------
+    FileTaskQueue::TaskId FileTaskQueue::AddTask(FileTaskPriority priority, const Task& task) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        TaskId taskId = m_nextTaskId++;
+        m_queues[u32(priority)].push_front(QueuedTask { taskId, task });
+        ++m_numQueuedTasks;
+
+        StartProcessing(lock);
+        return taskId;
+    }
+
+    //------------------------------------------------------------------------------
+    void FileTaskQueue::AddTasks(FileTaskPriority priority, const std::vector<Task>& tasks) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        std::vector<QueuedTask> queuedTasks;
+        queuedTasks.reserve(tasks.size());
+        for (const auto& task : tasks)
+        {
+            queuedTasks.push_back(QueuedTask { m_nextTaskId++, task });
+        }
+
+        auto& queue = m_queues[u32(priority)];
+        queue.insert(queue.begin(), queuedTasks.begin(), queuedTasks.end());
+        m_numQueuedTasks += u32(queuedTasks.size());
+
+        StartProcessing(lock);
+    }
+
+    //------------------------------------------------------------------------------
+    bool FileTaskQueue::CancelTask(TaskId taskId) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (auto& queue : m_queues)
+        {
+            auto it = std::find_if(queue.begin(), queue.end(), [=](const QueuedTask& queuedTask)
+            {
+                return queuedTask.m_id == taskId;
+            });
+
+            if (it != queue.end())
+            {
+                queue.erase(it);
+                --m_numQueuedTasks;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    u32 FileTaskQueue::GetNumQueuedTasks() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_numQueuedTasks;
+    }
+
+    //------------------------------------------------------------------------------
+    void FileTaskQueue::Shutdown() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        for (auto& queue : m_queues)
+        {
+            queue.clear();
+        }
+
+        m_numQueuedTasks = 0;
+        m_isShutdown = true;
+    }
+
+    //------------------------------------------------------------------------------
+    void FileTaskQueue::StartProcessing(std::unique_lock<std::mutex>& lock) noexcept
+    {
+        u32 numToStart = 0;
+        if (!m_isShutdown && m_numRunningTasks < m_maxConcurrentTasks && m_numQueuedTasks > 0)
+        {
+            // Running processing tasks will take queued tasks before finishing, so only
+            // start enough to cover the queued tasks they cannot pick up in parallel.
+            numToStart = std::min(m_maxConcurrentTasks - m_numRunningTasks, m_numQueuedTasks);
+            m_numRunningTasks += numToStart;
+        }
+
+        lock.unlock();
+
+        if (numToStart > 0)
+        {
+            std::vector<Task> processingTasks(numToStart, [this](const TaskContext&) noexcept
+            {
+                ProcessTasks();
+            });
+
+            m_taskPool->AddTasks(processingTasks);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    bool FileTaskQueue::TryTakeNextTask(Task& out_task) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if (!m_isShutdown && m_numQueuedTasks > 0 && m_numRunningTasks <= m_maxConcurrentTasks)
+        {
+            for (auto& queue : m_queues)
+            {
+                if (!queue.empty())
+                {
+                    out_task = std::move(queue.front().m_task);
+                    queue.pop_front();
+                    --m_numQueuedTasks;
+                    return true;
+                }
+            }
+        }
+
+        --m_numRunningTasks;
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    void FileTaskQueue::ProcessTasks() noexcept
+    {
+        TaskContext taskContext(TaskType::k_file);
+
+        Task task;
+        while (TryTakeNextTask(task))
+        {
+            TaskProfiler::ScopedEvent profilerEvent(m_taskPool->GetProfiler(), TaskType::k_file);
+            task(taskContext);
+        }
+    }
+}
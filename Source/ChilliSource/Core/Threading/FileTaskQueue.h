@@ -0,0 +1,179 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_FILETASKQUEUE_H_
+#define _CHILLISOURCE_CORE_THREADING_FILETASKQUEUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/FileTaskPriority.h>
+#include <ChilliSource/Core/Threading/Task.h>
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A prioritised queue of file tasks which are processed on a task pool with a
+    /// limited number of tasks in flight at once. This allows small file loads to
+    /// proceed alongside large ones, while still preventing file I/O from occupying
+    /// every thread in the pool.
+    ///
+    /// Each processing task started on the pool performs queued file tasks until the
+    /// queue is empty, so a task pool task is only added when the number of tasks in
+    /// flight increases. Tasks which have not yet started can be cancelled.
+    ///
+    /// Within a priority, tasks are inserted at the front of the queue, so the most
+    /// recently added tasks are performed first. Tasks added together in a single call
+    /// to AddTasks() keep their relative order.
+    ///
+    /// This is thread-safe.
+    ///
+    class FileTaskQueue final
+    {
+    public:
+        CS_DECLARE_NOCOPY(FileTaskQueue);
+
+        /// Identifies a single scheduled file task. Zero is never used as an id.
+        ///
+        using TaskId = u64;
+
+        /// Creates a new queue which performs its tasks on the given pool.
+        ///
+        /// @param taskPool
+        ///     The task pool which file tasks will be performed on. This must outlive
+        ///     the queue, and Shutdown() must be called before the pool is destroyed.
+        /// @param maxConcurrentTasks
+        ///     The maximum number of file tasks which can be performed at once. Must
+        ///     be at least one.
+        ///
+        FileTaskQueue(TaskPool* taskPool, u32 maxConcurrentTasks) noexcept;
+
+        /// @return The maximum number of file tasks which can be performed at once.
+        ///
+        u32 GetMaxConcurrentTasks() const noexcept;
+
+        /// Sets the maximum number of file tasks which can be performed at once. If this
+        /// is reduced, tasks which are already running will complete but no new tasks will
+        /// be started until the number in flight drops below the new limit.
+        ///
+        /// @param maxConcurrentTasks
+        ///     The maximum number of file tasks which can be performed at once. Must be at
+        ///     least one.
+        ///
+        void SetMaxConcurrentTasks(u32 maxConcurrentTasks) noexcept;
+
+        /// Adds a task to the queue. The task will be provided with a file task context.
+        ///
+        /// @param priority
+        ///     The priority of the task.
+        /// @param task
+        ///     The task to perform.
+        ///
+        /// @return The id of the task, which can be used to cancel it.
+        ///
+        TaskId AddTask(FileTaskPriority priority, const Task& task) noexcept;
+        
+        /// Adds a batch of tasks to the queue. The tasks are performed in the order given,
+        /// ahead of any tasks already queued with the same priority.
+        ///
+        /// @param priority
+        ///     The priority of the tasks.
+        /// @param tasks
+        ///     The tasks to perform.
+        ///
+        void AddTasks(FileTaskPriority priority, const std::vector<Task>& tasks) noexcept;
+
+        /// Cancels a task which has not yet started. A task which is running or has already
+        /// completed cannot be cancelled.
+        ///
+        /// @param taskId
+        ///     The id of the task to cancel.
+        ///
+        /// @return Whether or not the task was cancelled. If true, the task will never be
+        ///     performed.
+        ///
+        bool CancelTask(TaskId taskId) noexcept;
+
+        /// @return The number of tasks which have been queued but not yet started.
+        ///
+        u32 GetNumQueuedTasks() const noexcept;
+        
+        /// Cancels all queued tasks and stops any more from being started. Tasks which are
+        /// already running will complete, but anything they add to the queue is never
+        /// performed. This must be called before the task pool is destroyed, so that the
+        /// pool isn't given new processing tasks while it is joining its threads.
+        ///
+        void Shutdown() noexcept;
+
+    private:
+        static constexpr u32 k_numPriorities = u32(FileTaskPriority::k_background) + 1;
+
+        /// A task which has been queued, along with its id.
+        ///
+        struct QueuedTask final
+        {
+            TaskId m_id;
+            Task m_task;
+        };
+
+        /// Adds a processing task to the pool for each additional task which can now be
+        /// performed, unless the queue has been shut down. Must be called with the mutex
+        /// locked, which will be unlocked on return.
+        ///
+        /// @param lock
+        ///     The lock on the mutex.
+        ///
+        void StartProcessing(std::unique_lock<std::mutex>& lock) noexcept;
+
+        /// Takes the highest priority queued task, if the number of tasks in flight is
+        /// within the limit. If not, the calling processing task is considered finished.
+        ///
+        /// @param out_task
+        ///     (Out) The task which should be performed next.
+        ///
+        /// @return Whether or not a task was taken.
+        ///
+        bool TryTakeNextTask(Task& out_task) noexcept;
+
+        /// Performs queued tasks until there are none left or the number in flight is
+        /// over the limit.
+        ///
+        void ProcessTasks() noexcept;
+
+        TaskPool* m_taskPool;
+
+        mutable std::mutex m_mutex;
+        std::array<std::deque<QueuedTask>, k_numPriorities> m_queues;
+        u32 m_numQueuedTasks = 0;
+        u32 m_numRunningTasks = 0;
+        u32 m_maxConcurrentTasks;
+        TaskId m_nextTaskId = 1;
+        bool m_isShutdown = false;
+    };
+}
+
+#endif
@@ -29,14 +29,15 @@
 #include <ChilliSource/Core/Threading/SingleThreadTaskPool.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    SingleThreadTaskPool::SingleThreadTaskPool(TaskType in_taskContext)
-        : m_taskContext(in_taskContext)
+    SingleThreadTaskPool::SingleThreadTaskPool(TaskType in_taskContext, TaskProfiler* in_profiler)
+        : m_taskContext(in_taskContext), m_profiler(in_profiler)
     {
     }
     //------------------------------------------------------------------------------
@@ -55,8 +56,14 @@ namespace ChilliSource
         m_taskQueue.clear();
         lock.unlock();
 
+        if (m_profiler && m_profiler->IsEnabled())
+        {
+            m_profiler->SetCurrentThreadName(m_taskContext.GetType() == TaskType::k_mainThread ? "Main Thread" : "System Thread");
+        }
+
         for (const auto& task : localTaskQueue)
         {
+            TaskProfiler::ScopedEvent profilerEvent(m_profiler, m_taskContext.GetType());
             task(m_taskContext);
         }
     }
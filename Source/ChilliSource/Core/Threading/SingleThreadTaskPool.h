@@ -56,7 +56,7 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
-        SingleThreadTaskPool(TaskType in_taskContext);
+        SingleThreadTaskPool(TaskType in_taskContext, TaskProfiler* in_profiler = nullptr);
         //------------------------------------------------------------------------------
         /// Adds a series of tasks to the pool. The tasks will be executed when 
         /// PerformTasks() is called.
@@ -79,6 +79,7 @@ namespace ChilliSource
         void PerformTasks() noexcept;
         
         const TaskContext m_taskContext;
+        TaskProfiler* const m_profiler;
         
         std::vector<Task> m_taskQueue;
         std::mutex m_taskQueueMutex;
@@ -29,11 +29,21 @@
 #include <ChilliSource/Core/Threading/TaskContext.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Threading/TaskGraph.h>
+#include <ChilliSource/Core/Threading/TaskPool.h>
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        constexpr u32 k_parallelChunksPerThread = 4;
+    }
+    
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     TaskContext::TaskContext(TaskType in_taskType, TaskPool* in_taskPool) noexcept
@@ -59,6 +69,8 @@ namespace ChilliSource
     void TaskContext::ProcessChildTasks(const std::vector<Task>& in_tasks) const noexcept
     {
 		CS_ASSERT(in_tasks.size() > 0, "No tasks provided to run.");
+        TaskProfiler::ScopedEvent profilerEvent(m_taskPool ? m_taskPool->GetProfiler() : nullptr, m_taskType, "Process Child Tasks");
+        
         if (m_taskType == TaskType::k_mainThread || m_taskType == TaskType::k_system || m_taskType == TaskType::k_file)
         {
             for (const auto& task : in_tasks)
@@ -68,20 +80,41 @@ namespace ChilliSource
         }
         else if (m_taskType == TaskType::k_gameLogic)
         {
-            std::vector<Task> gameLogicTasks;
-            for (const auto& task : in_tasks)
-            {
-                gameLogicTasks.push_back([=](const TaskContext&)
-                {
-                    task(*this);
-                });
-            }
-            
-            m_taskPool->AddTasksAndYield(gameLogicTasks);
+            m_taskPool->AddTasksAndYield(in_tasks, *this);
         }
         else
         {
             m_taskPool->AddTasksAndYield(in_tasks);
         }
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskContext::ProcessTaskGraph(const TaskGraph& in_taskGraph) const noexcept
+    {
+        TaskProfiler::ScopedEvent profilerEvent(m_taskPool ? m_taskPool->GetProfiler() : nullptr, m_taskType, "Process Task Graph");
+        
+        if (m_taskType == TaskType::k_mainThread || m_taskType == TaskType::k_system || m_taskType == TaskType::k_file)
+        {
+            in_taskGraph.Process(*this, nullptr);
+        }
+        else
+        {
+            in_taskGraph.Process(*this, m_taskPool);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 TaskContext::CalcParallelChunkSize(u32 in_count, u32 in_grainSize) const noexcept
+    {
+        if (m_taskPool == nullptr)
+        {
+            return in_count;
+        }
+        
+        // The thread which yields on the chunks will also process them, so is included.
+        u32 targetNumChunks = (m_taskPool->GetNumThreads() + 1) * k_parallelChunksPerThread;
+        u32 chunkSize = (in_count + targetNumChunks - 1) / targetNumChunks;
+        
+        return std::max(chunkSize, std::max(in_grainSize, 1u));
+    }
 }
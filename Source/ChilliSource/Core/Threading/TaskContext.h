@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Threading/Task.h>
 
+#include <utility>
 #include <vector>
 
 namespace ChilliSource
@@ -73,10 +74,134 @@ namespace ChilliSource
         /// @param in_tasks - The tasks to be processed.
         //------------------------------------------------------------------------------
         void ProcessChildTasks(const std::vector<Task>& in_tasks) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Processes the nodes of the given task graph as child tasks, each starting as
+        /// soon as the nodes it depends on have completed, and yields until all nodes
+        /// have completed. The nodes are provided with a task context of the same type
+        /// as this.
+        ///
+        /// @param in_taskGraph - The task graph to process.
+        //------------------------------------------------------------------------------
+        void ProcessTaskGraph(const TaskGraph& in_taskGraph) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Splits the range [0, in_count) into contiguous chunks and processes each
+        /// chunk as a child task, yielding until all have completed. The number of
+        /// chunks adapts to the number of threads in the task pool, and no chunk will
+        /// contain fewer than in_grainSize elements unless the range itself is smaller.
+        /// If only a single chunk is needed it is processed directly on the calling
+        /// thread.
+        ///
+        /// @param in_count - The number of elements in the range.
+        /// @param in_grainSize - The minimum number of elements worth processing in a
+        /// single chunk.
+        /// @param in_function - The function which processes a chunk. It should have
+        /// the signature void(const TaskContext&, u32 in_start, u32 in_end), where the
+        /// chunk is the range [in_start, in_end).
+        //------------------------------------------------------------------------------
+        template <typename TFunction> void ParallelFor(u32 in_count, u32 in_grainSize, const TFunction& in_function) const noexcept;
+        //------------------------------------------------------------------------------
+        /// Splits the range [0, in_count) into chunks in the same way as ParallelFor(),
+        /// each of which is processed into its own accumulator. The accumulators are
+        /// then combined in range order, so the result is deterministic as long as the
+        /// chunk function is.
+        ///
+        /// @param in_count - The number of elements in the range.
+        /// @param in_grainSize - The minimum number of elements worth processing in a
+        /// single chunk.
+        /// @param in_identity - The initial value of the result and each accumulator.
+        /// @param in_function - The function which processes a chunk. It should have
+        /// the signature void(const TaskContext&, u32 in_start, u32 in_end,
+        /// TAccumulator& inout_accumulator).
+        /// @param in_combineFunction - The function which combines an accumulator into
+        /// the result. It should have the signature void(TAccumulator& inout_result,
+        /// TAccumulator&& in_accumulator).
+        ///
+        /// @return The combined result.
+        //------------------------------------------------------------------------------
+        template <typename TAccumulator, typename TFunction, typename TCombineFunction>
+        TAccumulator ParallelReduce(u32 in_count, u32 in_grainSize, const TAccumulator& in_identity, const TFunction& in_function, const TCombineFunction& in_combineFunction) const noexcept;
+        
+    private:
+        //------------------------------------------------------------------------------
+        /// Calculates the size of the chunks the given range should be split into for
+        /// ParallelFor() and ParallelReduce(). This aims for a few chunks per thread so
+        /// that work can be balanced by stealing, without creating needlessly small
+        /// tasks.
+        ///
+        /// @param in_count - The number of elements in the range.
+        /// @param in_grainSize - The minimum number of elements worth processing in a
+        /// single chunk.
+        ///
+        /// @return The number of elements per chunk.
+        //------------------------------------------------------------------------------
+        u32 CalcParallelChunkSize(u32 in_count, u32 in_grainSize) const noexcept;
         
         TaskType m_taskType;
         TaskPool* m_taskPool = nullptr;
     };
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TFunction> void TaskContext::ParallelFor(u32 in_count, u32 in_grainSize, const TFunction& in_function) const noexcept
+    {
+        if (in_count == 0)
+        {
+            return;
+        }
+        
+        u32 chunkSize = CalcParallelChunkSize(in_count, in_grainSize);
+        if (chunkSize >= in_count)
+        {
+            in_function(*this, 0, in_count);
+            return;
+        }
+        
+        std::vector<Task> tasks;
+        tasks.reserve((in_count + chunkSize - 1) / chunkSize);
+        for (u32 start = 0; start < in_count; start += chunkSize)
+        {
+            // Only a reference and two indices are captured so that the task can be
+            // stored without allocating.
+            u32 end = (in_count - start > chunkSize) ? start + chunkSize : in_count;
+            tasks.push_back([&in_function, start, end](const TaskContext& in_taskContext) noexcept
+            {
+                in_function(in_taskContext, start, end);
+            });
+        }
+        
+        ProcessChildTasks(tasks);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TAccumulator, typename TFunction, typename TCombineFunction>
+    TAccumulator TaskContext::ParallelReduce(u32 in_count, u32 in_grainSize, const TAccumulator& in_identity, const TFunction& in_function, const TCombineFunction& in_combineFunction) const noexcept
+    {
+        TAccumulator result(in_identity);
+        if (in_count == 0)
+        {
+            return result;
+        }
+        
+        u32 chunkSize = CalcParallelChunkSize(in_count, in_grainSize);
+        if (chunkSize >= in_count)
+        {
+            in_function(*this, 0, in_count, result);
+            return result;
+        }
+        
+        std::vector<TAccumulator> accumulators((in_count + chunkSize - 1) / chunkSize, in_identity);
+        
+        ParallelFor(in_count, in_grainSize, [&](const TaskContext& in_taskContext, u32 in_start, u32 in_end)
+        {
+            in_function(in_taskContext, in_start, in_end, accumulators[in_start / chunkSize]);
+        });
+        
+        for (auto& accumulator : accumulators)
+        {
+            in_combineFunction(result, std::move(accumulator));
+        }
+        
+        return result;
+    }
 }
 
 #endif
@@ -0,0 +1,204 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Threading/TaskGraph.h>
+
+#include <ChilliSource/Core/Threading/TaskGroup.h>
+#include <ChilliSource/Core/Threading/TaskPool.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        /// @param name
+        ///     The name to escape.
+        ///
+        /// @return The name with any characters which would break a DOT string escaped.
+        ///
+        std::string EscapeDotString(const std::string& name) noexcept
+        {
+            std::string output;
+            output.reserve(name.size());
+
+            for (auto character : name)
+            {
+                if (character == '"' || character == '\\')
+                {
+                    output.push_back('\\');
+                }
+                output.push_back(character);
+            }
+
+            return output;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    u32 TaskGraph::AddNode(const std::string& name, const Task& task) noexcept
+    {
+        Node node;
+        node.m_name = name;
+        node.m_task = task;
+        m_nodes.push_back(std::move(node));
+
+        return u32(m_nodes.size() - 1);
+    }
+
+    //------------------------------------------------------------------------------
+    void TaskGraph::AddDependency(u32 node, u32 dependency) noexcept
+    {
+        CS_ASSERT(node < m_nodes.size(), "Invalid node index.");
+        CS_ASSERT(dependency < node, "Nodes must be added after the nodes they depend on.");
+
+        m_nodes[dependency].m_dependents.push_back(node);
+        ++m_nodes[node].m_numDependencies;
+    }
+
+    //------------------------------------------------------------------------------
+    std::string TaskGraph::ToDot() const noexcept
+    {
+        std::ostringstream stream;
+        stream << "digraph TaskGraph\n{\n";
+
+        for (u32 i = 0; i < u32(m_nodes.size()); ++i)
+        {
+            stream << "    n" << i << " [label=\"" << EscapeDotString(m_nodes[i].m_name) << "\"];\n";
+        }
+
+        for (u32 i = 0; i < u32(m_nodes.size()); ++i)
+        {
+            for (auto dependent : m_nodes[i].m_dependents)
+            {
+                stream << "    n" << i << " -> n" << dependent << ";\n";
+            }
+        }
+
+        stream << "}\n";
+        return stream.str();
+    }
+
+    //------------------------------------------------------------------------------
+    void TaskGraph::Process(const TaskContext& taskContext, TaskPool* taskPool) const noexcept
+    {
+        u32 numNodes = u32(m_nodes.size());
+        if (numNodes == 0)
+        {
+            return;
+        }
+
+        std::unique_ptr<std::atomic<u32>[]> numPendingDependencies(new std::atomic<u32>[numNodes]);
+        std::vector<u32> readyNodes;
+        readyNodes.reserve(numNodes);
+
+        for (u32 i = 0; i < numNodes; ++i)
+        {
+            numPendingDependencies[i] = m_nodes[i].m_numDependencies;
+            if (m_nodes[i].m_numDependencies == 0)
+            {
+                readyNodes.push_back(i);
+            }
+        }
+
+        if (!taskPool)
+        {
+            while (!readyNodes.empty())
+            {
+                u32 nodeIndex = readyNodes.back();
+                readyNodes.pop_back();
+
+                const auto& node = m_nodes[nodeIndex];
+                node.m_task(taskContext);
+
+                for (auto dependent : node.m_dependents)
+                {
+                    if (--numPendingDependencies[dependent] == 0)
+                    {
+                        readyNodes.push_back(dependent);
+                    }
+                }
+            }
+
+            return;
+        }
+
+        // Every task in the group performs whichever node is next in the ready list. A task
+        // is only queued after a node has been added to the ready list, so there is always
+        // a node available when one is performed. The shared state is captured by a single
+        // reference so that copies of the task don't allocate.
+        struct SharedState final
+        {
+            const std::vector<Node>* m_nodes;
+            std::atomic<u32>* m_numPendingDependencies;
+            std::vector<u32>* m_readyNodes;
+            std::mutex m_readyNodesMutex;
+            TaskPool* m_taskPool;
+            TaskGroup* m_taskGroup;
+        };
+
+        SharedState state;
+        state.m_nodes = &m_nodes;
+        state.m_numPendingDependencies = numPendingDependencies.get();
+        state.m_readyNodes = &readyNodes;
+        state.m_taskPool = taskPool;
+
+        Task performReadyNode = [&state](const TaskContext& innerTaskContext) noexcept
+        {
+            std::unique_lock<std::mutex> lock(state.m_readyNodesMutex);
+            u32 nodeIndex = state.m_readyNodes->back();
+            state.m_readyNodes->pop_back();
+            lock.unlock();
+
+            const auto& node = (*state.m_nodes)[nodeIndex];
+            node.m_task(innerTaskContext);
+
+            u32 numNewReadyNodes = 0;
+            for (auto dependent : node.m_dependents)
+            {
+                if (--state.m_numPendingDependencies[dependent] == 0)
+                {
+                    lock.lock();
+                    state.m_readyNodes->push_back(dependent);
+                    lock.unlock();
+
+                    ++numNewReadyNodes;
+                }
+            }
+
+            state.m_taskPool->QueueTasks(state.m_taskGroup, numNewReadyNodes);
+        };
+
+        std::vector<Task> tasks(numNodes, performReadyNode);
+        TaskGroup taskGroup(tasks, taskContext);
+        state.m_taskGroup = &taskGroup;
+
+        taskPool->QueueTasks(&taskGroup, u32(readyNodes.size()));
+        taskPool->YieldUntilFinished(taskGroup);
+    }
+}
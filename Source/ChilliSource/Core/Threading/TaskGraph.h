@@ -0,0 +1,115 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKGRAPH_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKGRAPH_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/Task.h>
+
+#include <string>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A directed acyclic graph of tasks. Each node is a task which is only started once
+    /// all of the nodes it depends on have completed, so independent branches of work can
+    /// overlap rather than each level of work waiting on the one before it.
+    ///
+    /// A graph is built up front and then processed using TaskContext::ProcessTaskGraph(),
+    /// which yields until every node has completed. When a node completes, any nodes which
+    /// were waiting only on it are immediately queued as a continuation.
+    ///
+    /// Nodes must be added after any nodes they depend on, which guarantees that the graph
+    /// is acyclic. The graph can be dumped in Graphviz DOT format for inspection.
+    ///
+    /// This is not thread-safe, and should not be modified while it is being processed.
+    ///
+    class TaskGraph final
+    {
+    public:
+        CS_DECLARE_NOCOPY(TaskGraph);
+
+        TaskGraph() = default;
+
+        /// Adds a new node to the graph.
+        ///
+        /// @param name
+        ///     The name of the node. This is only used when dumping the graph.
+        /// @param task
+        ///     The task the node performs.
+        ///
+        /// @return The index of the new node.
+        ///
+        u32 AddNode(const std::string& name, const Task& task) noexcept;
+
+        /// Adds a dependency between two nodes, such that the node will not start until
+        /// the dependency has completed.
+        ///
+        /// @param node
+        ///     The index of the node.
+        /// @param dependency
+        ///     The index of the node it depends on. This must have been added before the
+        ///     dependent node.
+        ///
+        void AddDependency(u32 node, u32 dependency) noexcept;
+
+        /// @return The number of nodes in the graph.
+        ///
+        u32 GetNumNodes() const noexcept { return u32(m_nodes.size()); }
+
+        /// @return The graph described in Graphviz DOT format.
+        ///
+        std::string ToDot() const noexcept;
+
+    private:
+        friend class TaskContext;
+
+        /// A single node in the graph.
+        ///
+        struct Node final
+        {
+            std::string m_name;
+            Task m_task;
+            std::vector<u32> m_dependents;
+            u32 m_numDependencies = 0;
+        };
+
+        /// Processes all nodes in the graph in dependency order and yields until they have
+        /// completed. If a task pool is provided the nodes are performed on it, otherwise
+        /// they are performed on the calling thread.
+        ///
+        /// @param taskContext
+        ///     The context the nodes should be performed with.
+        /// @param taskPool
+        ///     The task pool to perform the nodes on, or null.
+        ///
+        void Process(const TaskContext& taskContext, TaskPool* taskPool) const noexcept;
+
+        std::vector<Node> m_nodes;
+    };
+}
+
+#endif
@@ -0,0 +1,53 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Threading/TaskGroup.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    TaskGroup::TaskGroup(const std::vector<Task>& tasks, const TaskContext& taskContext) noexcept
+        : m_tasks(tasks.data()), m_numTasks(u32(tasks.size())), m_taskContext(taskContext), m_nextTask(0), m_numRemainingTasks(u32(tasks.size()))
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    TaskGroup::TaskGroup(std::vector<Task>&& tasks, const TaskContext& taskContext) noexcept
+        : m_ownedTasks(std::move(tasks)), m_tasks(m_ownedTasks.data()), m_numTasks(u32(m_ownedTasks.size())), m_taskContext(taskContext), m_nextTask(0),
+          m_numRemainingTasks(m_numTasks)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    bool TaskGroup::PerformNextTask() noexcept
+    {
+        u32 taskIndex = m_nextTask.fetch_add(1, std::memory_order_relaxed);
+        CS_ASSERT(taskIndex < m_numTasks, "All tasks in the group have already been performed.");
+
+        m_tasks[taskIndex](m_taskContext);
+
+        return (--m_numRemainingTasks == 0);
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKGROUP_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKGROUP_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/Task.h>
+#include <ChilliSource/Core/Threading/TaskContext.h>
+
+#include <atomic>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A group of tasks which are scheduled together, along with a counter of the number of
+    /// tasks which have yet to complete. A task pool queues a pointer to the group once per
+    /// task, and each time one is taken the next unclaimed task in the group is performed.
+    /// This means the tasks are never copied or wrapped when they are scheduled.
+    ///
+    /// A group can either refer to tasks owned by the caller, in which case both the tasks
+    /// and the group must outlive the group's completion, or it can own a copy of the tasks.
+    /// The former allows a group to be allocated on the stack by a thread which yields until
+    /// the group is finished, so that fan out of child tasks requires no heap allocations.
+    ///
+    /// This is thread-safe.
+    ///
+    class TaskGroup final
+    {
+    public:
+        CS_DECLARE_NOCOPY(TaskGroup);
+
+        /// Creates a new group which refers to the given tasks. The tasks must not be
+        /// changed or destroyed until the group is finished.
+        ///
+        /// @param tasks
+        ///     The tasks in the group.
+        /// @param taskContext
+        ///     The context the tasks should be performed with.
+        ///
+        TaskGroup(const std::vector<Task>& tasks, const TaskContext& taskContext) noexcept;
+
+        /// Creates a new group which owns the given tasks.
+        ///
+        /// @param tasks
+        ///     The tasks in the group.
+        /// @param taskContext
+        ///     The context the tasks should be performed with.
+        ///
+        TaskGroup(std::vector<Task>&& tasks, const TaskContext& taskContext) noexcept;
+
+        /// @return The number of tasks in the group.
+        ///
+        u32 GetNumTasks() const noexcept { return m_numTasks; }
+
+        /// @return The type of task in the group.
+        ///
+        TaskType GetTaskType() const noexcept { return m_taskContext.GetType(); }
+
+        /// @return Whether or not the group owns its tasks.
+        ///
+        bool OwnsTasks() const noexcept { return !m_ownedTasks.empty(); }
+
+        /// @return Whether or not all tasks in the group have been performed.
+        ///
+        bool IsFinished() const noexcept { return m_numRemainingTasks == 0; }
+
+        /// Claims and performs the next task in the group. This must be called exactly once
+        /// for each task in the group. If this returns true the group is finished and must
+        /// no longer be accessed by the calling thread unless it owns the group.
+        ///
+        /// @return Whether or not performing the task finished the group.
+        ///
+        bool PerformNextTask() noexcept;
+
+    private:
+        std::vector<Task> m_ownedTasks;
+        const Task* m_tasks;
+        const u32 m_numTasks;
+        const TaskContext m_taskContext;
+        std::atomic<u32> m_nextTask;
+        std::atomic<u32> m_numRemainingTasks;
+    };
+}
+
+#endif
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Core/Threading/TaskPool.h>
 
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -39,16 +39,27 @@
 
 namespace ChilliSource
 {
+    constexpr u32 TaskPool::k_notWorkerThread;
+    
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    TaskPool::TaskPool(TaskType in_taskType, u32 in_numThreads) noexcept
-        : m_numThreads(in_numThreads), m_taskContext(in_taskType, this), m_isFinished(false), m_taskCountHeuristic(0)
+    TaskPool::TaskPool(TaskType in_taskType, u32 in_numThreads, TaskProfiler* in_profiler) noexcept
+        : m_numThreads(in_numThreads), m_taskContext(in_taskType, this), m_profiler(in_profiler), m_taskCountHeuristic(0), m_numSleepingThreads(0), m_isFinished(false)
     {
         CS_ASSERT(in_taskType == TaskType::k_small || in_taskType == TaskType::k_large, "Task type must be small or large");
         
         for (u32 i = 0; i < m_numThreads; ++i)
         {
-            m_threads.push_back(std::thread(MakeDelegate(this, &TaskPool::ProcessTasks)));
+            m_localQueues.push_back(std::unique_ptr<concurrent_work_stealing_deque<TaskGroup*>>(new concurrent_work_stealing_deque<TaskGroup*>()));
+        }
+        
+        // The sleep mutex is held while the threads are created, and each worker locks it
+        // before starting, so the thread ids are guaranteed to be visible to the workers.
+        std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+        for (u32 i = 0; i < m_numThreads; ++i)
+        {
+            m_threads.push_back(std::thread(&TaskPool::ProcessTasks, this, i));
+            m_threadIds.push_back(m_threads.back().get_id());
         }
     }
     //------------------------------------------------------------------------------
@@ -59,86 +70,228 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    TaskProfiler* TaskPool::GetProfiler() const noexcept
+    {
+        return m_profiler;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void TaskPool::AddTasks(const std::vector<Task>& in_tasks) noexcept
     {
-        std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
-        m_taskQueue.insert(m_taskQueue.begin(), in_tasks.begin(), in_tasks.end());
-        m_taskCountHeuristic += u32(in_tasks.size());
-        
-        if (in_tasks.size() > 1)
+        if (in_tasks.empty())
         {
-            m_emptyWaitCondition.notify_all();
+            return;
         }
-        else
+        
+        auto taskGroup = new TaskGroup(std::vector<Task>(in_tasks), m_taskContext);
+        QueueTaskGroup(taskGroup, taskGroup->GetNumTasks());
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::AddTasksAndYield(const std::vector<Task>& in_tasks) noexcept
+    {
+        AddTasksAndYield(in_tasks, m_taskContext);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::AddTasksAndYield(const std::vector<Task>& in_tasks, const TaskContext& in_taskContext) noexcept
+    {
+        if (in_tasks.empty())
         {
-            m_emptyWaitCondition.notify_one();
+            return;
         }
+        
+        TaskGroup taskGroup(in_tasks, in_taskContext);
+        QueueTaskGroup(&taskGroup, taskGroup.GetNumTasks());
+        YieldUntilFinished(taskGroup);
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::AddTasksAndYield(const std::vector<Task>& in_tasks) noexcept
+    void TaskPool::QueueTasks(TaskGroup* in_taskGroup, u32 in_numTasks) noexcept
     {
-        std::atomic<u32> taskCount(u32(in_tasks.size()));
-        std::atomic<bool> finished(false);
+        CS_ASSERT(!in_taskGroup->OwnsTasks(), "Only task groups which don't own their tasks can be queued externally.");
         
-        std::vector<Task> tasksWithCounter;
-        for (const auto& task : in_tasks)
+        if (in_numTasks > 0)
+        {
+            QueueTaskGroup(in_taskGroup, in_numTasks);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::YieldUntilFinished(const TaskGroup& in_taskGroup) noexcept
+    {
+        auto workerIndex = GetCurrentWorkerIndex();
+        while (!in_taskGroup.IsFinished())
+        {
+            PerformTask(workerIndex, &in_taskGroup);
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    u32 TaskPool::GetCurrentWorkerIndex() const noexcept
+    {
+        auto threadId = std::this_thread::get_id();
+        for (u32 i = 0; i < u32(m_threadIds.size()); ++i)
         {
-            tasksWithCounter.push_back([=, &task, &taskCount, &finished](const TaskContext& in_taskContext) noexcept
+            if (m_threadIds[i] == threadId)
             {
-                task(in_taskContext);
-
-                if (--taskCount == 0)
-                {
-                    std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
-                    finished = true;
-                    m_emptyWaitCondition.notify_all();
-                }
-            });
+                return i;
+            }
         }
         
-        AddTasks(tasksWithCounter);
+        return k_notWorkerThread;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::QueueTaskGroup(TaskGroup* in_taskGroup, u32 in_numTasks) noexcept
+    {
+        m_taskCountHeuristic += in_numTasks;
         
-        while (!finished)
+        auto workerIndex = GetCurrentWorkerIndex();
+        if (workerIndex != k_notWorkerThread)
         {
-            PerformTask(finished);
+            auto& localQueue = m_localQueues[workerIndex];
+            for (u32 i = 0; i < in_numTasks; ++i)
+            {
+                localQueue->push(in_taskGroup);
+            }
         }
+        else
+        {
+            std::unique_lock<std::mutex> queueLock(m_sharedQueueMutex);
+            m_sharedQueue.insert(m_sharedQueue.end(), in_numTasks, in_taskGroup);
+        }
+        
+        WakeThreads(in_numTasks);
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::PerformTask(const std::atomic<bool>& in_forceContinue) noexcept
+    bool TaskPool::TryTakeTask(u32 in_workerIndex, TaskGroup*& out_taskGroup) noexcept
     {
-        std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
+        if (in_workerIndex != k_notWorkerThread && m_localQueues[in_workerIndex]->pop(out_taskGroup))
+        {
+            return true;
+        }
         
-        if (m_taskQueue.empty() && !in_forceContinue)
         {
-            m_emptyWaitCondition.wait(queueLock);
+            std::unique_lock<std::mutex> queueLock(m_sharedQueueMutex);
+            if (!m_sharedQueue.empty())
+            {
+                out_taskGroup = m_sharedQueue.front();
+                m_sharedQueue.pop_front();
+                return true;
+            }
         }
         
-        if (m_taskQueue.empty())
+        u32 firstVictim = (in_workerIndex != k_notWorkerThread) ? in_workerIndex + 1 : 0;
+        for (u32 i = 0; i < m_numThreads; ++i)
+        {
+            u32 victimIndex = (firstVictim + i) % m_numThreads;
+            if (victimIndex != in_workerIndex && m_localQueues[victimIndex]->steal(out_taskGroup))
+            {
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::WakeThreads(u32 in_numTasks) noexcept
+    {
+        if (m_numSleepingThreads == 0)
         {
             return;
         }
         
-        Task task = m_taskQueue.front();
-        m_taskQueue.pop_front();
-        --m_taskCountHeuristic;
+        std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+        if (in_numTasks > 1)
+        {
+            m_sleepCondition.notify_all();
+        }
+        else
+        {
+            m_sleepCondition.notify_one();
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskPool::PerformTask(u32 in_workerIndex, const TaskGroup* in_yieldingTaskGroup) noexcept
+    {
+        TaskGroup* taskGroup = nullptr;
+        if (!TryTakeTask(in_workerIndex, taskGroup))
+        {
+            if (m_taskCountHeuristic > 0)
+            {
+                // A task is either in the process of being added or was lost to a
+                // contending thread, so try again shortly rather than sleeping.
+                std::this_thread::yield();
+                return;
+            }
             
-        queueLock.unlock();
+            // The sleeping count is incremented before re-checking the task count, while
+            // AddTasks() increments the task count before checking the sleeping count, so
+            // at least one of the two is guaranteed to see the other's change.
+            std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+            ++m_numSleepingThreads;
+            while (m_taskCountHeuristic == 0 && !(in_yieldingTaskGroup ? in_yieldingTaskGroup->IsFinished() : m_isFinished.load()))
+            {
+                m_sleepCondition.wait(sleepLock);
+            }
+            --m_numSleepingThreads;
+            return;
+        }
+        
+        --m_taskCountHeuristic;
         
-        task(m_taskContext);
+        // Groups which don't own their tasks belong to a yielding thread, and may be
+        // destroyed as soon as they are finished, so must not be accessed afterwards.
+        bool ownsTasks = taskGroup->OwnsTasks();
+        bool isGroupFinished = false;
+        {
+            TaskProfiler::ScopedEvent profilerEvent(m_profiler, taskGroup->GetTaskType());
+            isGroupFinished = taskGroup->PerformNextTask();
+        }
+        
+        if (isGroupFinished)
+        {
+            if (ownsTasks)
+            {
+                delete taskGroup;
+            }
+            else
+            {
+                std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+                m_sleepCondition.notify_all();
+            }
+        }
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskPool::ProcessTasks() noexcept
+    void TaskPool::ProcessTasks(u32 in_workerIndex) noexcept
     {
+        {
+            std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
+        }
+        
 #ifdef CS_TARGETPLATFORM_ANDROID
         CSBackend::Android::JavaVirtualMachine::Get()->AttachCurrentThread();
 #endif
 
+        bool isNamedInProfiler = false;
         while (!m_isFinished || m_taskCountHeuristic > 0)
         {
-            PerformTask(m_isFinished);
+            // Threads are only named once profiling is enabled, so that no profiler memory
+            // is allocated for them otherwise.
+            if (!isNamedInProfiler && m_profiler && m_profiler->IsEnabled())
+            {
+                std::ostringstream name;
+                name << (m_taskContext.GetType() == TaskType::k_small ? "Small" : "Large") << " Task Worker " << in_workerIndex;
+                m_profiler->SetCurrentThreadName(name.str());
+                isNamedInProfiler = true;
+            }
+            
+            PerformTask(in_workerIndex, nullptr);
         }
         
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -149,11 +302,11 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     TaskPool::~TaskPool() noexcept
     {
-        std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
+        std::unique_lock<std::mutex> sleepLock(m_sleepMutex);
         m_isFinished = true;
-        queueLock.unlock();
+        sleepLock.unlock();
         
-        m_emptyWaitCondition.notify_all();
+        m_sleepCondition.notify_all();
         for (auto& thread : m_threads)
         {
             thread.join();
@@ -30,13 +30,18 @@
 #define _CHILLISOURCE_CORE_THREADING_TASKPOOL_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/concurrent_work_stealing_deque.h>
 #include <ChilliSource/Core/Threading/TaskContext.h>
+#include <ChilliSource/Core/Threading/TaskGroup.h>
 
 #include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -44,9 +49,11 @@ namespace ChilliSource
     /// A collection of tasks which will be performed on one of the worker threads
     /// owned by the pool.
     ///
-    /// Currently this does no task stealing or other clever tricks for performance;
-    /// all tasks are drawn from a single global queue which is locked on every
-    /// access.
+    /// Each worker thread owns a lock-free work stealing deque. Tasks added from a
+    /// worker thread, such as child tasks, are pushed onto that thread's deque and
+    /// are performed most recent first. Tasks added from any other thread are placed
+    /// in a shared queue. When a worker has no local tasks it takes tasks from the
+    /// shared queue, then steals the oldest tasks from the other workers.
     ///
     /// This is thread-safe.
     ///
@@ -65,8 +72,10 @@ namespace ChilliSource
         /// large can be specified here.
         /// @param in_numThreads - The number of threads that this task pool should
         /// create to run tasks on.
+        /// @param in_profiler - [Optional] The profiler which performed tasks should be
+        /// recorded with. This must outlive the pool.
         //------------------------------------------------------------------------------
-        TaskPool(TaskType in_taskType, u32 in_numThreads) noexcept;
+        TaskPool(TaskType in_taskType, u32 in_numThreads, TaskProfiler* in_profiler = nullptr) noexcept;
         //------------------------------------------------------------------------------
         /// @author Ian Copland
         ///
@@ -74,6 +83,10 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         u32 GetNumThreads() const noexcept;
         //------------------------------------------------------------------------------
+        /// @return The profiler which performed tasks are recorded with, or null.
+        //------------------------------------------------------------------------------
+        TaskProfiler* GetProfiler() const noexcept;
+        //------------------------------------------------------------------------------
         /// Adds a series of tasks to the pool. These task will be executed as soon as a
         /// thread becomes free.
         ///
@@ -92,6 +105,35 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void AddTasksAndYield(const std::vector<Task>& in_tasks) noexcept;
         //------------------------------------------------------------------------------
+        /// Performs the given series of tasks with the given task context and yields
+        /// until they are finished. While yielding, other tasks will be processed.
+        ///
+        /// The tasks are neither copied nor wrapped, so this performs no per-task heap
+        /// allocations.
+        ///
+        /// @param in_tasks - The tasks to be added to the pool.
+        /// @param in_taskContext - The context that the tasks should be performed with.
+        /// This must be for a task type which is run by this pool.
+        //------------------------------------------------------------------------------
+        void AddTasksAndYield(const std::vector<Task>& in_tasks, const TaskContext& in_taskContext) noexcept;
+        //------------------------------------------------------------------------------
+        /// Queues the given number of tasks from a task group which is not owned by the
+        /// pool. This allows tasks to be released incrementally, for example as their
+        /// dependencies are met. The number of tasks queued over the lifetime of the
+        /// group must match the number of tasks in the group.
+        ///
+        /// @param in_taskGroup - The task group. This must not own its tasks, and must
+        /// outlive its completion.
+        /// @param in_numTasks - The number of tasks to queue.
+        //------------------------------------------------------------------------------
+        void QueueTasks(TaskGroup* in_taskGroup, u32 in_numTasks) noexcept;
+        //------------------------------------------------------------------------------
+        /// Processes other tasks until the given task group is finished.
+        ///
+        /// @param in_taskGroup - The task group to yield on.
+        //------------------------------------------------------------------------------
+        void YieldUntilFinished(const TaskGroup& in_taskGroup) noexcept;
+        //------------------------------------------------------------------------------
         /// Waits for any currently running tasks to finish then joins all owned threads.
         ///
         /// @author Ian Copland
@@ -99,36 +141,79 @@ namespace ChilliSource
         ~TaskPool() noexcept;
         
     private:
+        static constexpr u32 k_notWorkerThread = std::numeric_limits<u32>::max();
+        
         //------------------------------------------------------------------------------
-        /// Performs a task from the task pool. This must be called from one of the
-        /// threads owned by the task pool.
+        /// @return The index of the worker thread that this is called from, or
+        /// k_notWorkerThread if called from a thread not owned by this pool.
+        //------------------------------------------------------------------------------
+        u32 GetCurrentWorkerIndex() const noexcept;
+        //------------------------------------------------------------------------------
+        /// Queues the given number of tasks from the given group. If called from a
+        /// worker thread the tasks are pushed onto that worker's local deque, otherwise
+        /// they are added to the shared queue.
         ///
-        /// A flag is provided which can be changed by other threads to notify that
-        /// the current thread should continue regardless of whether there are any tasks
-        /// available. AwakenAllThreads() can be used in conjunction with this flag.
+        /// @param in_taskGroup - The task group.
+        /// @param in_numTasks - The number of tasks to queue.
+        //------------------------------------------------------------------------------
+        void QueueTaskGroup(TaskGroup* in_taskGroup, u32 in_numTasks) noexcept;
+        //------------------------------------------------------------------------------
+        /// Attempts to take a task, first from the given worker's local deque, then
+        /// from the shared queue and finally by stealing from the other workers.
         ///
-        /// @author Ian Copland
+        /// @param in_workerIndex - The index of the current worker thread, or
+        /// k_notWorkerThread if this isn't a worker thread.
+        /// @param out_taskGroup - [Out] The group containing the task that was taken.
+        /// The caller must perform the next task in the group. This is only set if a
+        /// task was taken.
+        ///
+        /// @return Whether or not a task was taken.
+        //------------------------------------------------------------------------------
+        bool TryTakeTask(u32 in_workerIndex, TaskGroup*& out_taskGroup) noexcept;
+        //------------------------------------------------------------------------------
+        /// Wakes sleeping threads if there are any.
         ///
-        /// @param in_forceContinue - The force continue flag.
+        /// @param in_numTasks - The number of tasks which have just been added.
+        //------------------------------------------------------------------------------
+        void WakeThreads(u32 in_numTasks) noexcept;
         //------------------------------------------------------------------------------
-        void PerformTask(const std::atomic<bool>& in_forceContinue) noexcept;
+        /// Performs a task from the task pool. If there are no tasks available this
+        /// will sleep until one is added.
+        ///
+        /// A task group can be provided which the current thread is yielding on. The
+        /// thread will not sleep once the group is finished. If no group is provided
+        /// it will instead not sleep once the pool is finished.
+        ///
+        /// @param in_workerIndex - The index of the current worker thread, or
+        /// k_notWorkerThread if this isn't a worker thread.
+        /// @param in_yieldingTaskGroup - The task group being yielded on, or null.
+        //------------------------------------------------------------------------------
+        void PerformTask(u32 in_workerIndex, const TaskGroup* in_yieldingTaskGroup) noexcept;
         //------------------------------------------------------------------------------
         /// Continues to perform tasks until the task pool is deallocated. If there are
         /// no tasks currently available this will sleep until a task is added.
         ///
         /// @author Ian Copland
+        ///
+        /// @param in_workerIndex - The index of the worker thread this is run on.
         //------------------------------------------------------------------------------
-        void ProcessTasks() noexcept;
+        void ProcessTasks(u32 in_workerIndex) noexcept;
         
         const u32 m_numThreads;
         const TaskContext m_taskContext;
+        TaskProfiler* const m_profiler;
 
         std::vector<std::thread> m_threads;
+        std::vector<std::thread::id> m_threadIds;
         
         std::atomic<u32> m_taskCountHeuristic;
-        std::deque<Task> m_taskQueue;
-        std::mutex m_taskQueueMutex;
-        std::condition_variable m_emptyWaitCondition;
+        std::vector<std::unique_ptr<concurrent_work_stealing_deque<TaskGroup*>>> m_localQueues;
+        std::deque<TaskGroup*> m_sharedQueue;
+        std::mutex m_sharedQueueMutex;
+        
+        std::atomic<u32> m_numSleepingThreads;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_sleepCondition;
         
         std::atomic<bool> m_isFinished;
     };
@@ -0,0 +1,280 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        /// @param taskType
+        ///     The task type.
+        ///
+        /// @return The name used for events of the given task type when they have no label.
+        ///
+        const char* GetTaskTypeName(TaskType taskType) noexcept
+        {
+            switch (taskType)
+            {
+                case TaskType::k_small:
+                    return "Small";
+                case TaskType::k_large:
+                    return "Large";
+                case TaskType::k_mainThread:
+                    return "Main Thread";
+                case TaskType::k_system:
+                    return "System";
+                case TaskType::k_gameLogic:
+                    return "Game Logic";
+                case TaskType::k_file:
+                    return "File";
+                default:
+                    CS_LOG_FATAL("Invalid task type.");
+                    return "";
+            }
+        }
+
+        /// Appends the given string to the output as a JSON string, escaping it as required.
+        ///
+        /// @param string
+        ///     The string to append.
+        /// @param out_json
+        ///     (Out) The JSON to append to.
+        ///
+        void AppendJsonString(const char* string, std::string& out_json) noexcept
+        {
+            out_json += '"';
+            for (const char* character = string; *character != '\0'; ++character)
+            {
+                switch (*character)
+                {
+                    case '"':
+                        out_json += "\\\"";
+                        break;
+                    case '\\':
+                        out_json += "\\\\";
+                        break;
+                    case '\n':
+                        out_json += "\\n";
+                        break;
+                    default:
+                        if (u8(*character) >= 0x20)
+                        {
+                            out_json += *character;
+                        }
+                        break;
+                }
+            }
+            out_json += '"';
+        }
+    }
+
+    constexpr u32 TaskProfiler::k_maxThreads;
+    constexpr u32 TaskProfiler::k_maxEventsPerThread;
+    constexpr u32 TaskProfiler::k_maxThreadNameLength;
+
+    //------------------------------------------------------------------------------
+    TaskProfiler::TaskProfiler() noexcept
+        : m_isEnabled(false), m_creationTime(std::chrono::steady_clock::now()), m_numThreadRings(0)
+    {
+        for (auto& threadRing : m_threadRings)
+        {
+            threadRing.m_threadId.store(std::thread::id(), std::memory_order_relaxed);
+            threadRing.m_writeIndex.store(0, std::memory_order_relaxed);
+            threadRing.m_name[0] = '\0';
+            threadRing.m_isNamed.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void TaskProfiler::SetEnabled(bool isEnabled) noexcept
+    {
+        m_isEnabled.store(isEnabled, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    void TaskProfiler::SetCurrentThreadName(const std::string& name) noexcept
+    {
+        auto threadRing = GetCurrentThreadRing();
+        if (threadRing && !threadRing->m_isNamed.load(std::memory_order_relaxed))
+        {
+            auto length = std::min(u32(name.size()), k_maxThreadNameLength - 1);
+            std::memcpy(threadRing->m_name, name.data(), length);
+            threadRing->m_name[length] = '\0';
+            threadRing->m_isNamed.store(true, std::memory_order_release);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    u64 TaskProfiler::GetTimestamp() const noexcept
+    {
+        return u64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_creationTime).count());
+    }
+
+    //------------------------------------------------------------------------------
+    void TaskProfiler::RecordEvent(TaskType taskType, const char* label, u64 startTime, u64 endTime) noexcept
+    {
+        auto threadRing = GetCurrentThreadRing();
+        if (!threadRing)
+        {
+            return;
+        }
+
+        auto writeIndex = threadRing->m_writeIndex.load(std::memory_order_relaxed);
+        auto& event = threadRing->m_events[writeIndex % k_maxEventsPerThread];
+
+        // The event is marked as in progress before any of its fields are written, so a
+        // reader which sees any of the new fields will also see the changed sequence.
+        event.m_sequence.store(2 * writeIndex + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        event.m_startTime.store(startTime, std::memory_order_relaxed);
+        event.m_endTime.store(endTime, std::memory_order_relaxed);
+        event.m_label.store(label, std::memory_order_relaxed);
+        event.m_taskType.store(taskType, std::memory_order_relaxed);
+        event.m_sequence.store(2 * writeIndex + 2, std::memory_order_release);
+
+        threadRing->m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+    }
+
+    //------------------------------------------------------------------------------
+    std::string TaskProfiler::FlushToChromeTrace() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_flushMutex);
+
+        std::string json = "{\"traceEvents\":[";
+        bool isFirstEvent = true;
+        char buffer[128];
+
+        auto numThreadRings = std::min(m_numThreadRings.load(std::memory_order_acquire), k_maxThreads);
+        for (u32 ringIndex = 0; ringIndex < numThreadRings; ++ringIndex)
+        {
+            auto& threadRing = m_threadRings[ringIndex];
+            if (threadRing.m_threadId.load(std::memory_order_acquire) == std::thread::id())
+            {
+                continue;
+            }
+
+            if (!isFirstEvent)
+            {
+                json += ',';
+            }
+            isFirstEvent = false;
+
+            std::snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", ringIndex);
+            json += buffer;
+            if (threadRing.m_isNamed.load(std::memory_order_acquire))
+            {
+                AppendJsonString(threadRing.m_name, json);
+            }
+            else
+            {
+                std::snprintf(buffer, sizeof(buffer), "\"Thread %u\"", ringIndex);
+                json += buffer;
+            }
+            json += "}}";
+
+            auto writeIndex = threadRing.m_writeIndex.load(std::memory_order_acquire);
+            auto readIndex = std::max(threadRing.m_readIndex, (writeIndex > k_maxEventsPerThread) ? writeIndex - k_maxEventsPerThread : 0);
+
+            for (auto eventIndex = readIndex; eventIndex < writeIndex; ++eventIndex)
+            {
+                // The event is discarded if it isn't the completed event with this index,
+                // either because the owning thread has wrapped around the ring and is
+                // writing over it, or because it has already been overwritten. It is also
+                // discarded if it is overwritten while the fields are being copied.
+                const auto& event = threadRing.m_events[eventIndex % k_maxEventsPerThread];
+                auto sequence = event.m_sequence.load(std::memory_order_acquire);
+                if (sequence != 2 * eventIndex + 2)
+                {
+                    continue;
+                }
+
+                auto startTime = event.m_startTime.load(std::memory_order_relaxed);
+                auto endTime = event.m_endTime.load(std::memory_order_relaxed);
+                auto label = event.m_label.load(std::memory_order_relaxed);
+                auto taskType = event.m_taskType.load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (event.m_sequence.load(std::memory_order_relaxed) != sequence)
+                {
+                    continue;
+                }
+
+                json += ",{\"name\":";
+                AppendJsonString(label ? label : GetTaskTypeName(taskType), json);
+                std::snprintf(buffer, sizeof(buffer), ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                    GetTaskTypeName(taskType), f64(startTime) / 1000.0, f64(endTime - startTime) / 1000.0, ringIndex);
+                json += buffer;
+            }
+
+            threadRing.m_readIndex = writeIndex;
+        }
+
+        json += "],\"displayTimeUnit\":\"ms\"}";
+        return json;
+    }
+
+    //------------------------------------------------------------------------------
+    TaskProfiler::ThreadRing* TaskProfiler::GetCurrentThreadRing() noexcept
+    {
+        auto threadId = std::this_thread::get_id();
+
+        auto numThreadRings = std::min(m_numThreadRings.load(std::memory_order_acquire), k_maxThreads);
+        for (u32 i = 0; i < numThreadRings; ++i)
+        {
+            if (m_threadRings[i].m_threadId.load(std::memory_order_relaxed) == threadId)
+            {
+                return &m_threadRings[i];
+            }
+        }
+
+        if (numThreadRings == k_maxThreads)
+        {
+            return nullptr;
+        }
+
+        // Slots are claimed but never released, so the ring is only published once its
+        // events have been allocated. Other threads skip claimed slots which are not
+        // yet published, as they can never belong to them.
+        auto ringIndex = m_numThreadRings.fetch_add(1);
+        if (ringIndex >= k_maxThreads)
+        {
+            return nullptr;
+        }
+
+        auto& threadRing = m_threadRings[ringIndex];
+        threadRing.m_events.reset(new Event[k_maxEventsPerThread]);
+        for (u32 i = 0; i < k_maxEventsPerThread; ++i)
+        {
+            threadRing.m_events[i].m_sequence.store(0, std::memory_order_relaxed);
+        }
+        threadRing.m_threadId.store(threadId, std::memory_order_release);
+        return &threadRing;
+    }
+}
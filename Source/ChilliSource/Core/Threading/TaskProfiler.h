@@ -0,0 +1,204 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_THREADING_TASKPROFILER_H_
+#define _CHILLISOURCE_CORE_THREADING_TASKPROFILER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/TaskType.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ChilliSource
+{
+    /// Records the start and end times of tasks performed by the task pools, so that the
+    /// work done by each thread during a frame can be inspected. Recorded events can be
+    /// flushed to the Chrome trace event JSON format, which can be viewed with
+    /// chrome://tracing or Perfetto.
+    ///
+    /// Profiling is disabled by default. While disabled, recording an event costs a
+    /// single relaxed atomic load, so the instrumentation can be left in production
+    /// builds. While enabled, each thread writes to its own fixed size ring buffer
+    /// without locking, and the oldest events are overwritten if the ring fills up
+    /// between flushes.
+    ///
+    /// Event labels are not copied, so must be string literals or otherwise outlive
+    /// the profiler.
+    ///
+    /// This is thread-safe.
+    ///
+    class TaskProfiler final
+    {
+    public:
+        CS_DECLARE_NOCOPY(TaskProfiler);
+
+        static constexpr u32 k_maxThreads = 64;
+        static constexpr u32 k_maxEventsPerThread = 8192;
+        static constexpr u32 k_maxThreadNameLength = 32;
+
+        /// Records a single event over the lifetime of the object, if the given profiler
+        /// exists and is enabled.
+        ///
+        class ScopedEvent final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ScopedEvent);
+
+            /// @param profiler
+            ///     The profiler to record with. May be null.
+            /// @param taskType
+            ///     The type of task being performed.
+            /// @param label
+            ///     The label of the event, or null to use the task type. This must
+            ///     outlive the profiler.
+            ///
+            ScopedEvent(TaskProfiler* profiler, TaskType taskType, const char* label = nullptr) noexcept
+                : m_profiler((profiler && profiler->IsEnabled()) ? profiler : nullptr), m_taskType(taskType), m_label(label)
+            {
+                if (m_profiler)
+                {
+                    m_startTime = m_profiler->GetTimestamp();
+                }
+            }
+
+            ~ScopedEvent() noexcept
+            {
+                if (m_profiler)
+                {
+                    m_profiler->RecordEvent(m_taskType, m_label, m_startTime, m_profiler->GetTimestamp());
+                }
+            }
+
+        private:
+            TaskProfiler* m_profiler;
+            TaskType m_taskType;
+            const char* m_label;
+            u64 m_startTime = 0;
+        };
+
+        TaskProfiler() noexcept;
+
+        /// @return Whether or not events are currently being recorded.
+        ///
+        bool IsEnabled() const noexcept { return m_isEnabled.load(std::memory_order_relaxed); }
+
+        /// Enables or disables recording of events. Events which have already been recorded
+        /// are kept until they are flushed.
+        ///
+        /// @param isEnabled
+        ///     Whether or not events should be recorded.
+        ///
+        void SetEnabled(bool isEnabled) noexcept;
+
+        /// Sets the name which the calling thread is given in flushed traces. A thread can
+        /// only be named once, and names longer than k_maxThreadNameLength - 1 characters
+        /// are truncated. Threads which are not named are given a generic name.
+        ///
+        /// @param name
+        ///     The name of the thread.
+        ///
+        void SetCurrentThreadName(const std::string& name) noexcept;
+
+        /// @return The current time in nanoseconds, relative to the creation of the profiler.
+        ///
+        u64 GetTimestamp() const noexcept;
+
+        /// Records a complete event on the calling thread. This should only be called while
+        /// the profiler is enabled.
+        ///
+        /// @param taskType
+        ///     The type of task which was performed.
+        /// @param label
+        ///     The label of the event, or null to use the task type. This must outlive the
+        ///     profiler.
+        /// @param startTime
+        ///     The timestamp at the start of the event.
+        /// @param endTime
+        ///     The timestamp at the end of the event.
+        ///
+        void RecordEvent(TaskType taskType, const char* label, u64 startTime, u64 endTime) noexcept;
+
+        /// Removes all events recorded since the last flush from the thread rings and
+        /// converts them to the Chrome trace event JSON format. Events which are
+        /// overwritten while being flushed are discarded.
+        ///
+        /// @return The trace JSON.
+        ///
+        std::string FlushToChromeTrace() noexcept;
+
+    private:
+        /// A single recorded event. This is written and read as a seqlock: the sequence is
+        /// odd while the event is being written, and even once the event with index n in
+        /// the ring is complete, at 2n + 2. The fields are atomic so that they can be read
+        /// while the ring is being written to, with torn events detected by the sequence
+        /// and discarded.
+        ///
+        struct Event final
+        {
+            std::atomic<u64> m_sequence;
+            std::atomic<u64> m_startTime;
+            std::atomic<u64> m_endTime;
+            std::atomic<const char*> m_label;
+            std::atomic<TaskType> m_taskType;
+        };
+
+        /// The ring of events written by a single thread. Only the owning thread writes
+        /// events, and only the thread flushing reads them.
+        ///
+        struct ThreadRing final
+        {
+            std::atomic<std::thread::id> m_threadId;
+            std::unique_ptr<Event[]> m_events;
+            std::atomic<u64> m_writeIndex;
+            u64 m_readIndex = 0;
+
+            char m_name[k_maxThreadNameLength];
+            std::atomic<bool> m_isNamed;
+        };
+
+        /// Gets the ring for the calling thread, creating it if this is the first time the
+        /// thread has used the profiler.
+        ///
+        /// @return The ring, or null if the maximum number of threads has been reached.
+        ///
+        ThreadRing* GetCurrentThreadRing() noexcept;
+
+        std::atomic<bool> m_isEnabled;
+        const std::chrono::steady_clock::time_point m_creationTime;
+
+        std::array<ThreadRing, k_maxThreads> m_threadRings;
+        std::atomic<u32> m_numThreadRings;
+
+        std::mutex m_flushMutex;
+    };
+}
+
+#endif
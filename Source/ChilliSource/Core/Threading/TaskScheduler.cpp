@@ -118,19 +118,7 @@ namespace ChilliSource
             }
             case TaskType::k_file:
             {
-                std::unique_lock<std::mutex> lock(m_fileTaskMutex);
-
-                m_fileTaskQueue.insert(m_fileTaskQueue.begin(), in_tasks.begin(), in_tasks.end());
-
-                if (!m_isFileTaskRunning)
-                {
-                    m_isFileTaskRunning = true;
-                    auto task = m_fileTaskQueue.front();
-                    m_fileTaskQueue.pop_front();
-                    lock.unlock();
-
-                    StartNextFileTask(task);
-                }
+                m_fileTaskQueue->AddTasks(FileTaskPriority::k_immediate, in_tasks);
                 break;
             }
         }
@@ -162,6 +150,55 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    void TaskScheduler::ScheduleTasksAndYield(TaskType in_taskType, const std::vector<Task>& in_tasks) noexcept
+    {
+        CS_ASSERT(in_tasks.size() > 0, "No tasks provided to run.");
+        
+        switch (in_taskType)
+        {
+            case TaskType::k_small:
+            {
+                m_smallTaskPool->AddTasksAndYield(in_tasks);
+                break;
+            }
+            case TaskType::k_large:
+            {
+                m_largeTaskPool->AddTasksAndYield(in_tasks);
+                break;
+            }
+            default:
+            {
+                CS_LOG_FATAL("Only small and large tasks can be scheduled and yielded on.");
+                break;
+            }
+        }
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    FileTaskQueue::TaskId TaskScheduler::ScheduleFileTask(FileTaskPriority in_priority, const Task& in_task) noexcept
+    {
+        return m_fileTaskQueue->AddTask(in_priority, in_task);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    bool TaskScheduler::CancelFileTask(FileTaskQueue::TaskId in_taskId) noexcept
+    {
+        return m_fileTaskQueue->CancelTask(in_taskId);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    void TaskScheduler::SetMaxConcurrentFileTasks(u32 in_maxConcurrentTasks) noexcept
+    {
+        m_fileTaskQueue->SetMaxConcurrentTasks(in_maxConcurrentTasks);
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    TaskProfiler* TaskScheduler::GetTaskProfiler() noexcept
+    {
+        return m_taskProfiler.get();
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void TaskScheduler::ExecuteMainThreadTasks() noexcept
     {
         //wait on all game logic tasks completing.
@@ -184,35 +221,6 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
-    void TaskScheduler::StartNextFileTask(const Task& in_task) noexcept
-    {
-        std::vector<Task> tasks;
-        tasks.reserve(1);
-
-        tasks.push_back([=](const TaskContext& in_taskContext)
-        {
-            in_task(TaskContext(TaskType::k_file));
-            
-            std::unique_lock<std::mutex> lock(m_fileTaskMutex);
-            
-            if (m_fileTaskQueue.empty())
-            {
-                m_isFileTaskRunning = false;
-                return;
-            }
-            
-            auto task = m_fileTaskQueue.front();
-            m_fileTaskQueue.pop_front();
-            
-            lock.unlock();
-            
-            StartNextFileTask(task);
-        });
-
-        m_largeTaskPool->AddTasks(tasks);
-    }
-    //------------------------------------------------------------------------------
-    //------------------------------------------------------------------------------
     void TaskScheduler::OnInit() noexcept
     {
         constexpr s32 k_minThreadsPerPool = 2;
@@ -223,10 +231,14 @@ namespace ChilliSource
         s32 numFreeCores = s32(device->GetNumberOfCPUCores()) - k_namedThreads;
         s32 threadsPerPool = std::max(k_minThreadsPerPool, numFreeCores);
         
-        m_smallTaskPool = TaskPoolUPtr(new TaskPool(TaskType::k_small, threadsPerPool));
-        m_largeTaskPool = TaskPoolUPtr(new TaskPool(TaskType::k_large, threadsPerPool));
-        m_mainThreadTaskPool = SingleThreadTaskPoolUPtr(new SingleThreadTaskPool(TaskType::k_mainThread));
-        m_systemThreadTaskPool = SingleThreadTaskPoolUPtr(new SingleThreadTaskPool(TaskType::k_system));
+        m_taskProfiler = TaskProfilerUPtr(new TaskProfiler());
+        m_smallTaskPool = TaskPoolUPtr(new TaskPool(TaskType::k_small, threadsPerPool, m_taskProfiler.get()));
+        m_largeTaskPool = TaskPoolUPtr(new TaskPool(TaskType::k_large, threadsPerPool, m_taskProfiler.get()));
+        m_mainThreadTaskPool = SingleThreadTaskPoolUPtr(new SingleThreadTaskPool(TaskType::k_mainThread, m_taskProfiler.get()));
+        m_systemThreadTaskPool = SingleThreadTaskPoolUPtr(new SingleThreadTaskPool(TaskType::k_system, m_taskProfiler.get()));
+        
+        //File tasks are performed one at a time by default, as resource providers aren't guaranteed to support concurrent loads.
+        m_fileTaskQueue = FileTaskQueueUPtr(new FileTaskQueue(m_largeTaskPool.get(), 1));
 
         m_mainThreadId = std::this_thread::get_id();
     }
@@ -234,8 +246,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void TaskScheduler::Destroy() noexcept
     {
+        //The file task queue must stop adding work to the large task pool before the pool is joined, but must
+        //outlive it as running file tasks still reference the queue.
+        m_fileTaskQueue->Shutdown();
         m_smallTaskPool.reset();
         m_largeTaskPool.reset();
+        m_fileTaskQueue.reset();
         m_mainThreadTaskPool.reset();
     }
 }
\ No newline at end of file
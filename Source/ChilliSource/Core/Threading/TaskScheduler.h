@@ -31,9 +31,12 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/Threading/FileTaskPriority.h>
+#include <ChilliSource/Core/Threading/FileTaskQueue.h>
 #include <ChilliSource/Core/Threading/SingleThreadTaskPool.h>
 #include <ChilliSource/Core/Threading/Task.h>
 #include <ChilliSource/Core/Threading/TaskPool.h>
+#include <ChilliSource/Core/Threading/TaskProfiler.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 
 namespace ChilliSource
@@ -113,6 +116,59 @@ namespace ChilliSource
         /// have all completed.
         //------------------------------------------------------------------------------
         void ScheduleTasks(TaskType in_taskType, const std::vector<Task>& in_tasks, const Task& in_completionTask) noexcept;
+        //------------------------------------------------------------------------------
+        /// Schedules a batch of tasks and waits for them to complete. While waiting
+        /// the calling thread will process tasks from the same task pool, so this
+        /// can safely be called from the main thread to spread work across the
+        /// pool without blocking on it.
+        ///
+        /// Only small and large tasks are supported. Inside a task, the task
+        /// context should be used to process child tasks instead.
+        ///
+        /// @param in_taskType - The type of task. Must be small or large.
+        /// @param in_tasks - The tasks to be processed.
+        //------------------------------------------------------------------------------
+        void ScheduleTasksAndYield(TaskType in_taskType, const std::vector<Task>& in_tasks) noexcept;
+        //------------------------------------------------------------------------------
+        /// Schedules a file task with the given priority. File tasks are performed on
+        /// the large task pool, with a limited number in flight at once. Higher priority
+        /// tasks are always started before lower priority tasks, and within a priority
+        /// the most recently scheduled tasks are started first. Scheduling a task with
+        /// TaskType::k_file is equivalent to using FileTaskPriority::k_immediate.
+        ///
+        /// @param in_priority - The priority of the task.
+        /// @param in_task - The task to be scheduled.
+        ///
+        /// @return The id of the task, which can be used to cancel it before it starts.
+        //------------------------------------------------------------------------------
+        FileTaskQueue::TaskId ScheduleFileTask(FileTaskPriority in_priority, const Task& in_task) noexcept;
+        //------------------------------------------------------------------------------
+        /// Cancels a file task which has not yet started. Tasks which are running or
+        /// have completed cannot be cancelled.
+        ///
+        /// @param in_taskId - The id of the file task.
+        ///
+        /// @return Whether or not the task was cancelled. If so it will never be run.
+        //------------------------------------------------------------------------------
+        bool CancelFileTask(FileTaskQueue::TaskId in_taskId) noexcept;
+        //------------------------------------------------------------------------------
+        /// Sets the maximum number of file tasks which can be performed at once. The
+        /// default is one, so file tasks are performed one at a time. This should only
+        /// be raised if every resource provider loaded asynchronously, and the file
+        /// system, support concurrent loads.
+        ///
+        /// @param in_maxConcurrentTasks - The maximum number of concurrent file tasks.
+        /// Must be at least one.
+        //------------------------------------------------------------------------------
+        void SetMaxConcurrentFileTasks(u32 in_maxConcurrentTasks) noexcept;
+        //------------------------------------------------------------------------------
+        /// The profiler is disabled by default. Once enabled it records every task
+        /// performed by the scheduler's task pools, and can be flushed to a Chrome
+        /// trace.
+        ///
+        /// @return The profiler which the scheduler's tasks are recorded with.
+        //------------------------------------------------------------------------------
+        TaskProfiler* GetTaskProfiler() noexcept;
         
     private:
         friend class Application;
@@ -150,15 +206,6 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void ExecuteSystemThreadTasks() noexcept;
     private:
-        //------------------------------------------------------------------------------
-        /// Adds the given task to the large task pool. Once the task is complete then
-        /// this is called again for the next task in the file queue. If the file queue
-        /// is empty then flag indication whether or not file tasks are running is set
-        /// to false.
-        ///
-        /// @author Ian Copland
-        //------------------------------------------------------------------------------
-        void StartNextFileTask(const Task& in_task) noexcept;
         //------------------------------------------------------------------------------
         /// Cleans up the Task Scheduler, joining on all existing threads and then
         /// destroying them.
@@ -176,6 +223,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void OnInit() noexcept override;
         
+        TaskProfilerUPtr m_taskProfiler;
         TaskPoolUPtr m_smallTaskPool;
         TaskPoolUPtr m_largeTaskPool;
         SingleThreadTaskPoolUPtr m_mainThreadTaskPool;
@@ -185,9 +233,7 @@ namespace ChilliSource
         std::condition_variable m_gameLogicTaskCondition;
         std::mutex m_gameLogicTaskMutex;
         
-        std::mutex m_fileTaskMutex;
-        bool m_isFileTaskRunning = false;
-        std::deque<Task> m_fileTaskQueue;
+        FileTaskQueueUPtr m_fileTaskQueue;
 
         std::thread::id m_mainThreadId;
     };
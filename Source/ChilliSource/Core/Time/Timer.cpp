@@ -28,7 +28,6 @@
 
 #include <ChilliSource/Core/Time/Timer.h>
 
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Event/EventConnection.h>
 
 namespace ChilliSource
@@ -37,7 +36,7 @@ namespace ChilliSource
     //--------------------------------------------
     Timer::Timer()
     {
-        m_coreTimerUpdateConnection = CoreTimer::GetTimerUpdateEvent().OpenConnection(MakeDelegate(this, &Timer::Update));
+        m_coreTimerUpdateConnection = CoreTimer::GetTimerUpdateEvent().OpenConnection(this, &Timer::Update);
     }
     //--------------------------------------------
     /// Start
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_VOLUME_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
 #endif
@@ -0,0 +1,724 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
+
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
+#include <ChilliSource/Core/Volume/VolumeComponent.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        const u32 k_null = std::numeric_limits<u32>::max();
+        constexpr f32 k_leafMarginRatio = 0.1f;
+
+        /// @param min
+        ///     The minimum bounds of the box.
+        /// @param max
+        ///     The maximum bounds of the box.
+        ///
+        /// @return The surface area of the box.
+        ///
+        f32 CalcSurfaceArea(const Vector3& min, const Vector3& max) noexcept
+        {
+            Vector3 size = max - min;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        /// Calculates the cost of inserting a leaf below the given child during the descent
+        /// to find the best sibling for the leaf. This doesn't include the cost inherited
+        /// from the ancestors of the child.
+        ///
+        /// @param childMin
+        ///     The minimum bounds of the child.
+        /// @param childMax
+        ///     The maximum bounds of the child.
+        /// @param isChildLeaf
+        ///     Whether or not the child is a leaf.
+        /// @param leafMin
+        ///     The minimum bounds of the leaf being inserted.
+        /// @param leafMax
+        ///     The maximum bounds of the leaf being inserted.
+        ///
+        /// @return The cost.
+        ///
+        f32 CalcInsertionCost(const Vector3& childMin, const Vector3& childMax, bool isChildLeaf, const Vector3& leafMin, const Vector3& leafMax) noexcept
+        {
+            f32 combinedArea = CalcSurfaceArea(Vector3::Min(childMin, leafMin), Vector3::Max(childMax, leafMax));
+            if (isChildLeaf)
+            {
+                return combinedArea;
+            }
+
+            return combinedArea - CalcSurfaceArea(childMin, childMax);
+        }
+
+        /// Clips the ray against a single slab of a box, updating the entry and exit
+        /// distances. Unlike the slab test used by the shapes themselves, this treats
+        /// touching as intersecting, so it is conservative.
+        ///
+        /// @param start
+        ///     The start of the ray along the axis of the slab.
+        /// @param direction
+        ///     The direction of the ray along the axis of the slab, scaled by its length.
+        /// @param min
+        ///     The minimum of the slab.
+        /// @param max
+        ///     The maximum of the slab.
+        /// @param io_entry
+        ///     (In/Out) The entry distance along the ray.
+        /// @param io_exit
+        ///     (In/Out) The exit distance along the ray.
+        ///
+        /// @return Whether or not the ray could still intersect the box.
+        ///
+        bool ClipRayToSlab(f32 start, f32 direction, f32 min, f32 max, f32& io_entry, f32& io_exit) noexcept
+        {
+            if (direction == 0.0f)
+            {
+                return (start >= min && start <= max);
+            }
+
+            f32 entry = (min - start) / direction;
+            f32 exit = (max - start) / direction;
+            if (entry > exit)
+            {
+                std::swap(entry, exit);
+            }
+
+            io_entry = std::max(entry, io_entry);
+            io_exit = std::min(exit, io_exit);
+            return (io_entry <= io_exit && io_exit >= 0.0f);
+        }
+
+        /// @param origin
+        ///     The origin of the ray.
+        /// @param direction
+        ///     The direction of the ray, scaled by its length.
+        /// @param min
+        ///     The minimum bounds of the box.
+        /// @param max
+        ///     The maximum bounds of the box.
+        /// @param out_entry
+        ///     (Out) The distance along the ray at which it enters the box, in the same units
+        ///     as OOBB::Contains(). This may be negative if the ray starts inside the box.
+        ///
+        /// @return Whether or not the ray intersects the box.
+        ///
+        bool IntersectsRay(const Vector3& origin, const Vector3& direction, const Vector3& min, const Vector3& max, f32& out_entry) noexcept
+        {
+            f32 entry = -std::numeric_limits<f32>::infinity();
+            f32 exit = std::numeric_limits<f32>::infinity();
+
+            if (!ClipRayToSlab(origin.x, direction.x, min.x, max.x, entry, exit) ||
+                !ClipRayToSlab(origin.y, direction.y, min.y, max.y, entry, exit) ||
+                !ClipRayToSlab(origin.z, direction.z, min.z, max.z, entry, exit))
+            {
+                return false;
+            }
+
+            out_entry = entry;
+            return true;
+        }
+
+        /// @param sphere
+        ///     The sphere.
+        /// @param min
+        ///     The minimum bounds of the box.
+        /// @param max
+        ///     The maximum bounds of the box.
+        ///
+        /// @return Whether or not the sphere overlaps the box.
+        ///
+        bool IntersectsSphere(const Sphere& sphere, const Vector3& min, const Vector3& max) noexcept
+        {
+            Vector3 closestPoint = Vector3::Min(Vector3::Max(sphere.vOrigin, min), max);
+            return ((closestPoint - sphere.vOrigin).LengthSquared() <= sphere.fRadius * sphere.fRadius);
+        }
+
+        /// @param lhsMin
+        ///     The minimum bounds of the first box.
+        /// @param lhsMax
+        ///     The maximum bounds of the first box.
+        /// @param rhsMin
+        ///     The minimum bounds of the second box.
+        /// @param rhsMax
+        ///     The maximum bounds of the second box.
+        ///
+        /// @return Whether or not the boxes overlap, including touching.
+        ///
+        bool IntersectsBox(const Vector3& lhsMin, const Vector3& lhsMax, const Vector3& rhsMin, const Vector3& rhsMax) noexcept
+        {
+            return (lhsMax.x >= rhsMin.x && lhsMin.x <= rhsMax.x &&
+                    lhsMax.y >= rhsMin.y && lhsMin.y <= rhsMax.y &&
+                    lhsMax.z >= rhsMin.z && lhsMin.z <= rhsMax.z);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    BoundingVolumeHierarchy::BoundingVolumeHierarchy() noexcept
+        : m_root(k_null), m_freeList(k_null)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::Add(VolumeComponent* volumeComponent) noexcept
+    {
+        CS_ASSERT(volumeComponent != nullptr, "Cannot add a null volume to a bounding volume hierarchy.");
+        CS_ASSERT(volumeComponent->m_volumeHierarchy == nullptr, "Cannot add a volume which is already in a bounding volume hierarchy.");
+        CS_ASSERT(volumeComponent->GetEntity() != nullptr, "Cannot add a volume which isn't attached to an entity to a bounding volume hierarchy.");
+
+        u32 leafIndex = AllocateNode();
+        m_nodes[leafIndex].m_volumeComponent = volumeComponent;
+        volumeComponent->m_volumeHierarchy = this;
+        volumeComponent->m_volumeHierarchyLeaf = leafIndex;
+
+        m_transformChangedConnections[leafIndex] = volumeComponent->GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection([this, leafIndex]()
+        {
+            MarkDirty(leafIndex);
+        });
+
+        MarkDirty(leafIndex);
+        ++m_numVolumes;
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::Remove(VolumeComponent* volumeComponent) noexcept
+    {
+        CS_ASSERT(volumeComponent != nullptr, "Cannot remove a null volume from a bounding volume hierarchy.");
+        CS_ASSERT(volumeComponent->m_volumeHierarchy == this, "Cannot remove a volume which isn't in this bounding volume hierarchy.");
+
+        u32 leafIndex = volumeComponent->m_volumeHierarchyLeaf;
+        if (m_nodes[leafIndex].m_isInTree)
+        {
+            RemoveLeaf(leafIndex);
+        }
+
+        FreeNode(leafIndex);
+        volumeComponent->m_volumeHierarchy = nullptr;
+        --m_numVolumes;
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::Invalidate(VolumeComponent* volumeComponent) noexcept
+    {
+        CS_ASSERT(volumeComponent->m_volumeHierarchy == this, "Cannot invalidate a volume which isn't in this bounding volume hierarchy.");
+
+        MarkDirty(volumeComponent->m_volumeHierarchyLeaf);
+    }
+
+    //------------------------------------------------------------------------------
+    VolumeComponent* BoundingVolumeHierarchy::RaycastNearest(const Ray& ray) noexcept
+    {
+        RefitDirtyLeaves();
+
+        VolumeComponent* nearestVolumeComponent = nullptr;
+        f32 nearestIntersection = std::numeric_limits<f32>::infinity();
+
+        if (m_root == k_null)
+        {
+            return nullptr;
+        }
+
+        Vector3 direction = ray.vDirection * ray.fLength;
+
+        m_traversalStack.clear();
+        m_traversalStack.push_back(m_root);
+        while (!m_traversalStack.empty())
+        {
+            const Node& node = m_nodes[m_traversalStack.back()];
+            m_traversalStack.pop_back();
+
+            // The bounds of a node contain all of its volumes, so nodes entered beyond the
+            // nearest intersection found so far cannot contain a nearer one.
+            f32 entry = 0.0f;
+            if (!IntersectsRay(ray.vOrigin, direction, node.m_min, node.m_max, entry) || entry > nearestIntersection)
+            {
+                continue;
+            }
+
+            if (node.m_left == k_null)
+            {
+                f32 nearIntersection = 0.0f, farIntersection = 0.0f;
+                if (node.m_volumeComponent->GetOOBB().Contains(ray, nearIntersection, farIntersection) && nearIntersection < nearestIntersection)
+                {
+                    nearestVolumeComponent = node.m_volumeComponent;
+                    nearestIntersection = nearIntersection;
+                }
+            }
+            else
+            {
+                // Visit the child nearest the start of the ray first, so more of the tree is
+                // likely to be skipped.
+                const Node& left = m_nodes[node.m_left];
+                const Node& right = m_nodes[node.m_right];
+                if (Vector3::DotProduct(left.m_min + left.m_max, direction) < Vector3::DotProduct(right.m_min + right.m_max, direction))
+                {
+                    m_traversalStack.push_back(node.m_right);
+                    m_traversalStack.push_back(node.m_left);
+                }
+                else
+                {
+                    m_traversalStack.push_back(node.m_left);
+                    m_traversalStack.push_back(node.m_right);
+                }
+            }
+        }
+
+        if (nearestVolumeComponent != nullptr)
+        {
+            nearestVolumeComponent->mfQueryIntersectionValue = nearestIntersection;
+        }
+
+        return nearestVolumeComponent;
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::RaycastAll(const Ray& ray, std::vector<VolumeComponent*>& out_volumeComponents) noexcept
+    {
+        RefitDirtyLeaves();
+
+        if (m_root == k_null)
+        {
+            return;
+        }
+
+        Vector3 direction = ray.vDirection * ray.fLength;
+
+        m_traversalStack.clear();
+        m_traversalStack.push_back(m_root);
+        while (!m_traversalStack.empty())
+        {
+            const Node& node = m_nodes[m_traversalStack.back()];
+            m_traversalStack.pop_back();
+
+            f32 entry = 0.0f;
+            if (!IntersectsRay(ray.vOrigin, direction, node.m_min, node.m_max, entry))
+            {
+                continue;
+            }
+
+            if (node.m_left == k_null)
+            {
+                f32 nearIntersection = 0.0f, farIntersection = 0.0f;
+                if (node.m_volumeComponent->GetOOBB().Contains(ray, nearIntersection, farIntersection))
+                {
+                    node.m_volumeComponent->mfQueryIntersectionValue = nearIntersection;
+                    out_volumeComponents.push_back(node.m_volumeComponent);
+                }
+            }
+            else
+            {
+                m_traversalStack.push_back(node.m_left);
+                m_traversalStack.push_back(node.m_right);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::QueryOverlaps(const Sphere& sphere, std::vector<VolumeComponent*>& out_volumeComponents) noexcept
+    {
+        RefitDirtyLeaves();
+
+        if (m_root == k_null)
+        {
+            return;
+        }
+
+        m_traversalStack.clear();
+        m_traversalStack.push_back(m_root);
+        while (!m_traversalStack.empty())
+        {
+            const Node& node = m_nodes[m_traversalStack.back()];
+            m_traversalStack.pop_back();
+
+            if (!IntersectsSphere(sphere, node.m_min, node.m_max))
+            {
+                continue;
+            }
+
+            if (node.m_left == k_null)
+            {
+                const AABB& aabb = node.m_volumeComponent->GetAABB();
+                if (IntersectsSphere(sphere, aabb.GetMin(), aabb.GetMax()))
+                {
+                    out_volumeComponents.push_back(node.m_volumeComponent);
+                }
+            }
+            else
+            {
+                m_traversalStack.push_back(node.m_left);
+                m_traversalStack.push_back(node.m_right);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::QueryOverlaps(const AABB& aabb, std::vector<VolumeComponent*>& out_volumeComponents) noexcept
+    {
+        RefitDirtyLeaves();
+
+        if (m_root == k_null)
+        {
+            return;
+        }
+
+        Vector3 queryMin = aabb.GetMin();
+        Vector3 queryMax = aabb.GetMax();
+
+        m_traversalStack.clear();
+        m_traversalStack.push_back(m_root);
+        while (!m_traversalStack.empty())
+        {
+            const Node& node = m_nodes[m_traversalStack.back()];
+            m_traversalStack.pop_back();
+
+            if (!IntersectsBox(node.m_min, node.m_max, queryMin, queryMax))
+            {
+                continue;
+            }
+
+            if (node.m_left == k_null)
+            {
+                if (ShapeIntersection::Intersects(node.m_volumeComponent->GetAABB(), aabb))
+                {
+                    out_volumeComponents.push_back(node.m_volumeComponent);
+                }
+            }
+            else
+            {
+                m_traversalStack.push_back(node.m_left);
+                m_traversalStack.push_back(node.m_right);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    u32 BoundingVolumeHierarchy::AllocateNode() noexcept
+    {
+        u32 nodeIndex = m_freeList;
+        if (nodeIndex == k_null)
+        {
+            nodeIndex = u32(m_nodes.size());
+            m_nodes.push_back(Node());
+            m_transformChangedConnections.push_back(nullptr);
+        }
+        else
+        {
+            m_freeList = m_nodes[nodeIndex].m_parent;
+        }
+
+        Node& node = m_nodes[nodeIndex];
+        node.m_min = Vector3::k_zero;
+        node.m_max = Vector3::k_zero;
+        node.m_parent = k_null;
+        node.m_left = k_null;
+        node.m_right = k_null;
+        node.m_height = 0;
+        node.m_volumeComponent = nullptr;
+        node.m_isInTree = false;
+        node.m_isDirty = false;
+        return nodeIndex;
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::FreeNode(u32 nodeIndex) noexcept
+    {
+        // The node may still be in the dirty list, so it is marked clean to ensure it is
+        // skipped, even if it is reused before the list is processed.
+        Node& node = m_nodes[nodeIndex];
+        node.m_parent = m_freeList;
+        node.m_height = -1;
+        node.m_volumeComponent = nullptr;
+        node.m_isInTree = false;
+        node.m_isDirty = false;
+        m_transformChangedConnections[nodeIndex].reset();
+
+        m_freeList = nodeIndex;
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::MarkDirty(u32 leafIndex) noexcept
+    {
+        Node& leaf = m_nodes[leafIndex];
+        if (!leaf.m_isDirty)
+        {
+            leaf.m_isDirty = true;
+            m_dirtyLeaves.push_back(leafIndex);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::RefitDirtyLeaves() noexcept
+    {
+        for (u32 i = 0; i < u32(m_dirtyLeaves.size()); ++i)
+        {
+            u32 leafIndex = m_dirtyLeaves[i];
+            if (!m_nodes[leafIndex].m_isDirty)
+            {
+                continue;
+            }
+            m_nodes[leafIndex].m_isDirty = false;
+
+            const AABB& aabb = m_nodes[leafIndex].m_volumeComponent->GetAABB();
+            Vector3 min = aabb.GetMin();
+            Vector3 max = aabb.GetMax();
+
+            if (m_nodes[leafIndex].m_isInTree)
+            {
+                const Node& leaf = m_nodes[leafIndex];
+                if (min.x >= leaf.m_min.x && min.y >= leaf.m_min.y && min.z >= leaf.m_min.z && max.x <= leaf.m_max.x && max.y <= leaf.m_max.y && max.z <= leaf.m_max.z)
+                {
+                    continue;
+                }
+
+                RemoveLeaf(leafIndex);
+            }
+
+            // Enlarge the bounds so that small movements don't require the leaf to be re-inserted.
+            Vector3 margin = (max - min) * k_leafMarginRatio;
+            m_nodes[leafIndex].m_min = min - margin;
+            m_nodes[leafIndex].m_max = max + margin;
+            InsertLeaf(leafIndex);
+        }
+
+        m_dirtyLeaves.clear();
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::InsertLeaf(u32 leafIndex) noexcept
+    {
+        m_nodes[leafIndex].m_isInTree = true;
+
+        if (m_root == k_null)
+        {
+            m_root = leafIndex;
+            m_nodes[leafIndex].m_parent = k_null;
+            return;
+        }
+
+        Vector3 leafMin = m_nodes[leafIndex].m_min;
+        Vector3 leafMax = m_nodes[leafIndex].m_max;
+
+        // Descend to the sibling which gives the lowest total increase in surface area,
+        // stopping early if creating a new parent for the current node is cheapest.
+        u32 siblingIndex = m_root;
+        while (m_nodes[siblingIndex].m_left != k_null)
+        {
+            const Node& node = m_nodes[siblingIndex];
+            const Node& left = m_nodes[node.m_left];
+            const Node& right = m_nodes[node.m_right];
+
+            f32 area = CalcSurfaceArea(node.m_min, node.m_max);
+            f32 combinedArea = CalcSurfaceArea(Vector3::Min(node.m_min, leafMin), Vector3::Max(node.m_max, leafMax));
+            f32 cost = 2.0f * combinedArea;
+            f32 inheritedCost = 2.0f * (combinedArea - area);
+
+            f32 leftCost = CalcInsertionCost(left.m_min, left.m_max, left.m_left == k_null, leafMin, leafMax) + inheritedCost;
+            f32 rightCost = CalcInsertionCost(right.m_min, right.m_max, right.m_left == k_null, leafMin, leafMax) + inheritedCost;
+
+            if (cost < leftCost && cost < rightCost)
+            {
+                break;
+            }
+
+            siblingIndex = (leftCost < rightCost) ? node.m_left : node.m_right;
+        }
+
+        u32 newParentIndex = AllocateNode();
+        u32 oldParentIndex = m_nodes[siblingIndex].m_parent;
+
+        Node& newParent = m_nodes[newParentIndex];
+        newParent.m_parent = oldParentIndex;
+        newParent.m_left = siblingIndex;
+        newParent.m_right = leafIndex;
+        newParent.m_isInTree = true;
+
+        m_nodes[siblingIndex].m_parent = newParentIndex;
+        m_nodes[leafIndex].m_parent = newParentIndex;
+
+        if (oldParentIndex == k_null)
+        {
+            m_root = newParentIndex;
+        }
+        else if (m_nodes[oldParentIndex].m_left == siblingIndex)
+        {
+            m_nodes[oldParentIndex].m_left = newParentIndex;
+        }
+        else
+        {
+            m_nodes[oldParentIndex].m_right = newParentIndex;
+        }
+
+        RefitAncestors(newParentIndex);
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::RemoveLeaf(u32 leafIndex) noexcept
+    {
+        m_nodes[leafIndex].m_isInTree = false;
+
+        if (leafIndex == m_root)
+        {
+            m_root = k_null;
+            return;
+        }
+
+        u32 parentIndex = m_nodes[leafIndex].m_parent;
+        u32 grandParentIndex = m_nodes[parentIndex].m_parent;
+        u32 siblingIndex = (m_nodes[parentIndex].m_left == leafIndex) ? m_nodes[parentIndex].m_right : m_nodes[parentIndex].m_left;
+
+        m_nodes[siblingIndex].m_parent = grandParentIndex;
+        FreeNode(parentIndex);
+
+        if (grandParentIndex == k_null)
+        {
+            m_root = siblingIndex;
+            return;
+        }
+
+        if (m_nodes[grandParentIndex].m_left == parentIndex)
+        {
+            m_nodes[grandParentIndex].m_left = siblingIndex;
+        }
+        else
+        {
+            m_nodes[grandParentIndex].m_right = siblingIndex;
+        }
+
+        RefitAncestors(grandParentIndex);
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::RefitAncestors(u32 nodeIndex) noexcept
+    {
+        while (nodeIndex != k_null)
+        {
+            nodeIndex = Balance(nodeIndex);
+            UpdateFromChildren(nodeIndex);
+            nodeIndex = m_nodes[nodeIndex].m_parent;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    u32 BoundingVolumeHierarchy::Balance(u32 nodeIndex) noexcept
+    {
+        Node& node = m_nodes[nodeIndex];
+        if (node.m_left == k_null || node.m_height < 2)
+        {
+            return nodeIndex;
+        }
+
+        u32 leftIndex = node.m_left;
+        u32 rightIndex = node.m_right;
+        s32 balance = m_nodes[rightIndex].m_height - m_nodes[leftIndex].m_height;
+
+        // If one subtree is too tall, its root is rotated up into the position of this node,
+        // this node takes its place and adopts the shorter of its children.
+        u32 raisedIndex = k_null;
+        if (balance > 1)
+        {
+            raisedIndex = rightIndex;
+        }
+        else if (balance < -1)
+        {
+            raisedIndex = leftIndex;
+        }
+        else
+        {
+            return nodeIndex;
+        }
+
+        Node& raised = m_nodes[raisedIndex];
+        u32 tallerIndex = raised.m_left;
+        u32 shorterIndex = raised.m_right;
+        if (m_nodes[tallerIndex].m_height < m_nodes[shorterIndex].m_height)
+        {
+            std::swap(tallerIndex, shorterIndex);
+        }
+
+        raised.m_parent = node.m_parent;
+        node.m_parent = raisedIndex;
+
+        if (raised.m_parent == k_null)
+        {
+            m_root = raisedIndex;
+        }
+        else if (m_nodes[raised.m_parent].m_left == nodeIndex)
+        {
+            m_nodes[raised.m_parent].m_left = raisedIndex;
+        }
+        else
+        {
+            m_nodes[raised.m_parent].m_right = raisedIndex;
+        }
+
+        raised.m_left = nodeIndex;
+        raised.m_right = tallerIndex;
+
+        if (raisedIndex == rightIndex)
+        {
+            node.m_right = shorterIndex;
+        }
+        else
+        {
+            node.m_left = shorterIndex;
+        }
+        m_nodes[shorterIndex].m_parent = nodeIndex;
+
+        UpdateFromChildren(nodeIndex);
+        UpdateFromChildren(raisedIndex);
+        return raisedIndex;
+    }
+
+    //------------------------------------------------------------------------------
+    void BoundingVolumeHierarchy::UpdateFromChildren(u32 nodeIndex) noexcept
+    {
+        Node& node = m_nodes[nodeIndex];
+        const Node& left = m_nodes[node.m_left];
+        const Node& right = m_nodes[node.m_right];
+
+        node.m_min = Vector3::Min(left.m_min, right.m_min);
+        node.m_max = Vector3::Max(left.m_max, right.m_max);
+        node.m_height = 1 + std::max(left.m_height, right.m_height);
+    }
+
+    //------------------------------------------------------------------------------
+    BoundingVolumeHierarchy::~BoundingVolumeHierarchy() noexcept
+    {
+        for (const auto& node : m_nodes)
+        {
+            if (node.m_volumeComponent != nullptr)
+            {
+                node.m_volumeComponent->m_volumeHierarchy = nullptr;
+            }
+        }
+    }
+}
@@ -0,0 +1,223 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_VOLUME_BOUNDINGVOLUMEHIERARCHY_H_
+#define _CHILLISOURCE_CORE_VOLUME_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Event/EventConnection.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A dynamic bounding volume hierarchy over the world space AABBs of the volume
+    /// components in a scene, allowing ray casts and overlap queries to skip whole regions
+    /// of the scene rather than testing every volume.
+    ///
+    /// Each leaf stores an enlarged copy of its volume's AABB. The leaves of volumes whose
+    /// entity transform has changed, or which have reported a change to their bounds, are
+    /// refitted lazily prior to the next query: if the new bounds are still within the
+    /// enlarged bounds nothing needs to be done, otherwise the leaf is re-inserted. The tree
+    /// is kept balanced with rotations as leaves are inserted and removed.
+    ///
+    /// Queries use the AABB of each volume to find candidates; ray casts then test the
+    /// volume's OOBB, matching Scene::QuerySceneForIntersection().
+    ///
+    /// This is not thread-safe and should only be used on the main thread.
+    ///
+    class BoundingVolumeHierarchy final
+    {
+    public:
+        CS_DECLARE_NOCOPY(BoundingVolumeHierarchy);
+
+        BoundingVolumeHierarchy() noexcept;
+
+        /// Adds the given volume to the hierarchy. The volume must not already be in a
+        /// hierarchy, and must be attached to an entity. It will be inserted into the tree
+        /// prior to the next query.
+        ///
+        /// @param volumeComponent
+        ///     The volume to add.
+        ///
+        void Add(VolumeComponent* volumeComponent) noexcept;
+
+        /// Removes the given volume from the hierarchy.
+        ///
+        /// @param volumeComponent
+        ///     The volume to remove.
+        ///
+        void Remove(VolumeComponent* volumeComponent) noexcept;
+
+        /// Flags the bounds of the given volume as changed, so its leaf is refitted prior
+        /// to the next query. Changes to the volume's entity transform are tracked
+        /// automatically, so this only needs to be called when the bounds change for other
+        /// reasons.
+        ///
+        /// @param volumeComponent
+        ///     The volume, which must be in this hierarchy.
+        ///
+        void Invalidate(VolumeComponent* volumeComponent) noexcept;
+
+        /// Finds the volume with the nearest intersection with the given ray. The ray is
+        /// tested against the OOBB of each candidate volume.
+        ///
+        /// @param ray
+        ///     The ray.
+        ///
+        /// @return The nearest intersecting volume, or null if there isn't one. Its query
+        /// intersection value is set to the distance along the ray of the intersection.
+        ///
+        VolumeComponent* RaycastNearest(const Ray& ray) noexcept;
+
+        /// Finds all volumes which intersect the given ray. The ray is tested against the
+        /// OOBB of each candidate volume.
+        ///
+        /// @param ray
+        ///     The ray.
+        /// @param out_volumeComponents
+        ///     (Out) The list to append the intersecting volumes to, in an undefined order.
+        ///     The query intersection value of each is set to the distance along the ray of
+        ///     its intersection.
+        ///
+        void RaycastAll(const Ray& ray, std::vector<VolumeComponent*>& out_volumeComponents) noexcept;
+
+        /// Finds all volumes whose AABB overlaps the given sphere.
+        ///
+        /// @param sphere
+        ///     The sphere.
+        /// @param out_volumeComponents
+        ///     (Out) The list to append the overlapping volumes to, in an undefined order.
+        ///
+        void QueryOverlaps(const Sphere& sphere, std::vector<VolumeComponent*>& out_volumeComponents) noexcept;
+
+        /// Finds all volumes whose AABB overlaps the given AABB.
+        ///
+        /// @param aabb
+        ///     The AABB.
+        /// @param out_volumeComponents
+        ///     (Out) The list to append the overlapping volumes to, in an undefined order.
+        ///
+        void QueryOverlaps(const AABB& aabb, std::vector<VolumeComponent*>& out_volumeComponents) noexcept;
+
+        /// @return The number of volumes in the hierarchy.
+        ///
+        u32 GetNumVolumes() const noexcept { return m_numVolumes; }
+
+        ~BoundingVolumeHierarchy() noexcept;
+
+    private:
+        /// A node in the tree. Leaf nodes refer to a single volume and have no children.
+        /// Nodes which are not in use are chained together in the free list through their
+        /// parent index.
+        ///
+        struct Node final
+        {
+            Vector3 m_min;
+            Vector3 m_max;
+            u32 m_parent;
+            u32 m_left;
+            u32 m_right;
+            s32 m_height;
+            VolumeComponent* m_volumeComponent;
+            bool m_isInTree;
+            bool m_isDirty;
+        };
+
+        /// @return The index of a newly allocated node.
+        ///
+        u32 AllocateNode() noexcept;
+
+        /// Returns the given node to the free list.
+        ///
+        /// @param nodeIndex
+        ///     The index of the node.
+        ///
+        void FreeNode(u32 nodeIndex) noexcept;
+
+        /// Flags the given leaf as needing to be refitted.
+        ///
+        /// @param leafIndex
+        ///     The index of the leaf node.
+        ///
+        void MarkDirty(u32 leafIndex) noexcept;
+
+        /// Refits all dirty leaves to the current bounds of their volumes, inserting any
+        /// which are not yet in the tree.
+        ///
+        void RefitDirtyLeaves() noexcept;
+
+        /// Inserts the given leaf into the tree, next to the sibling which gives the lowest
+        /// increase in surface area.
+        ///
+        /// @param leafIndex
+        ///     The index of the leaf node.
+        ///
+        void InsertLeaf(u32 leafIndex) noexcept;
+
+        /// Removes the given leaf from the tree. The leaf node itself is not freed.
+        ///
+        /// @param leafIndex
+        ///     The index of the leaf node.
+        ///
+        void RemoveLeaf(u32 leafIndex) noexcept;
+
+        /// Recalculates the bounds and height of each node from the given node up to the
+        /// root, rebalancing as required.
+        ///
+        /// @param nodeIndex
+        ///     The index of the first node to update.
+        ///
+        void RefitAncestors(u32 nodeIndex) noexcept;
+
+        /// Performs a single rotation at the given node if its subtrees differ in height by
+        /// more than one.
+        ///
+        /// @param nodeIndex
+        ///     The index of the node.
+        ///
+        /// @return The index of the node now at the position of the given node.
+        ///
+        u32 Balance(u32 nodeIndex) noexcept;
+
+        /// Recalculates the bounds and height of the given internal node from its children.
+        ///
+        /// @param nodeIndex
+        ///     The index of the node.
+        ///
+        void UpdateFromChildren(u32 nodeIndex) noexcept;
+
+        std::vector<Node> m_nodes;
+        std::vector<EventConnectionUPtr> m_transformChangedConnections;
+        std::vector<u32> m_dirtyLeaves;
+        std::vector<u32> m_traversalStack;
+        u32 m_root;
+        u32 m_freeList;
+        u32 m_numVolumes = 0;
+    };
+}
+
+#endif
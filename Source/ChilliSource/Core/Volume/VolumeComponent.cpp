@@ -28,7 +28,19 @@
 
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <ChilliSource/Core/Volume/BoundingVolumeHierarchy.h>
+
 namespace ChilliSource
 {
     CS_DEFINE_NAMEDTYPE(VolumeComponent);
+    
+    //----------------------------------------------------
+    //----------------------------------------------------
+    void VolumeComponent::OnVolumeChanged() noexcept
+    {
+        if (m_volumeHierarchy != nullptr)
+        {
+            m_volumeHierarchy->Invalidate(this);
+        }
+    }
 }
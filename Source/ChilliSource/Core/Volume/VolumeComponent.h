@@ -83,6 +83,22 @@ namespace ChilliSource
         virtual bool IsVisible() const = 0;
 
         f32 mfQueryIntersectionValue;
+        
+    protected:
+        //----------------------------------------------------
+        /// Informs the scene that the bounds of this volume
+        /// have changed, so that scene intersection queries
+        /// use the new bounds. Changes to the entity transform
+        /// are tracked automatically, so this only needs to be
+        /// called when the bounds change for other reasons.
+        //----------------------------------------------------
+        void OnVolumeChanged() noexcept;
+        
+    private:
+        friend class BoundingVolumeHierarchy;
+        
+        BoundingVolumeHierarchy* m_volumeHierarchy = nullptr;
+        u32 m_volumeHierarchyLeaf = 0;
     };
 }
 
@@ -29,7 +29,6 @@
 #include <ChilliSource/Input/Gesture/GestureSystem.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Input/Base/InputFilter.h>
 #include <ChilliSource/Input/Gesture/Gesture.h>
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
@@ -180,10 +179,10 @@ namespace ChilliSource
         PointerSystem* pointerSystem = Application::Get()->GetSystem<PointerSystem>();
         CS_ASSERT(pointerSystem != nullptr, "Gesture system missing required system: Pointer System");
         
-        m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(MakeDelegate(this, &GestureSystem::OnPointerDown));
-        m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(MakeDelegate(this, &GestureSystem::OnPointerMoved));
-        m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(MakeDelegate(this, &GestureSystem::OnPointerUp));
-        m_pointerScrolledConnection = pointerSystem->GetPointerScrollEventInternal().OpenConnection(MakeDelegate(this, &GestureSystem::OnPointerScrolled));
+        m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(this, &GestureSystem::OnPointerDown);
+        m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(this, &GestureSystem::OnPointerMoved);
+        m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(this, &GestureSystem::OnPointerUp);
+        m_pointerScrolledConnection = pointerSystem->GetPointerScrollEventInternal().OpenConnection(this, &GestureSystem::OnPointerScrolled);
     }
     //--------------------------------------------------------
     //--------------------------------------------------------
@@ -25,6 +25,7 @@
 #include <ChilliSource/Rendering/Base/ForwardRenderPassCompiler.h>
 
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
+#include <ChilliSource/Core/Threading/TaskGraph.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/RenderPasses.h>
 #include <ChilliSource/Rendering/Base/RenderFrame.h>
@@ -40,6 +41,8 @@ namespace ChilliSource
 {
     namespace
     {
+        constexpr u32 k_minObjectsPerGatherTask = 512;
+        
         /// Converts the given RenderObject to a RenderPassObject using the given RenderMaterial.
         /// if the given RenderMaterial does not exist in the RenderMaterialGroup contained by
         /// the RenderObject, then this will assert.
@@ -139,8 +142,10 @@ namespace ChilliSource
         }
         
         /// Filters the given list of objects to return only the objects which are a part of the requested
-        /// layer.
+        /// layer. Large lists are filtered in parallel, and the output is in the same order as the input.
         ///
+        /// @param taskContext
+        ///     Context to manage any spawned tasks
         /// @param renderLayer
         ///     The render layer to filter on.
         /// @param renderObjects
@@ -148,276 +153,120 @@ namespace ChilliSource
         ///
         /// @return The list of render objects for the requested layer.
         ///
-        std::vector<RenderObject> GetLayerRenderObjects(RenderLayer renderLayer, const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderObject> GetLayerRenderObjects(const TaskContext& taskContext, RenderLayer renderLayer, const std::vector<RenderObject>& renderObjects) noexcept
         {
-            std::vector<RenderObject> layerRenderObjects;
-            
-            for (const auto& renderObject : renderObjects)
+            return taskContext.ParallelReduce(u32(renderObjects.size()), k_minObjectsPerGatherTask, std::vector<RenderObject>(),
+            [&renderObjects, renderLayer](const TaskContext& innerTaskContext, u32 start, u32 end, std::vector<RenderObject>& layerRenderObjects)
             {
-                if (renderObject.GetRenderLayer() == renderLayer)
+                for (u32 i = start; i < end; ++i)
                 {
-                    layerRenderObjects.push_back(renderObject);
+                    if (renderObjects[i].GetRenderLayer() == renderLayer)
+                    {
+                        layerRenderObjects.push_back(renderObjects[i]);
+                    }
                 }
-            }
-            
-            return layerRenderObjects;
+            },
+            [](std::vector<RenderObject>& layerRenderObjects, std::vector<RenderObject>&& chunkLayerRenderObjects)
+            {
+                layerRenderObjects.insert(layerRenderObjects.end(), chunkLayerRenderObjects.begin(), chunkLayerRenderObjects.end());
+            });
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a ShadowMap pass defined, and has shadow casting
-        /// enabled.
+        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for each
+        /// RenderObject that has the given pass defined. Only shadow casting objects are
+        /// included in the shadow map pass. Large lists are parsed in parallel, and the output
+        /// is in the same order as the input.
         ///
+        /// @param taskContext
+        ///     Context to manage any spawned tasks
         /// @param renderObjects
         ///     A list of RenderObjects to parse
+        /// @param renderPass
+        ///     The pass to generate RenderPassObjects for.
         ///
-        /// @return The collection of RenderPassObjects.
+        /// @return A collection of RenderPassObjects, one for each RenderObject with the pass.
         ///
-        std::vector<RenderPassObject> GetShadowMapRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderPassObject> GetRenderPassObjects(const TaskContext& taskContext, const std::vector<RenderObject>& renderObjects, RenderPasses renderPass) noexcept
         {
-            std::vector<RenderPassObject> baseRenderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
+            return taskContext.ParallelReduce(u32(renderObjects.size()), k_minObjectsPerGatherTask, std::vector<RenderPassObject>(),
+            [&renderObjects, renderPass](const TaskContext& innerTaskContext, u32 start, u32 end, std::vector<RenderPassObject>& renderPassObjects)
             {
-                if (renderObject.ShouldCastShadows())
+                for (u32 i = start; i < end; ++i)
                 {
-                    auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_shadowMap));
+                    const auto& renderObject = renderObjects[i];
+                    if (renderPass == RenderPasses::k_shadowMap && !renderObject.ShouldCastShadows())
+                    {
+                        continue;
+                    }
+                    
+                    auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(renderPass));
                     
                     if (renderMaterial)
                     {
-                        baseRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                        renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
                     }
                 }
-            }
-            
-            return baseRenderPassObjects;
-        }
-        
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Base pass defined.
-        ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
-        ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Base pass
-        ///
-        std::vector<RenderPassObject> GetBaseRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
-        {
-            std::vector<RenderPassObject> baseRenderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
-            {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_base));
-                
-                if (renderMaterial)
-                {
-                    baseRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                }
-            }
-            
-            return baseRenderPassObjects;
-        }
-        
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Skybox pass defined.
-        ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
-        ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Skybox pass
-        ///
-        std::vector<RenderPassObject> GetSkyboxRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
-        {
-            std::vector<RenderPassObject> renderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
+            },
+            [](std::vector<RenderPassObject>& renderPassObjects, std::vector<RenderPassObject>&& chunkRenderPassObjects)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_skybox));
-                
-                if (renderMaterial)
-                {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                }
-            }
-            
-            return renderPassObjects;
+                renderPassObjects.insert(renderPassObjects.end(), chunkRenderPassObjects.begin(), chunkRenderPassObjects.end());
+            });
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has either a DirectionalLight or DirectionalLightShadows
-        /// pass defined, depending on the type of directional light.
-        ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
         /// @param directionalRenderLight
-        ///     The directional light to get objects for.
+        ///     The directional light.
         ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Directional pass
+        /// @return The pass used to render the given directional light, which depends on
+        ///     whether or not it casts shadows.
         ///
-        std::vector<RenderPassObject> GetDirectionalLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const DirectionalRenderLight& directionalRenderLight) noexcept
+        RenderPasses GetDirectionalLightRenderPass(const DirectionalRenderLight& directionalRenderLight) noexcept
         {
-            RenderPasses passType = RenderPasses::k_directionalLight;
-            if (directionalRenderLight.GetShadowMapTarget())
-            {
-                passType = RenderPasses::k_directionalLightShadows;
-            }
-            
-            std::vector<RenderPassObject> renderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
-            {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(passType));
-                
-                if (renderMaterial)
-                {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                }
-            }
-            
-            return renderPassObjects;
+            return directionalRenderLight.GetShadowMapTarget() ? RenderPasses::k_directionalLightShadows : RenderPasses::k_directionalLight;
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a PointLight pass defined, and is within the range
-        /// of influence of the given light.
+        /// Generates a list of RenderPassObjects for each visible RenderObject in the standard
+        /// layer of the frame that has a PointLight pass defined, and is within the range of
+        /// influence of the given light. Only objects near the light, as reported by the
+        /// frame's spatial index, are considered.
         ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        /// @param renderFrame
+        ///     The render frame containing the objects and spatial index.
         /// @param pointRenderLight
         ///     The render light to get objects for.
         ///
         /// @return A collection of RenderPassObjects for the render light pass.
         ///
-        std::vector<RenderPassObject> GetPointLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const PointRenderLight& pointRenderLight) noexcept
+        std::vector<RenderPassObject> GetPointLightRenderPassObjects(const RenderFrame& renderFrame, const PointRenderLight& pointRenderLight) noexcept
         {
             Sphere pointLightBoundingSphere(pointRenderLight.GetPosition(), pointRenderLight.GetRangeOfInfluence());
             
+            std::vector<u32> nearbyObjectIndices;
+            renderFrame.GetStandardRenderObjectGrid().GetPotentiallyIntersecting(pointLightBoundingSphere, nearbyObjectIndices);
+            
+            const auto& renderObjects = renderFrame.GetRenderObjects();
+            const auto& cameraFrustum = renderFrame.GetRenderCamera().GetFrustrum();
+            
             std::vector<RenderPassObject> renderPassObjects;
             
-            for (const auto& renderObject : renderObjects)
+            for (auto objectIndex : nearbyObjectIndices)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_pointLight));
+                const auto& renderObject = renderObjects[objectIndex];
+                CS_ASSERT(renderObject.GetRenderLayer() == RenderLayer::k_standard, "Point light passes should only contain standard layer objects.");
                 
-                if (renderMaterial && pointLightBoundingSphere.Contains(renderObject.GetBoundingSphere()))
+                if (!pointLightBoundingSphere.Contains(renderObject.GetBoundingSphere()) || !cameraFrustum.SphereCullTest(renderObject.GetBoundingSphere()))
                 {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    continue;
                 }
-            }
-            
-            return renderPassObjects;
-        }
-        
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Transparent pass defined.
-        ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
-        ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Transparent pass
-        ///
-        std::vector<RenderPassObject> GetTransparentRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
-        {
-            std::vector<RenderPassObject> transparentRenderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
-            {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_transparent));
+                
+                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_pointLight));
                 
                 if (renderMaterial)
                 {
-                    transparentRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
                 }
             }
             
-            return transparentRenderPassObjects;
-        }
-        
-        /// Gather all render objects in the frame that are to be renderered into the default RenderTarget
-        /// and parse them into different RenderPasses for each light source plus the required Base pass but
-        /// not the transparent pass (as the skybox must be rendered in between). These passes are then compiled into a CameraRenderPassGroup.
-        ///
-        /// @param taskContext
-        ///     Context to manage any spawned tasks
-        /// @param renderFrame
-        ///     Current frame data
-        ///
-        /// @return The CameraRenderPassGroup
-        ///
-        CameraRenderPassGroup CompileOpaqueSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
-        {
-            auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-            auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
-            
-            u32 numPasses = CalcNumSceneOpaquePasses(renderFrame);
-            std::vector<RenderPass> renderPasses(numPasses);
-            std::vector<Task> tasks;
-            u32 nextPassIndex = 0;
-            
-            // Base pass
-            u32 basePassIndex = nextPassIndex++;
-            tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects](const TaskContext& innerTaskContext)
-            {
-                auto renderPassObjects = GetBaseRenderPassObjects(visibleStandardRenderObjects);
-                RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
-                renderPasses[basePassIndex] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
-            });
-            
-            // Directional light pass
-            for (const auto& directionalLight : renderFrame.GetDirectionalRenderLights())
-            {
-                u32 directionLightPassIndex = nextPassIndex++;
-                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &directionalLight](const TaskContext& innerTaskContext)
-                {
-                    auto renderPassObjects = GetDirectionalLightRenderPassObjects(visibleStandardRenderObjects, directionalLight);
-                    RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
-                    renderPasses[directionLightPassIndex] = RenderPass(directionalLight, std::move(renderPassObjects));
-                });
-            }
-            
-            // Point light pass
-            for (const auto& pointLight : renderFrame.GetPointRenderLights())
-            {
-                u32 pointLightPassIndex = nextPassIndex++;
-                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &pointLight](const TaskContext& innerTaskContext)
-                {
-                    auto renderPassObjects = GetPointLightRenderPassObjects(visibleStandardRenderObjects, pointLight);
-                    RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
-                    renderPasses[pointLightPassIndex] = RenderPass(pointLight, std::move(renderPassObjects));
-                });
-            }
-            
-            taskContext.ProcessChildTasks(tasks);
-            
-            return CameraRenderPassGroup(renderFrame.GetRenderCamera(), std::move(renderPasses));
-        }
-        
-        /// Gather all render objects in the frame that are to be renderered into the default RenderTarget
-        /// for the transpaent pass. These passes are then compiled into a CameraRenderPassGroup.
-        ///
-        /// @param taskContext
-        ///     Context to manage any spawned tasks
-        /// @param renderFrame
-        ///     Current frame data
-        ///
-        /// @return The CameraRenderPassGroup
-        ///
-        CameraRenderPassGroup CompileTransparentSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
-        {
-            std::vector<RenderPass> renderPasses(1);
-            std::vector<Task> tasks;
-
-            tasks.push_back([=, &renderPasses, &renderFrame](const TaskContext& innerTaskContext)
-            {
-                auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-                auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
-                
-                auto renderPassObjects = GetTransparentRenderPassObjects(visibleStandardRenderObjects);
-                RenderPassObjectSorter::TransparentSort(renderFrame.GetRenderCamera(), renderPassObjects);
-                renderPasses[0] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
-            });
-            
-            taskContext.ProcessChildTasks(tasks);
-            
-            return CameraRenderPassGroup(renderFrame.GetRenderCamera(), std::move(renderPasses));
+            return renderPassObjects;
         }
         
         /// Gathers all Skybox render objects in the frame that are to be rendered to the default Render Target
@@ -439,8 +288,8 @@ namespace ChilliSource
             //Use the main camera but ignore any scale or translation, as if the camera was at the origin
             RenderCamera camera(Matrix4::CreateRotation(renderFrame.GetRenderCamera().GetOrientation()), renderFrame.GetRenderCamera().GetProjectionMatrix(), renderFrame.GetRenderCamera().GetOrientation());
             
-            auto renderObjects = GetLayerRenderObjects(RenderLayer::k_skybox, renderFrame.GetRenderObjects());
-            auto renderPassObjects = GetSkyboxRenderPassObjects(renderObjects);
+            auto renderObjects = GetLayerRenderObjects(taskContext, RenderLayer::k_skybox, renderFrame.GetRenderObjects());
+            auto renderPassObjects = GetRenderPassObjects(taskContext, renderObjects, RenderPasses::k_skybox);
             CS_ASSERT(renderObjects.size() == renderPassObjects.size(), "Invalid number of render pass objects in skybox pass. All render objects in the Skybox layer should have a skybox material.");
             
             std::vector<RenderPass> renderPasses;
@@ -470,10 +319,10 @@ namespace ChilliSource
             auto projMatrix = Matrix4::CreateOrthographicProjectionLH(0, f32(renderFrame.GetResolution().x), 0, f32(renderFrame.GetResolution().y), k_near, k_far);
             RenderCamera uiCamera(Matrix4::k_identity, projMatrix, Quaternion::k_identity);
             
-            auto uiRenderObjects = GetLayerRenderObjects(RenderLayer::k_ui, renderFrame.GetRenderObjects());
+            auto uiRenderObjects = GetLayerRenderObjects(taskContext, RenderLayer::k_ui, renderFrame.GetRenderObjects());
             auto visibleUIRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, uiCamera, uiRenderObjects);
             
-            auto uiRenderPassObjects = GetTransparentRenderPassObjects(visibleUIRenderObjects);
+            auto uiRenderPassObjects = GetRenderPassObjects(taskContext, visibleUIRenderObjects, RenderPasses::k_transparent);
             CS_ASSERT(visibleUIRenderObjects.size() == uiRenderPassObjects.size(), "Invalid number of render pass objects in transparent pass. All render objects in the UI layer should have a transparent material.");
             
             RenderPassObjectSorter::PrioritySort(uiRenderPassObjects);
@@ -487,96 +336,184 @@ namespace ChilliSource
             return CameraRenderPassGroup(uiCamera, std::move(renderPasses));
         }
         
-        /// Gather all render objects in the frame that are to be renderered into the default RenderTarget
+        /// Gather all render objects in the frame that are to be renderered into a shadow RenderTarget
         /// into a TargetRenderPassGroup.
         ///
         /// @param taskContext
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param directionalRenderLight
+        ///     The directional light that should have a shadow map built for it.
+        /// @param visibleStandardRenderObjects
+        ///     The standard layer objects in the frame which are visible to the frame's camera.
         ///
         /// @return The TargetRenderPassGroup
         ///
-        TargetRenderPassGroup CompileMainTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+        TargetRenderPassGroup CompileShadowMapTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const DirectionalRenderLight& directionalRenderLight,
+                                                                    const std::vector<RenderObject>& visibleStandardRenderObjects) noexcept
         {
-            constexpr u32 k_numGroups = 4;
+            CS_ASSERT(directionalRenderLight.GetShadowMapTarget(), "Cannot compile shadow map target with light that has no shadow map target.");
             
-            std::vector<CameraRenderPassGroup> cameraRenderPassGroups(k_numGroups);
-            std::vector<Task> tasks;
-            u32 nextIndex = 0;
+            RenderCamera camera(directionalRenderLight.GetLightWorldMatrix(), directionalRenderLight.GetLightProjectionMatrix(), directionalRenderLight.GetLightOrientation());
             
-            // Scene camera group - Opaque
-            u32 sceneIndexO = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
-            {
-                cameraRenderPassGroups[sceneIndexO] = CompileOpaqueSceneCameraRenderPassGroup(innerTaskContext, renderFrame);
-            });
+            auto renderPassObjects = GetRenderPassObjects(taskContext, visibleStandardRenderObjects, RenderPasses::k_shadowMap);
+            RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+            RenderPass renderPass(std::move(renderPassObjects));
+            
+            std::vector<RenderPass> renderPasses;
+            renderPasses.push_back(std::move(renderPass));
+            CameraRenderPassGroup cameraRenderPassGroup(camera, std::move(renderPasses));
             
-            // Skybox camera group - Rendered after the other scene objects to reduce overdraw. The shader and material settings ensure
-            // that depth testing isn't an issue.
-            u32 skyboxIndex = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            std::vector<CameraRenderPassGroup> cameraRenderPassGroups;
+            cameraRenderPassGroups.push_back(std::move(cameraRenderPassGroup));
+            return TargetRenderPassGroup(directionalRenderLight.GetShadowMapTarget(), Colour::k_black, std::move(cameraRenderPassGroups));
+        }
+        
+        /// The intermediate results of compiling the targets for a single frame. These are written by the
+        /// nodes of the render pass task graph, and then assembled once the graph has been processed.
+        ///
+        struct FrameTargetData final
+        {
+            u32 m_mainTargetIndex = 0;
+            std::vector<RenderObject> m_visibleStandardRenderObjects;
+            std::vector<RenderPass> m_opaqueRenderPasses;
+            RenderPass m_transparentRenderPass;
+            CameraRenderPassGroup m_skyboxCameraRenderPassGroup;
+            CameraRenderPassGroup m_uiCameraRenderPassGroup;
+        };
+        
+        /// Adds the nodes required to compile all targets in the given frame to the task graph. The standard
+        /// layer visibility is calculated once, and all passes which depend on it wait for only that node.
+        /// All other passes, including the UI and skybox passes, can run immediately.
+        ///
+        /// @param renderFrame
+        ///     The frame to add nodes for.
+        /// @param frameTargetData
+        ///     The intermediate results for the frame which will be written by the nodes.
+        /// @param out_targetRenderPassGroups
+        ///     (Out) The list of target render pass groups. Shadow map targets will be written directly
+        ///     to this when the nodes are processed.
+        /// @param inout_nextTargetIndex
+        ///     (In/Out) The index of the next target in the target list.
+        /// @param out_taskGraph
+        ///     (Out) The task graph to add the nodes to.
+        ///
+        void AddFrameTargetNodes(const RenderFrame& renderFrame, FrameTargetData& frameTargetData, std::vector<TargetRenderPassGroup>& out_targetRenderPassGroups, u32& inout_nextTargetIndex,
+                                 TaskGraph& out_taskGraph) noexcept
+        {
+            auto visibilityNode = out_taskGraph.AddNode("Standard Visibility", [&renderFrame, &frameTargetData](const TaskContext& innerTaskContext)
             {
-                cameraRenderPassGroups[skyboxIndex] = CompileSkyboxCameraRenderPassGroup(innerTaskContext, renderFrame);
+                auto standardRenderObjects = GetLayerRenderObjects(innerTaskContext, RenderLayer::k_standard, renderFrame.GetRenderObjects());
+                frameTargetData.m_visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(innerTaskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
             });
             
-            // Scene camera group - Transparent
-            u32 sceneIndexT = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            // Shadow targets
+            for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
             {
-                cameraRenderPassGroups[sceneIndexT] = CompileTransparentSceneCameraRenderPassGroup(innerTaskContext, renderFrame);
-            });
+                if (directionalRenderLight.GetShadowMapTarget())
+                {
+                    u32 shadowTargetIndex = inout_nextTargetIndex++;
+                    auto shadowNode = out_taskGraph.AddNode("Shadow Map Target", [=, &renderFrame, &frameTargetData, &out_targetRenderPassGroups, &directionalRenderLight](const TaskContext& innerTaskContext)
+                    {
+                        out_targetRenderPassGroups[shadowTargetIndex] = CompileShadowMapTargetRenderPassGroup(innerTaskContext, renderFrame, directionalRenderLight, frameTargetData.m_visibleStandardRenderObjects);
+                    });
+                    out_taskGraph.AddDependency(shadowNode, visibilityNode);
+                }
+            }
+            
+            // Main target (screen or offscreen target)
+            frameTargetData.m_mainTargetIndex = inout_nextTargetIndex++;
+            frameTargetData.m_opaqueRenderPasses.resize(CalcNumSceneOpaquePasses(renderFrame));
+            u32 nextPassIndex = 0;
             
-            // UI camera group
-            u32 uiIndex = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            // Base pass
+            u32 basePassIndex = nextPassIndex++;
+            auto baseNode = out_taskGraph.AddNode("Base Pass", [=, &renderFrame, &frameTargetData](const TaskContext& innerTaskContext)
             {
-                cameraRenderPassGroups[uiIndex] = CompileUICameraRenderPassGroup(innerTaskContext, renderFrame);
+                auto renderPassObjects = GetRenderPassObjects(innerTaskContext, frameTargetData.m_visibleStandardRenderObjects, RenderPasses::k_base);
+                RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+                frameTargetData.m_opaqueRenderPasses[basePassIndex] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
             });
+            out_taskGraph.AddDependency(baseNode, visibilityNode);
             
-            taskContext.ProcessChildTasks(tasks);
-            
-            if(renderFrame.GetOffscreenRenderTarget() == nullptr)
+            // Directional light passes
+            for (const auto& directionalLight : renderFrame.GetDirectionalRenderLights())
             {
-                return TargetRenderPassGroup(renderFrame.GetResolution(), renderFrame.GetClearColour(), std::move(cameraRenderPassGroups));
+                u32 directionalLightPassIndex = nextPassIndex++;
+                auto directionalLightNode = out_taskGraph.AddNode("Directional Light Pass", [=, &renderFrame, &frameTargetData, &directionalLight](const TaskContext& innerTaskContext)
+                {
+                    auto renderPassObjects = GetRenderPassObjects(innerTaskContext, frameTargetData.m_visibleStandardRenderObjects, GetDirectionalLightRenderPass(directionalLight));
+                    RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+                    frameTargetData.m_opaqueRenderPasses[directionalLightPassIndex] = RenderPass(directionalLight, std::move(renderPassObjects));
+                });
+                out_taskGraph.AddDependency(directionalLightNode, visibilityNode);
             }
-            else
+            
+            // Point light passes. These use the frame's spatial index rather than the visible object list.
+            for (const auto& pointLight : renderFrame.GetPointRenderLights())
             {
-                return TargetRenderPassGroup(renderFrame.GetOffscreenRenderTarget(), renderFrame.GetClearColour(), std::move(cameraRenderPassGroups));
+                u32 pointLightPassIndex = nextPassIndex++;
+                out_taskGraph.AddNode("Point Light Pass", [=, &renderFrame, &frameTargetData, &pointLight](const TaskContext& innerTaskContext)
+                {
+                    auto renderPassObjects = GetPointLightRenderPassObjects(renderFrame, pointLight);
+                    RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+                    frameTargetData.m_opaqueRenderPasses[pointLightPassIndex] = RenderPass(pointLight, std::move(renderPassObjects));
+                });
             }
+            
+            // Transparent pass
+            auto transparentNode = out_taskGraph.AddNode("Transparent Pass", [&renderFrame, &frameTargetData](const TaskContext& innerTaskContext)
+            {
+                auto renderPassObjects = GetRenderPassObjects(innerTaskContext, frameTargetData.m_visibleStandardRenderObjects, RenderPasses::k_transparent);
+                RenderPassObjectSorter::TransparentSort(renderFrame.GetRenderCamera(), renderPassObjects);
+                frameTargetData.m_transparentRenderPass = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
+            });
+            out_taskGraph.AddDependency(transparentNode, visibilityNode);
+            
+            // Skybox pass
+            out_taskGraph.AddNode("Skybox Pass", [&renderFrame, &frameTargetData](const TaskContext& innerTaskContext)
+            {
+                frameTargetData.m_skyboxCameraRenderPassGroup = CompileSkyboxCameraRenderPassGroup(innerTaskContext, renderFrame);
+            });
+            
+            // UI pass
+            out_taskGraph.AddNode("UI Pass", [&renderFrame, &frameTargetData](const TaskContext& innerTaskContext)
+            {
+                frameTargetData.m_uiCameraRenderPassGroup = CompileUICameraRenderPassGroup(innerTaskContext, renderFrame);
+            });
         }
         
-        /// Gather all render objects in the frame that are to be renderered into a shadow RenderTarget
-        /// into a TargetRenderPassGroup.
+        /// Assembles the main target of a frame from the results of the processed task graph.
         ///
-        /// @param taskContext
-        ///     Context to manage any spawned tasks
         /// @param renderFrame
-        ///     Current frame data
-        /// @param directionalRenderLight
-        ///     The directional light that should have a shadow map built for it.
+        ///     The frame.
+        /// @param frameTargetData
+        ///     The intermediate results for the frame. These will be moved from.
         ///
-        /// @return The TargetRenderPassGroup
+        /// @return The main TargetRenderPassGroup.
         ///
-        TargetRenderPassGroup CompileShadowMapTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const DirectionalRenderLight& directionalRenderLight) noexcept
+        TargetRenderPassGroup AssembleMainTargetRenderPassGroup(const RenderFrame& renderFrame, FrameTargetData& frameTargetData) noexcept
         {
-            CS_ASSERT(directionalRenderLight.GetShadowMapTarget(), "Cannot compile shadow map target with light that has no shadow map target.");
-            
-            RenderCamera camera(directionalRenderLight.GetLightWorldMatrix(), directionalRenderLight.GetLightProjectionMatrix(), directionalRenderLight.GetLightOrientation());
-            
-            auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-            auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
-            auto renderPassObjects = GetShadowMapRenderPassObjects(visibleStandardRenderObjects);
-            RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
-            RenderPass renderPass(std::move(renderPassObjects));
-            
-            std::vector<RenderPass> renderPasses;
-            renderPasses.push_back(std::move(renderPass));
-            CameraRenderPassGroup cameraRenderPassGroup(camera, std::move(renderPasses));
+            std::vector<RenderPass> transparentRenderPasses;
+            transparentRenderPasses.push_back(std::move(frameTargetData.m_transparentRenderPass));
             
+            // The skybox is rendered after the opaque scene objects to reduce overdraw. The shader and material
+            // settings ensure that depth testing isn't an issue.
             std::vector<CameraRenderPassGroup> cameraRenderPassGroups;
-            cameraRenderPassGroups.push_back(std::move(cameraRenderPassGroup));
-            return TargetRenderPassGroup(directionalRenderLight.GetShadowMapTarget(), Colour::k_black, std::move(cameraRenderPassGroups));
+            cameraRenderPassGroups.push_back(CameraRenderPassGroup(renderFrame.GetRenderCamera(), std::move(frameTargetData.m_opaqueRenderPasses)));
+            cameraRenderPassGroups.push_back(std::move(frameTargetData.m_skyboxCameraRenderPassGroup));
+            cameraRenderPassGroups.push_back(CameraRenderPassGroup(renderFrame.GetRenderCamera(), std::move(transparentRenderPasses)));
+            cameraRenderPassGroups.push_back(std::move(frameTargetData.m_uiCameraRenderPassGroup));
+            
+            if(renderFrame.GetOffscreenRenderTarget() == nullptr)
+            {
+                return TargetRenderPassGroup(renderFrame.GetResolution(), renderFrame.GetClearColour(), std::move(cameraRenderPassGroups));
+            }
+            else
+            {
+                return TargetRenderPassGroup(renderFrame.GetOffscreenRenderTarget(), renderFrame.GetClearColour(), std::move(cameraRenderPassGroups));
+            }
         }
     }
     
@@ -590,33 +527,21 @@ namespace ChilliSource
         }
         
         std::vector<TargetRenderPassGroup> targetRenderPassGroups(numTargets);
-        std::vector<Task> tasks;
-        u32 nextPassIndex = 0;
+        std::vector<FrameTargetData> frameTargetsData(renderFrames.size());
+        TaskGraph taskGraph;
+        u32 nextTargetIndex = 0;
         
-        for(const auto& renderFrame : renderFrames)
+        for (std::size_t i = 0; i < renderFrames.size(); ++i)
         {
-            // Shadow targets
-            for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
-            {
-                if (directionalRenderLight.GetShadowMapTarget())
-                {
-                    u32 shadowPassIndex = nextPassIndex++;
-                    tasks.push_back([=, &targetRenderPassGroups, &renderFrame, &directionalRenderLight](const TaskContext& innerTaskContext)
-                    {
-                        targetRenderPassGroups[shadowPassIndex] = CompileShadowMapTargetRenderPassGroup(innerTaskContext, renderFrame, directionalRenderLight);
-                    });
-                }
-            }
-            
-            // Main target (screen or offscreen target)
-            u32 mainPassIndex = nextPassIndex++;
-            tasks.push_back([=, &targetRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
-            {
-                targetRenderPassGroups[mainPassIndex] = CompileMainTargetRenderPassGroup(innerTaskContext, renderFrame);
-            });
+            AddFrameTargetNodes(renderFrames[i], frameTargetsData[i], targetRenderPassGroups, nextTargetIndex, taskGraph);
         }
         
-        taskContext.ProcessChildTasks(tasks);
+        taskContext.ProcessTaskGraph(taskGraph);
+        
+        for (std::size_t i = 0; i < renderFrames.size(); ++i)
+        {
+            targetRenderPassGroups[frameTargetsData[i].m_mainTargetIndex] = AssembleMainTargetRenderPassGroup(renderFrames[i], frameTargetsData[i]);
+        }
         
         return targetRenderPassGroups;
     }
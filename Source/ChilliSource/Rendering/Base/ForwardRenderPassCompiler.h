@@ -39,7 +39,8 @@ namespace ChilliSource
     /// the relevant objects by filtering for material type and visibility. Objects within a render pass
     /// are also sorted into an appropriate order for the type of pass. These render passes are contained
     /// by a TargetRenderPassGroup, which groups passes based on the framebuffer they are targetting.
-    /// All this is processed in a series of background tasks.
+    /// All this is processed as a single graph of background tasks, so passes which don't depend on the
+    /// visibility of the standard layer, such as the UI and skybox passes, don't wait on it.
     ///
     class ForwardRenderPassCompiler final : public IRenderPassCompiler
     {
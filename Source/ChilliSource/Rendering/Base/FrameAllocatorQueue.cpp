@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Base/FrameAllocatorQueue.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     namespace
@@ -37,7 +39,7 @@ namespace ChilliSource
     {
         for (u32 i = 0; i < k_numAllocators; ++i)
         {
-            PagedLinearAllocatorUPtr allocator(new PagedLinearAllocator(k_allocatorPageSize));
+            ConcurrentPagedLinearAllocatorUPtr allocator(new ConcurrentPagedLinearAllocator(k_allocatorPageSize));
             m_queue.push_back(allocator.get());
             m_allocators.push_back(std::move(allocator));
         }
@@ -86,11 +88,16 @@ namespace ChilliSource
         }
 #endif
         
-        for (auto& pagedLinearAllocator : m_allocators)
+        for (auto& frameAllocator : m_allocators)
         {
-            if (pagedLinearAllocator.get() == allocator)
+            if (frameAllocator.get() == allocator)
             {
-                pagedLinearAllocator->Reset();
+                frameAllocator->Reset();
+                
+                m_lastFrameStats = frameAllocator->GetLastResetStats();
+                m_peakFrameStats.m_allocatedBytes = std::max(m_peakFrameStats.m_allocatedBytes, m_lastFrameStats.m_allocatedBytes);
+                m_peakFrameStats.m_numPagesUsed = std::max(m_peakFrameStats.m_numPagesUsed, m_lastFrameStats.m_numPagesUsed);
+
                 m_queue.push_back(allocator);
                 
                 m_condition.notify_one();
@@ -100,4 +107,32 @@ namespace ChilliSource
         
         CS_LOG_FATAL("Cannot push an allocator that is not owned by this queue");
     }
+    
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Stats FrameAllocatorQueue::GetLastFrameStats() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_lastFrameStats;
+    }
+    
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Stats FrameAllocatorQueue::GetPeakFrameStats() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_peakFrameStats;
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 FrameAllocatorQueue::GetNumAllocators() const noexcept
+    {
+        return u32(m_allocators.size());
+    }
+    
+    //------------------------------------------------------------------------------
+    const IAllocator* FrameAllocatorQueue::GetAllocator(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_allocators.size(), "Index out of bounds.");
+        
+        return m_allocators[index].get();
+    }
 }
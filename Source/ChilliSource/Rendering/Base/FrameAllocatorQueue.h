@@ -26,7 +26,7 @@
 #define _CHILLISOURCE_RENDERING_BASE_FRAMEALLOCATORQUEUE_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Memory/PagedLinearAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentPagedLinearAllocator.h>
 
 #include <condition_variable>
 #include <mutex>
@@ -42,6 +42,9 @@ namespace ChilliSource
     /// allocators in the queue. If all are in use, then this will block until one is
     /// returned to the manager.
     ///
+    /// The allocators are thread-safe, giving each thread its own linear arena, so
+    /// per-frame data can be produced on several threads at once.
+    ///
     /// This is thread safe.
     ///
     class FrameAllocatorQueue final
@@ -75,11 +78,36 @@ namespace ChilliSource
         ///
         void Push(IAllocator* allocator) noexcept;
         
+        /// @return The usage of the frame allocator which was most recently pushed back into
+        ///     the queue, i.e. the most recently completed frame.
+        ///
+        ConcurrentPagedLinearAllocator::Stats GetLastFrameStats() const noexcept;
+        
+        /// @return The peak usage of any frame allocator during a single frame.
+        ///
+        ConcurrentPagedLinearAllocator::Stats GetPeakFrameStats() const noexcept;
+        
+        /// @return The number of frame allocators owned by the queue.
+        ///
+        u32 GetNumAllocators() const noexcept;
+        
+        /// This should only be used for reporting, as the allocator may currently be in
+        /// use.
+        ///
+        /// @param index
+        ///     The index of the allocator.
+        ///
+        /// @return The frame allocator with the given index.
+        ///
+        const IAllocator* GetAllocator(u32 index) const noexcept;
+        
     private:
-        std::mutex m_mutex;
+        mutable std::mutex m_mutex;
         std::condition_variable m_condition;
         std::deque<IAllocator*> m_queue;
-        std::vector<PagedLinearAllocatorUPtr> m_allocators;
+        std::vector<ConcurrentPagedLinearAllocatorUPtr> m_allocators;
+        ConcurrentPagedLinearAllocator::Stats m_lastFrameStats;
+        ConcurrentPagedLinearAllocator::Stats m_peakFrameStats;
     };
 }
 
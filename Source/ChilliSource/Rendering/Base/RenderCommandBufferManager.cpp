@@ -98,7 +98,7 @@ namespace ChilliSource
             
             for(auto& command : m_pendingShaderLoadCommands)
             {
-                preRenderCommandList->AddLoadShaderCommand(command.GetRenderShader(), command.GetVertexShader(), command.GetFragmentShader());
+                preRenderCommandList->AddLoadShaderCommand(command.GetRenderShader(), command.GetVertexShader(), command.GetFragmentShader(), command.GetInstancedVertexShader());
             }
             
             for(auto& command : m_pendingTextureLoadCommands)
@@ -35,6 +35,10 @@ namespace ChilliSource
 {
     namespace
     {
+        /// The maximum number of instances rendered by a single render instances command.
+        ///
+        constexpr std::size_t k_maxInstancesPerCommand = 1024;
+        
         /// An container for the current cached state of a render command list.
         ///
         struct RenderCommandListStateCache final
@@ -286,6 +290,42 @@ namespace ChilliSource
             }
         }
         
+        /// Calculates the number of consecutive render pass objects, starting at the given index,
+        /// which can be rendered as instances of the same mesh. Objects can only be instanced if
+        /// they are static and share the same material, mesh and skinned animation. Runs are
+        /// limited to k_maxInstancesPerCommand objects.
+        ///
+        /// @param renderPassObjects
+        ///     The sorted list of render pass objects.
+        /// @param startIndex
+        ///     The index of the first object in the run.
+        ///
+        /// @return The number of objects in the run. This is always at least 1.
+        ///
+        std::size_t CalcNumInstances(const std::vector<RenderPassObject>& renderPassObjects, std::size_t startIndex) noexcept
+        {
+            const auto& first = renderPassObjects[startIndex];
+            if (first.GetType() != RenderPassObject::Type::k_static && first.GetType() != RenderPassObject::Type::k_staticAnimated)
+            {
+                return 1;
+            }
+            
+            std::size_t endIndex = startIndex + 1;
+            while (endIndex < renderPassObjects.size() && endIndex - startIndex < k_maxInstancesPerCommand)
+            {
+                const auto& next = renderPassObjects[endIndex];
+                if (next.GetType() != first.GetType() || next.GetRenderMaterial() != first.GetRenderMaterial() || next.GetRenderMesh() != first.GetRenderMesh() ||
+                    next.GetRenderSkinnedAnimation() != first.GetRenderSkinnedAnimation())
+                {
+                    break;
+                }
+                
+                ++endIndex;
+            }
+            
+            return endIndex - startIndex;
+        }
+        
         /// Compiles the render commands for the given render pass. The render pass must contain
         /// render pass objects otherwise this will assert.
         ///
@@ -293,10 +333,11 @@ namespace ChilliSource
         ///     The render pass.
         /// @param renderCommandList
         ///     The render command list to add the commands to.
-        /// @param renderFrameData
-        ///     Container for all allocations which must live until the end of the frame.
+        /// @param frameAllocator
+        ///     The allocator from which all allocations which must live until the end of the
+        ///     frame should be made.
         ///
-        void CompileRenderCommandsForPass(const RenderPass& renderPass, RenderCommandList* renderCommandList) noexcept
+        void CompileRenderCommandsForPass(const RenderPass& renderPass, RenderCommandList* renderCommandList, IAllocator* frameAllocator) noexcept
         {
             AddApplyLightCommand(renderPass, renderCommandList);
             
@@ -306,8 +347,10 @@ namespace ChilliSource
             RenderCommandListStateCache cache;
             SmallMeshBatcher batcher(renderCommandList);
             
-            for (const auto& renderPassObject : renderPassObjects)
+            for (std::size_t i = 0; i < renderPassObjects.size(); ++i)
             {
+                const auto& renderPassObject = renderPassObjects[i];
+                
                 AddApplyMaterialCommand(renderPassObject, renderCommandList, cache, batcher);
                 
                 if (SmallMeshBatcher::CanBatch(renderPassObject))
@@ -323,9 +366,24 @@ namespace ChilliSource
                     
                     AddApplyMeshCommand(renderPassObject, renderCommandList, cache);
                     AddApplySkinnedAnimationCommand(renderPassObject, renderCommandList, cache);
-                    renderCommandList->AddRenderInstanceCommand(renderPassObject.GetWorldMatrix());
+                    
+                    auto numInstances = CalcNumInstances(renderPassObjects, i);
+                    if (numInstances > 1)
+                    {
+                        auto worldMatrices = MakeUniqueArray<Matrix4>(*frameAllocator, numInstances);
+                        for (std::size_t j = 0; j < numInstances; ++j)
+                        {
+                            worldMatrices[j] = renderPassObjects[i + j].GetWorldMatrix();
+                        }
+                        
+                        renderCommandList->AddRenderInstancesCommand(std::move(worldMatrices), u32(numInstances));
+                        i += numInstances - 1;
+                    }
+                    else
+                    {
+                        renderCommandList->AddRenderInstanceCommand(renderPassObject.GetWorldMatrix());
+                    }
                 }
-                
             }
             
             batcher.Flush();
@@ -362,9 +420,9 @@ namespace ChilliSource
                         if (renderPass.GetRenderPassObjects().size() > 0)
                         {
                             auto renderCommandList = renderCommandBuffer->GetRenderCommandList(currentList++);
-                            tasks.push_back([=, &renderPass, &renderCommandBuffer](const TaskContext& innerTaskContext)
+                            tasks.push_back([=, &renderPass](const TaskContext&)
                             {
-                                CompileRenderCommandsForPass(renderPass, renderCommandList);
+                                CompileRenderCommandsForPass(renderPass, renderCommandList, frameAllocator);
                             });
                         }
                     }
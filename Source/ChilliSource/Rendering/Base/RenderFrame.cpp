@@ -28,9 +28,10 @@ namespace ChilliSource
 {
     //------------------------------------------------------------------------------
     RenderFrame::RenderFrame(const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera, const AmbientRenderLight& renderAmbientLight,
-                             const std::vector<DirectionalRenderLight>& renderDirectionalLights, const std::vector<PointRenderLight>& renderPointLights, const std::vector<RenderObject>& renderObjects) noexcept
+                             const std::vector<DirectionalRenderLight>& renderDirectionalLights, const std::vector<PointRenderLight>& renderPointLights, const std::vector<RenderObject>& renderObjects,
+                             RenderObjectGrid standardRenderObjectGrid) noexcept
         : m_offscreenRenderTarget(renderTarget), m_resolution(resolution), m_clearColour(clearColour), m_renderCamera(renderCamera), m_renderAmbientLight(renderAmbientLight), m_renderDirectionalLights(renderDirectionalLights),
-          m_renderPointLights(renderPointLights), m_renderObjects(renderObjects)
+          m_renderPointLights(renderPointLights), m_renderObjects(renderObjects), m_standardRenderObjectGrid(std::move(standardRenderObjectGrid))
     {
     }
 }
@@ -29,6 +29,7 @@
 #include <ChilliSource/Core/Base/Colour.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Rendering/Base/RenderObject.h>
+#include <ChilliSource/Rendering/Base/RenderObjectGrid.h>
 #include <ChilliSource/Rendering/Camera/RenderCamera.h>
 #include <ChilliSource/Rendering/Lighting/AmbientRenderLight.h>
 #include <ChilliSource/Rendering/Lighting/DirectionalRenderLight.h>
@@ -67,9 +68,11 @@ namespace ChilliSource
         ///     A list of point lights in the frame.
         /// @param renderObjects
         ///     A list of objects in the frame.
+        /// @param standardRenderObjectGrid
+        ///     A spatial index of the objects in the standard layer of the frame. Should be moved.
         ///
         RenderFrame(const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera, const AmbientRenderLight& renderAmbientLight, const std::vector<DirectionalRenderLight>& renderDirectionalLights,
-                    const std::vector<PointRenderLight>& renderPointLights, const std::vector<RenderObject>& renderObjects) noexcept;
+                    const std::vector<PointRenderLight>& renderPointLights, const std::vector<RenderObject>& renderObjects, RenderObjectGrid standardRenderObjectGrid) noexcept;
         
         /// @return The resolution of the viewport.
         ///
@@ -100,6 +103,11 @@ namespace ChilliSource
         ///
         const std::vector<RenderObject>& GetRenderObjects() const noexcept { return m_renderObjects; }
         
+        /// @return A spatial index of the objects in the standard layer of the frame. Queries
+        ///     return indices into the list of objects in the frame.
+        ///
+        const RenderObjectGrid& GetStandardRenderObjectGrid() const noexcept { return m_standardRenderObjectGrid; }
+        
         ///@return Render target for this frame, if null defaults to the frame buffer
         ///
         const RenderTargetGroup* GetOffscreenRenderTarget() const noexcept { return m_offscreenRenderTarget; }
@@ -112,6 +120,7 @@ namespace ChilliSource
         std::vector<DirectionalRenderLight> m_renderDirectionalLights;
         std::vector<PointRenderLight> m_renderPointLights;
         std::vector<RenderObject> m_renderObjects;
+        RenderObjectGrid m_standardRenderObjectGrid;
         const RenderTargetGroup* m_offscreenRenderTarget;
     };
 }
@@ -63,6 +63,14 @@ namespace ChilliSource
         
         auto renderAmbientLight = MergeAmbientRenderLights(renderAmbientLights);
         
-        return RenderFrame(renderTarget, resolution, clearColour, renderCamera, renderAmbientLight, renderDirectionalLights, renderPointLights, renderObjects);
+        // Point light passes only need the objects near each light, so a spatial index of the scene is built once
+        // here rather than having each light test every object in the frame.
+        RenderObjectGrid standardRenderObjectGrid;
+        if (!renderPointLights.empty())
+        {
+            standardRenderObjectGrid = RenderObjectGrid(renderObjects, RenderLayer::k_standard);
+        }
+        
+        return RenderFrame(renderTarget, resolution, clearColour, renderCamera, renderAmbientLight, renderDirectionalLights, renderPointLights, renderObjects, std::move(standardRenderObjectGrid));
     }
 }
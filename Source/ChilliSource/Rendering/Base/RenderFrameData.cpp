@@ -49,4 +49,20 @@ namespace ChilliSource
         
         m_renderSkinnedAnimations.push_back(std::move(renderSkinnedAnimation));
     }
+    
+    //------------------------------------------------------------------------------
+    void RenderFrameData::Append(RenderFrameData renderFrameData) noexcept
+    {
+        m_renderDynamicMeshes.reserve(m_renderDynamicMeshes.size() + renderFrameData.m_renderDynamicMeshes.size());
+        for (auto& renderDynamicMesh : renderFrameData.m_renderDynamicMeshes)
+        {
+            m_renderDynamicMeshes.push_back(std::move(renderDynamicMesh));
+        }
+        
+        m_renderSkinnedAnimations.reserve(m_renderSkinnedAnimations.size() + renderFrameData.m_renderSkinnedAnimations.size());
+        for (auto& renderSkinnedAnimation : renderFrameData.m_renderSkinnedAnimations)
+        {
+            m_renderSkinnedAnimations.push_back(std::move(renderSkinnedAnimation));
+        }
+    }
 };
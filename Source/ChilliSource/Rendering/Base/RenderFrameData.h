@@ -63,6 +63,13 @@ namespace ChilliSource
         ///
         void AddRenderSkinnedAnimation(RenderSkinnedAnimationAUPtr renderSkinnedAnimation) noexcept;
         
+        /// Moves all data from the given container into this one.
+        ///
+        /// @param renderFrameData
+        ///     The container to take the data from. Should be moved.
+        ///
+        void Append(RenderFrameData renderFrameData) noexcept;
+        
     private:
         std::vector<RenderDynamicMeshAUPtr> m_renderDynamicMeshes;
         std::vector<RenderSkinnedAnimationAUPtr> m_renderSkinnedAnimations;
@@ -0,0 +1,314 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Base/RenderObjectGrid.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr f32 k_targetObjectsPerCell = 4.0f;
+        constexpr s32 k_maxCellsPerAxis = 32;
+        constexpr s32 k_maxCellsPerObject = 8;
+        constexpr f32 k_minSignificantExtentRatio = 0.01f;
+
+        /// @param vec
+        ///     The vector.
+        /// @param axis
+        ///     The axis, where 0, 1 and 2 are x, y and z.
+        ///
+        /// @return The component of the vector along the given axis.
+        ///
+        template <typename TType> TType& GetComponent(GenericVector3<TType>& vec, u32 axis) noexcept
+        {
+            switch (axis)
+            {
+                case 0:
+                    return vec.x;
+                case 1:
+                    return vec.y;
+                default:
+                    CS_ASSERT(axis == 2, "Invalid axis.");
+                    return vec.z;
+            }
+        }
+
+        /// @param vec
+        ///     The vector.
+        /// @param axis
+        ///     The axis, where 0, 1 and 2 are x, y and z.
+        ///
+        /// @return The component of the vector along the given axis.
+        ///
+        template <typename TType> TType GetComponent(const GenericVector3<TType>& vec, u32 axis) noexcept
+        {
+            switch (axis)
+            {
+                case 0:
+                    return vec.x;
+                case 1:
+                    return vec.y;
+                default:
+                    CS_ASSERT(axis == 2, "Invalid axis.");
+                    return vec.z;
+            }
+        }
+
+        /// Calculates the number of cells along the largest axis of the grid. This aims to
+        /// give roughly the target number of objects per cell, taking into account that many
+        /// scenes are close to flat along one or more axes.
+        ///
+        /// @param extents
+        ///     The extents of the grid.
+        /// @param maxExtent
+        ///     The largest component of the extents.
+        /// @param numObjects
+        ///     The number of objects in the grid.
+        ///
+        /// @return The number of cells along the largest axis.
+        ///
+        s32 CalcCellsAlongLargestAxis(const Vector3& extents, f32 maxExtent, u32 numObjects) noexcept
+        {
+            u32 numSignificantAxes = 0;
+            for (u32 axis = 0; axis < 3; ++axis)
+            {
+                if (GetComponent(extents, axis) >= maxExtent * k_minSignificantExtentRatio)
+                {
+                    ++numSignificantAxes;
+                }
+            }
+
+            // Degenerate extents can fail every comparison above, which would otherwise lead to a
+            // root of 1/0 and an infinite cell count.
+            numSignificantAxes = std::max(numSignificantAxes, 1u);
+
+            f32 targetNumCells = std::max(f32(numObjects) / k_targetObjectsPerCell, 1.0f);
+            s32 numCells = s32(std::ceil(std::pow(targetNumCells, 1.0f / f32(numSignificantAxes))));
+
+            return std::min(std::max(numCells, 1), k_maxCellsPerAxis);
+        }
+
+        /// @param sphere
+        ///     The sphere.
+        ///
+        /// @return Whether or not the origin and radius of the sphere are finite.
+        ///
+        bool IsFinite(const Sphere& sphere) noexcept
+        {
+            return std::isfinite(sphere.vOrigin.x) && std::isfinite(sphere.vOrigin.y) && std::isfinite(sphere.vOrigin.z) && std::isfinite(sphere.fRadius);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    RenderObjectGrid::RenderObjectGrid(const std::vector<RenderObject>& renderObjects, RenderLayer renderLayer) noexcept
+    {
+        std::vector<u32> layerObjectIndices;
+        Vector3 maxBounds;
+
+        for (u32 i = 0; i < u32(renderObjects.size()); ++i)
+        {
+            const auto& renderObject = renderObjects[i];
+            if (renderObject.GetRenderLayer() == renderLayer)
+            {
+                const auto& boundingSphere = renderObject.GetBoundingSphere();
+
+                // Non-finite spheres cannot be placed in cells, and would invalidate the bounds of the grid.
+                if (!IsFinite(boundingSphere))
+                {
+                    m_unboundedObjectIndices.push_back(i);
+                    continue;
+                }
+
+                Vector3 radius(boundingSphere.fRadius, boundingSphere.fRadius, boundingSphere.fRadius);
+
+                if (layerObjectIndices.empty())
+                {
+                    m_minBounds = boundingSphere.vOrigin - radius;
+                    maxBounds = boundingSphere.vOrigin + radius;
+                }
+                else
+                {
+                    m_minBounds = Vector3::Min(m_minBounds, boundingSphere.vOrigin - radius);
+                    maxBounds = Vector3::Max(maxBounds, boundingSphere.vOrigin + radius);
+                }
+
+                layerObjectIndices.push_back(i);
+            }
+        }
+
+        if (layerObjectIndices.empty())
+        {
+            return;
+        }
+
+        Vector3 extents = maxBounds - m_minBounds;
+        f32 maxExtent = std::max(std::max(extents.x, extents.y), extents.z);
+        if (!std::isfinite(maxExtent))
+        {
+            // The bounds overflowed, so the cell size cannot be represented. Fall back to
+            // treating every object as unbounded.
+            m_unboundedObjectIndices.insert(m_unboundedObjectIndices.end(), layerObjectIndices.begin(), layerObjectIndices.end());
+            return;
+        }
+        else if (maxExtent <= 0.0f)
+        {
+            maxExtent = 1.0f;
+        }
+
+        s32 cellsAlongLargestAxis = CalcCellsAlongLargestAxis(extents, maxExtent, u32(layerObjectIndices.size()));
+        m_inverseCellSize = f32(cellsAlongLargestAxis) / maxExtent;
+
+        for (u32 axis = 0; axis < 3; ++axis)
+        {
+            GetComponent(m_numCells, axis) = std::min(std::max(s32(GetComponent(extents, axis) * m_inverseCellSize) + 1, 1), k_maxCellsPerAxis);
+        }
+
+        u32 totalNumCells = u32(m_numCells.x * m_numCells.y * m_numCells.z);
+        m_cellStarts.assign(totalNumCells + 1, 0);
+
+        // Count the number of objects in each cell, storing the start of the following cell
+        // so that a prefix sum gives the start of each cell.
+        std::vector<u32> cellObjectIndices;
+        cellObjectIndices.reserve(layerObjectIndices.size());
+        for (auto objectIndex : layerObjectIndices)
+        {
+            Integer3 minCell, maxCell;
+            if (!CalcCellRange(renderObjects[objectIndex].GetBoundingSphere(), minCell, maxCell))
+            {
+                m_unboundedObjectIndices.push_back(objectIndex);
+                continue;
+            }
+
+            Integer3 cellRange = maxCell - minCell + Integer3(1, 1, 1);
+            if (cellRange.x * cellRange.y * cellRange.z > k_maxCellsPerObject)
+            {
+                m_unboundedObjectIndices.push_back(objectIndex);
+                continue;
+            }
+
+            cellObjectIndices.push_back(objectIndex);
+
+            for (s32 z = minCell.z; z <= maxCell.z; ++z)
+            {
+                for (s32 y = minCell.y; y <= maxCell.y; ++y)
+                {
+                    for (s32 x = minCell.x; x <= maxCell.x; ++x)
+                    {
+                        ++m_cellStarts[CalcCellIndex(Integer3(x, y, z)) + 1];
+                    }
+                }
+            }
+        }
+
+        for (u32 i = 1; i < u32(m_cellStarts.size()); ++i)
+        {
+            m_cellStarts[i] += m_cellStarts[i - 1];
+        }
+
+        m_cellObjectIndices.resize(m_cellStarts.back());
+        std::vector<u32> cellWritePositions(m_cellStarts.begin(), m_cellStarts.end() - 1);
+
+        for (auto objectIndex : cellObjectIndices)
+        {
+            Integer3 minCell, maxCell;
+            CalcCellRange(renderObjects[objectIndex].GetBoundingSphere(), minCell, maxCell);
+
+            for (s32 z = minCell.z; z <= maxCell.z; ++z)
+            {
+                for (s32 y = minCell.y; y <= maxCell.y; ++y)
+                {
+                    for (s32 x = minCell.x; x <= maxCell.x; ++x)
+                    {
+                        m_cellObjectIndices[cellWritePositions[CalcCellIndex(Integer3(x, y, z))]++] = objectIndex;
+                    }
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void RenderObjectGrid::GetPotentiallyIntersecting(const Sphere& sphere, std::vector<u32>& out_objectIndices) const noexcept
+    {
+        out_objectIndices.clear();
+
+        Integer3 minCell, maxCell;
+        if (!m_cellStarts.empty() && CalcCellRange(sphere, minCell, maxCell))
+        {
+            for (s32 z = minCell.z; z <= maxCell.z; ++z)
+            {
+                for (s32 y = minCell.y; y <= maxCell.y; ++y)
+                {
+                    for (s32 x = minCell.x; x <= maxCell.x; ++x)
+                    {
+                        u32 cellIndex = CalcCellIndex(Integer3(x, y, z));
+                        out_objectIndices.insert(out_objectIndices.end(), m_cellObjectIndices.begin() + m_cellStarts[cellIndex], m_cellObjectIndices.begin() + m_cellStarts[cellIndex + 1]);
+                    }
+                }
+            }
+        }
+
+        out_objectIndices.insert(out_objectIndices.end(), m_unboundedObjectIndices.begin(), m_unboundedObjectIndices.end());
+
+        // Objects which span multiple cells will have been added more than once.
+        std::sort(out_objectIndices.begin(), out_objectIndices.end());
+        out_objectIndices.erase(std::unique(out_objectIndices.begin(), out_objectIndices.end()), out_objectIndices.end());
+    }
+
+    //------------------------------------------------------------------------------
+    bool RenderObjectGrid::CalcCellRange(const Sphere& sphere, Integer3& out_minCell, Integer3& out_maxCell) const noexcept
+    {
+        for (u32 axis = 0; axis < 3; ++axis)
+        {
+            // Clamp in floating point before converting so that very large spheres cannot overflow.
+            f32 maxCellIndex = f32(GetComponent(m_numCells, axis) - 1);
+            f32 minCell = std::floor((GetComponent(sphere.vOrigin, axis) - sphere.fRadius - GetComponent(m_minBounds, axis)) * m_inverseCellSize);
+            f32 maxCell = std::floor((GetComponent(sphere.vOrigin, axis) + sphere.fRadius - GetComponent(m_minBounds, axis)) * m_inverseCellSize);
+
+            // Converting a non-finite value to an integer is undefined, so these cannot be mapped to cells.
+            if (!std::isfinite(minCell) || !std::isfinite(maxCell))
+            {
+                return false;
+            }
+
+            if (maxCell < 0.0f || minCell > maxCellIndex)
+            {
+                return false;
+            }
+
+            GetComponent(out_minCell, axis) = s32(std::max(minCell, 0.0f));
+            GetComponent(out_maxCell, axis) = s32(std::min(maxCell, maxCellIndex));
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    u32 RenderObjectGrid::CalcCellIndex(const Integer3& cell) const noexcept
+    {
+        return u32(cell.x + m_numCells.x * (cell.y + m_numCells.y * cell.z));
+    }
+}
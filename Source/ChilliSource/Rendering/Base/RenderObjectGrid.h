@@ -0,0 +1,106 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_RENDEROBJECTGRID_H_
+#define _CHILLISOURCE_RENDERING_BASE_RENDEROBJECTGRID_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Rendering/Base/RenderLayer.h>
+#include <ChilliSource/Rendering/Base/RenderObject.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A uniform grid spatial index over the bounding spheres of the render objects in
+    /// a single render layer of a frame. This is built once per frame and allows passes
+    /// which only affect a region of the world, such as point light passes, to consider
+    /// only nearby objects rather than every object in the frame.
+    ///
+    /// The grid stores indices into the list of render objects it was built from. Objects
+    /// which overlap too many cells are not stored in the cells, and are instead returned
+    /// by every query.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class RenderObjectGrid final
+    {
+    public:
+        RenderObjectGrid() = default;
+
+        /// Builds the grid from all objects in the given list which are in the given layer.
+        ///
+        /// @param renderObjects
+        ///     The list of render objects in the frame.
+        /// @param renderLayer
+        ///     The render layer to build the grid for.
+        ///
+        RenderObjectGrid(const std::vector<RenderObject>& renderObjects, RenderLayer renderLayer) noexcept;
+
+        /// Gets the indices of all objects which could intersect the given sphere. This is
+        /// conservative, so the returned objects should still be tested individually.
+        ///
+        /// @param sphere
+        ///     The sphere to query.
+        /// @param out_objectIndices
+        ///     (Out) The indices, in ascending order, of the objects that could intersect the
+        ///     sphere. These index into the list of render objects the grid was built from.
+        ///     This is cleared before use.
+        ///
+        void GetPotentiallyIntersecting(const Sphere& sphere, std::vector<u32>& out_objectIndices) const noexcept;
+
+    private:
+        /// Calculates the range of cells overlapped by the given sphere, clamped to the grid.
+        ///
+        /// @param sphere
+        ///     The sphere.
+        /// @param out_minCell
+        ///     (Out) The minimum cell co-ordinate, inclusive.
+        /// @param out_maxCell
+        ///     (Out) The maximum cell co-ordinate, inclusive.
+        ///
+        /// @return Whether or not the sphere overlaps the grid at all. This is false if the
+        ///     sphere is not finite.
+        ///
+        bool CalcCellRange(const Sphere& sphere, Integer3& out_minCell, Integer3& out_maxCell) const noexcept;
+
+        /// @param cell
+        ///     The cell co-ordinate.
+        ///
+        /// @return The index of the given cell in the cell list.
+        ///
+        u32 CalcCellIndex(const Integer3& cell) const noexcept;
+
+        Vector3 m_minBounds;
+        f32 m_inverseCellSize = 0.0f;
+        Integer3 m_numCells;
+        std::vector<u32> m_cellStarts;
+        std::vector<u32> m_cellObjectIndices;
+        std::vector<u32> m_unboundedObjectIndices;
+    };
+}
+
+#endif
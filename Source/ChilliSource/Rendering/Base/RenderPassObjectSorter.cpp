@@ -26,69 +26,312 @@
 
 #include <ChilliSource/Rendering/Camera/RenderCamera.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 namespace ChilliSource
 {
-    //------------------------------------------------------------------------------
-    void RenderPassObjectSorter::OpaqueSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
+    namespace
     {
-        //The tile base deferred renderer on all iOS hardware does not benefit from front to back sorting https://developer.apple.com/library/content/documentation/3DDrawing/Conceptual/OpenGLES_ProgrammingGuide/Performance/Performance.html
-#ifndef CS_TARGETPLATFORM_IOS
-        std::sort(renderPassObjects.begin(), renderPassObjects.end(), [&camera](const RenderPassObject& a, const RenderPassObject& b)
+        /// The number of key bits which are sorted in each pass of the radix sort.
+        ///
+        constexpr u32 k_radixBits = 8;
+        constexpr u32 k_radixBuckets = 1 << k_radixBits;
+        
+        /// Below this number of objects a comparison sort of the keys is cheaper than the
+        /// fixed overhead of the radix sort passes.
+        ///
+        constexpr std::size_t k_minRadixSortSize = 128;
+        
+        /// The maximum number of bits of a key which can be used to store depth.
+        ///
+        constexpr u32 k_maxDepthBits = 32;
+        
+        /// A precomputed sort key for a single render pass object, along with the index of
+        /// the object in the original list.
+        ///
+        struct SortEntry final
         {
-            if (a.GetRenderMaterial() == b.GetRenderMaterial())
+            u64 m_key;
+            u32 m_index;
+        };
+        
+        /// Calculates the number of bits required to store all values in the range [0, count).
+        ///
+        /// @param count
+        ///     The number of values.
+        ///
+        /// @return The number of bits required.
+        ///
+        u32 CalcBitsRequired(std::size_t count) noexcept
+        {
+            u32 numBits = 0;
+            while (numBits < 64 && (u64(1) << numBits) < count)
             {
-                Matrix4 wvpA = a.GetWorldMatrix() * camera.GetViewProjectionMatrix();
-                Matrix4 wvpB = b.GetWorldMatrix() * camera.GetViewProjectionMatrix();
+                ++numBits;
+            }
+            
+            return numBits;
+        }
+        
+        /// Calculates the clip space depth of the origin of the given world matrix. This is the
+        /// z component of the translation of worldMatrix * viewProjectionMatrix, without the
+        /// cost of performing the full matrix multiplication.
+        ///
+        /// @param worldMatrix
+        ///     The world matrix of the object.
+        /// @param viewProjectionMatrix
+        ///     The view projection matrix of the camera.
+        ///
+        /// @return The depth.
+        ///
+        f32 CalcDepth(const Matrix4& worldMatrix, const Matrix4& viewProjectionMatrix) noexcept
+        {
+            return worldMatrix.m[12] * viewProjectionMatrix.m[2] + worldMatrix.m[13] * viewProjectionMatrix.m[6] + worldMatrix.m[14] * viewProjectionMatrix.m[10] + worldMatrix.m[15] * viewProjectionMatrix.m[14];
+        }
+        
+        /// Quantises the given depth into an unsigned integer of the requested number of bits
+        /// which sorts in the same order as the original value. Larger depth values produce
+        /// smaller integers, so that the objects furthest along the z axis are sorted first.
+        ///
+        /// @param depth
+        ///     The depth to quantise.
+        /// @param numBits
+        ///     The number of bits to quantise to. Must be no greater than 32.
+        ///
+        /// @return The quantised depth.
+        ///
+        u64 QuantiseDepth(f32 depth, u32 numBits) noexcept
+        {
+            CS_ASSERT(numBits <= k_maxDepthBits, "Too many depth bits requested.");
+            
+            if (numBits == 0)
+            {
+                return 0;
+            }
+            
+            u32 bits = 0;
+            std::memcpy(&bits, &depth, sizeof(bits));
+            
+            // Flip the float bits such that the integer ordering matches the float ordering, then
+            // invert the whole value so larger depths come first.
+            u32 sortableBits = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+            sortableBits = ~sortableBits;
+            
+            return u64(sortableBits >> (k_maxDepthBits - numBits));
+        }
+        
+        /// Builds an ordered list of the unique values returned by the given getter for each
+        /// object. The position of a value in this list is its rank, which can be packed into
+        /// a sort key while preserving the ordering of the original values.
+        ///
+        /// @param renderPassObjects
+        ///     The list of render pass objects.
+        /// @param getter
+        ///     The getter for the value which should be ranked.
+        ///
+        /// @return The ordered list of unique values.
+        ///
+        template <typename TValue, typename TGetter> std::vector<TValue> BuildRanks(const std::vector<RenderPassObject>& renderPassObjects, TGetter getter) noexcept
+        {
+            std::vector<TValue> ranks;
+            ranks.reserve(renderPassObjects.size());
+            
+            for (const auto& renderPassObject : renderPassObjects)
+            {
+                ranks.push_back(getter(renderPassObject));
+            }
+            
+            std::sort(ranks.begin(), ranks.end());
+            ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+            
+            return ranks;
+        }
+        
+        /// @param ranks
+        ///     The ordered list of unique values returned by BuildRanks().
+        /// @param value
+        ///     The value to look up. Must exist in the list.
+        ///
+        /// @return The rank of the given value.
+        ///
+        template <typename TValue> u64 GetRank(const std::vector<TValue>& ranks, const TValue& value) noexcept
+        {
+            return u64(std::lower_bound(ranks.begin(), ranks.end(), value) - ranks.begin());
+        }
+        
+        /// Performs a stable least significant digit radix sort on the given entries. Passes over
+        /// digits which are the same for every key are skipped. Small lists fall back to a stable
+        /// comparison sort of the keys.
+        ///
+        /// @param numKeyBits
+        ///     The number of low bits of the key which are in use.
+        /// @param entries
+        ///     The entries to sort.
+        ///
+        void RadixSort(u32 numKeyBits, std::vector<SortEntry>& entries) noexcept
+        {
+            if (entries.size() < k_minRadixSortSize)
+            {
+                std::stable_sort(entries.begin(), entries.end(), [](const SortEntry& a, const SortEntry& b)
+                {
+                    return (a.m_key < b.m_key);
+                });
+                return;
+            }
+            
+            std::vector<SortEntry> scratch(entries.size());
+            
+            for (u32 shift = 0; shift < numKeyBits; shift += k_radixBits)
+            {
+                std::array<std::size_t, k_radixBuckets> offsets;
+                offsets.fill(0);
                 
-                if (wvpA.GetTranslation().z == wvpB.GetTranslation().z)
+                for (const auto& entry : entries)
                 {
-                    return (a.GetRenderMesh() < b.GetRenderMesh());
+                    ++offsets[(entry.m_key >> shift) & (k_radixBuckets - 1)];
                 }
-                else
+                
+                if (offsets[(entries[0].m_key >> shift) & (k_radixBuckets - 1)] == entries.size())
                 {
-                    return (wvpA.GetTranslation().z > wvpB.GetTranslation().z);
+                    continue;
                 }
+                
+                std::size_t total = 0;
+                for (auto& offset : offsets)
+                {
+                    auto count = offset;
+                    offset = total;
+                    total += count;
+                }
+                
+                for (const auto& entry : entries)
+                {
+                    scratch[offsets[(entry.m_key >> shift) & (k_radixBuckets - 1)]++] = entry;
+                }
+                
+                entries.swap(scratch);
             }
-            else
+        }
+        
+        /// Reorders the given list of render pass objects into the order described by the
+        /// given sorted entries.
+        ///
+        /// @param entries
+        ///     The sorted entries.
+        /// @param renderPassObjects
+        ///     The render pass objects to reorder.
+        ///
+        void ApplySortOrder(const std::vector<SortEntry>& entries, std::vector<RenderPassObject>& renderPassObjects) noexcept
+        {
+            std::vector<RenderPassObject> sortedRenderPassObjects;
+            sortedRenderPassObjects.reserve(renderPassObjects.size());
+            
+            for (const auto& entry : entries)
             {
-                return (a.GetRenderMaterial() < b.GetRenderMaterial());
+                sortedRenderPassObjects.push_back(std::move(renderPassObjects[entry.m_index]));
             }
-        });
+            
+            renderPassObjects.swap(sortedRenderPassObjects);
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderPassObjectSorter::OpaqueSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
+    {
+        //The tile base deferred renderer on all iOS hardware does not benefit from front to back sorting https://developer.apple.com/library/content/documentation/3DDrawing/Conceptual/OpenGLES_ProgrammingGuide/Performance/Performance.html
+#ifndef CS_TARGETPLATFORM_IOS
+        if (renderPassObjects.size() < 2)
+        {
+            return;
+        }
+        
+        // Key layout, from most to least significant: material, depth, mesh.
+        auto materialRanks = BuildRanks<const RenderMaterial*>(renderPassObjects, [](const RenderPassObject& object) { return object.GetRenderMaterial(); });
+        auto meshRanks = BuildRanks<const RenderMesh*>(renderPassObjects, [](const RenderPassObject& object) { return object.GetRenderMesh(); });
+        
+        u32 numMaterialBits = CalcBitsRequired(materialRanks.size());
+        u32 numMeshBits = CalcBitsRequired(meshRanks.size());
+        u32 numDepthBits = std::min(k_maxDepthBits, 64 - numMaterialBits - numMeshBits);
+        
+        const auto& viewProjectionMatrix = camera.GetViewProjectionMatrix();
+        std::vector<SortEntry> entries(renderPassObjects.size());
+        
+        for (std::size_t i = 0; i < renderPassObjects.size(); ++i)
+        {
+            const auto& renderPassObject = renderPassObjects[i];
+            
+            u64 key = GetRank(materialRanks, renderPassObject.GetRenderMaterial());
+            key = (key << numDepthBits) | QuantiseDepth(CalcDepth(renderPassObject.GetWorldMatrix(), viewProjectionMatrix), numDepthBits);
+            key = (key << numMeshBits) | GetRank(meshRanks, renderPassObject.GetRenderMesh());
+            
+            entries[i] = SortEntry{ key, u32(i) };
+        }
+        
+        RadixSort(numMaterialBits + numDepthBits + numMeshBits, entries);
+        ApplySortOrder(entries, renderPassObjects);
 #endif
     }
     
     //------------------------------------------------------------------------------
     void RenderPassObjectSorter::TransparentSort(const RenderCamera& camera, std::vector<RenderPassObject>& renderPassObjects) noexcept
     {
-        std::sort(renderPassObjects.begin(), renderPassObjects.end(), [&camera](const RenderPassObject& a, const RenderPassObject& b)
+        if (renderPassObjects.size() < 2)
+        {
+            return;
+        }
+        
+        // Key layout, from most to least significant: depth, mesh.
+        auto meshRanks = BuildRanks<const RenderMesh*>(renderPassObjects, [](const RenderPassObject& object) { return object.GetRenderMesh(); });
+        
+        u32 numMeshBits = CalcBitsRequired(meshRanks.size());
+        u32 numDepthBits = std::min(k_maxDepthBits, 64 - numMeshBits);
+        
+        const auto& viewProjectionMatrix = camera.GetViewProjectionMatrix();
+        std::vector<SortEntry> entries(renderPassObjects.size());
+        
+        for (std::size_t i = 0; i < renderPassObjects.size(); ++i)
         {
-            Matrix4 wvpA = a.GetWorldMatrix() * camera.GetViewProjectionMatrix();
-            Matrix4 wvpB = b.GetWorldMatrix() * camera.GetViewProjectionMatrix();
+            const auto& renderPassObject = renderPassObjects[i];
             
-            if (wvpA.GetTranslation().z == wvpB.GetTranslation().z)
-            {
-                return (a.GetRenderMesh() < b.GetRenderMesh());
-            }
-            else
-            {
-                return (wvpA.GetTranslation().z > wvpB.GetTranslation().z);
-            }
-        });
+            u64 key = QuantiseDepth(CalcDepth(renderPassObject.GetWorldMatrix(), viewProjectionMatrix), numDepthBits);
+            key = (key << numMeshBits) | GetRank(meshRanks, renderPassObject.GetRenderMesh());
+            
+            entries[i] = SortEntry{ key, u32(i) };
+        }
+        
+        RadixSort(numDepthBits + numMeshBits, entries);
+        ApplySortOrder(entries, renderPassObjects);
     }
     
     //------------------------------------------------------------------------------
     void RenderPassObjectSorter::PrioritySort(std::vector<RenderPassObject>& renderPassObjects) noexcept
     {
-        std::sort(renderPassObjects.begin(), renderPassObjects.end(), [](const RenderPassObject& a, const RenderPassObject& b)
+        if (renderPassObjects.size() < 2)
         {
-            if (a.GetPriority() == b.GetPriority())
-            {
-                return (a.GetRenderMaterial() < b.GetRenderMaterial());
-            }
-            else
-            {
-                return (a.GetPriority() < b.GetPriority());
-            }
-        });
+            return;
+        }
+        
+        // Key layout, from most to least significant: priority, material.
+        auto materialRanks = BuildRanks<const RenderMaterial*>(renderPassObjects, [](const RenderPassObject& object) { return object.GetRenderMaterial(); });
+        
+        u32 numMaterialBits = CalcBitsRequired(materialRanks.size());
+        constexpr u32 k_numPriorityBits = 32;
+        
+        std::vector<SortEntry> entries(renderPassObjects.size());
+        
+        for (std::size_t i = 0; i < renderPassObjects.size(); ++i)
+        {
+            const auto& renderPassObject = renderPassObjects[i];
+            
+            u64 key = u64(renderPassObject.GetPriority());
+            key = (key << numMaterialBits) | GetRank(materialRanks, renderPassObject.GetRenderMaterial());
+            
+            entries[i] = SortEntry{ key, u32(i) };
+        }
+        
+        RadixSort(k_numPriorityBits + numMaterialBits, entries);
+        ApplySortOrder(entries, renderPassObjects);
     }
 }
@@ -35,7 +35,9 @@
 
 namespace ChilliSource
 {
-    /// Collection of sort functions for render pass objects
+    /// Collection of sort functions for render pass objects. Each sort precomputes a single
+    /// 64-bit key per object in a linear pass and then performs a stable radix sort on the
+    /// keys, rather than recalculating depth for every comparison.
     ///
     namespace RenderPassObjectSorter
     {
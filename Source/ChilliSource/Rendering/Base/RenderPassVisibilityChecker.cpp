@@ -24,6 +24,7 @@
 
 #include <ChilliSource/Rendering/Base/RenderPassVisibilityChecker.h>
 
+#include <ChilliSource/Core/Math/SIMD.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/RenderPasses.h>
 #include <ChilliSource/Rendering/Base/RenderFrame.h>
@@ -31,49 +32,264 @@
 #include <ChilliSource/Rendering/Base/RenderObject.h>
 #include <ChilliSource/Rendering/Base/RenderPassObject.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace ChilliSource
 {
     namespace
     {
-        constexpr u32 k_objectsPerVisibilityBatch = 50;
-    }
-    
-    //------------------------------------------------------------------------------
-    std::vector<RenderObject> RenderPassVisibilityChecker::CalculateVisibleObjects(const TaskContext& taskContext, const RenderCamera& camera, const std::vector<RenderObject>& renderObjects) noexcept
-    {
-        std::mutex visibleObjectsMutex;
-        std::vector<RenderObject> visibleRenderObjects;
+        constexpr u32 k_objectsPerVisibilityBatch = 256;
+        constexpr u32 k_spheresPerTest = 4;
+        constexpr u32 k_numFrustumPlanes = 6;
+        
+        static_assert(k_objectsPerVisibilityBatch % k_spheresPerTest == 0, "Visibility batches must contain a whole number of sphere tests.");
+        
+        /// The bounding spheres of a batch of objects, stored as a structure of arrays so that
+        /// multiple spheres can be tested against a plane at once.
+        ///
+        struct BoundingSphereBatch final
+        {
+            std::array<f32, k_objectsPerVisibilityBatch> m_x;
+            std::array<f32, k_objectsPerVisibilityBatch> m_y;
+            std::array<f32, k_objectsPerVisibilityBatch> m_z;
+            std::array<f32, k_objectsPerVisibilityBatch> m_radius;
+        };
+        
+        /// The result of testing a bounding volume against the frustum.
+        ///
+        enum class CullResult
+        {
+            k_outside,
+            k_intersecting,
+            k_inside
+        };
+        
+        /// @param frustum
+        ///     The frustum.
+        ///
+        /// @return The planes of the frustum.
+        ///
+        std::array<Plane, k_numFrustumPlanes> GetPlanes(const Frustum& frustum) noexcept
+        {
+            return {{ frustum.mLeftClipPlane, frustum.mRightClipPlane, frustum.mTopClipPlane, frustum.mBottomClipPlane, frustum.mNearClipPlane, frustum.mFarClipPlane }};
+        }
         
-        u32 numTasks = 1 + (u32(renderObjects.size()) / k_objectsPerVisibilityBatch);
-        std::vector<Task> tasks;
-        for (u32 taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+        /// Copies the bounding spheres of the given range of objects into the batch. Unused
+        /// entries in the last sphere test are filled with empty spheres at the origin, the
+        /// result of which is ignored.
+        ///
+        /// @param renderObjects
+        ///     The list of all render objects.
+        /// @param startIndex
+        ///     The index of the first object in the batch.
+        /// @param numObjects
+        ///     The number of objects in the batch.
+        /// @param out_batch
+        ///     (Out) The batch to populate.
+        ///
+        void PopulateBatch(const std::vector<RenderObject>& renderObjects, u32 startIndex, u32 numObjects, BoundingSphereBatch& out_batch) noexcept
         {
-            tasks.push_back([=, &camera, &renderObjects, &visibleObjectsMutex, &visibleRenderObjects](const TaskContext& innerTaskContext)
+            for (u32 i = 0; i < numObjects; ++i)
             {
-                std::vector<RenderObject> taskVisibleObjects;
-                for(u32 objectIndex = 0; objectIndex < k_objectsPerVisibilityBatch; ++objectIndex)
+                const auto& boundingSphere = renderObjects[startIndex + i].GetBoundingSphere();
+                out_batch.m_x[i] = boundingSphere.vOrigin.x;
+                out_batch.m_y[i] = boundingSphere.vOrigin.y;
+                out_batch.m_z[i] = boundingSphere.vOrigin.z;
+                out_batch.m_radius[i] = boundingSphere.fRadius;
+            }
+            
+            u32 paddedNumObjects = ((numObjects + k_spheresPerTest - 1) / k_spheresPerTest) * k_spheresPerTest;
+            for (u32 i = numObjects; i < paddedNumObjects; ++i)
+            {
+                out_batch.m_x[i] = 0.0f;
+                out_batch.m_y[i] = 0.0f;
+                out_batch.m_z[i] = 0.0f;
+                out_batch.m_radius[i] = 0.0f;
+            }
+        }
+        
+        /// Calculates a single sphere which encloses all spheres in the batch, and tests it
+        /// against the frustum. This allows batches that are entirely outside or inside the
+        /// frustum to skip the per-object tests.
+        ///
+        /// @param planes
+        ///     The frustum planes.
+        /// @param batch
+        ///     The batch of bounding spheres.
+        /// @param numObjects
+        ///     The number of objects in the batch.
+        ///
+        /// @return The result of the test.
+        ///
+        CullResult CullBatchBounds(const std::array<Plane, k_numFrustumPlanes>& planes, const BoundingSphereBatch& batch, u32 numObjects) noexcept
+        {
+            Vector3 minBounds(batch.m_x[0] - batch.m_radius[0], batch.m_y[0] - batch.m_radius[0], batch.m_z[0] - batch.m_radius[0]);
+            Vector3 maxBounds(batch.m_x[0] + batch.m_radius[0], batch.m_y[0] + batch.m_radius[0], batch.m_z[0] + batch.m_radius[0]);
+            for (u32 i = 1; i < numObjects; ++i)
+            {
+                minBounds = Vector3::Min(minBounds, Vector3(batch.m_x[i] - batch.m_radius[i], batch.m_y[i] - batch.m_radius[i], batch.m_z[i] - batch.m_radius[i]));
+                maxBounds = Vector3::Max(maxBounds, Vector3(batch.m_x[i] + batch.m_radius[i], batch.m_y[i] + batch.m_radius[i], batch.m_z[i] + batch.m_radius[i]));
+            }
+            
+            Vector3 centre = 0.5f * (minBounds + maxBounds);
+            f32 radius = 0.5f * (maxBounds - minBounds).Length();
+            
+            CullResult result = CullResult::k_inside;
+            for (const auto& plane : planes)
+            {
+                f32 distance = plane.DistanceFromPoint(centre);
+                if (distance < -radius)
                 {
-                    u32 index = taskIndex * k_objectsPerVisibilityBatch + objectIndex;
-                    if (index >= renderObjects.size())
-                    {
-                        break;
-                    }
-                    
-                    const auto& renderPassObject = renderObjects[index];
-                    
-                    if (camera.GetFrustrum().SphereCullTest(renderPassObject.GetBoundingSphere()))
+                    return CullResult::k_outside;
+                }
+                
+                if (distance < radius)
+                {
+                    result = CullResult::k_intersecting;
+                }
+            }
+            
+            return result;
+        }
+        
+        /// Tests a group of spheres in the batch against the frustum. A sphere is visible if it
+        /// is not entirely behind any of the planes; this matches Frustum::SphereCullTest().
+        ///
+        /// @param planes
+        ///     The frustum planes.
+        /// @param batch
+        ///     The batch of bounding spheres.
+        /// @param index
+        ///     The index of the first sphere in the group. Must be a multiple of the number
+        ///     of spheres per test.
+        ///
+        /// @return A bit mask, where the nth bit is set if the nth sphere in the group is visible.
+        ///
+        u32 CullSpheres(const std::array<Plane, k_numFrustumPlanes>& planes, const BoundingSphereBatch& batch, u32 index) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 x = _mm_loadu_ps(&batch.m_x[index]);
+            __m128 y = _mm_loadu_ps(&batch.m_y[index]);
+            __m128 z = _mm_loadu_ps(&batch.m_z[index]);
+            __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&batch.m_radius[index]));
+            
+            __m128 outside = _mm_setzero_ps();
+            for (const auto& plane : planes)
+            {
+                __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.mvNormal.x)), _mm_mul_ps(y, _mm_set1_ps(plane.mvNormal.y))),
+                                             _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane.mvNormal.z)), _mm_set1_ps(plane.mfD)));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+            }
+            
+            return u32(~_mm_movemask_ps(outside)) & 0xf;
+#elif defined(CS_SIMD_NEON)
+            float32x4_t x = vld1q_f32(&batch.m_x[index]);
+            float32x4_t y = vld1q_f32(&batch.m_y[index]);
+            float32x4_t z = vld1q_f32(&batch.m_z[index]);
+            float32x4_t negativeRadius = vnegq_f32(vld1q_f32(&batch.m_radius[index]));
+            
+            uint32x4_t outside = vdupq_n_u32(0);
+            for (const auto& plane : planes)
+            {
+                float32x4_t distance = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(plane.mfD), x, plane.mvNormal.x), y, plane.mvNormal.y), z, plane.mvNormal.z);
+                outside = vorrq_u32(outside, vcltq_f32(distance, negativeRadius));
+            }
+            
+            u32 mask = 0;
+            mask |= (vgetq_lane_u32(outside, 0) == 0) ? 0x1 : 0;
+            mask |= (vgetq_lane_u32(outside, 1) == 0) ? 0x2 : 0;
+            mask |= (vgetq_lane_u32(outside, 2) == 0) ? 0x4 : 0;
+            mask |= (vgetq_lane_u32(outside, 3) == 0) ? 0x8 : 0;
+            return mask;
+#else
+            u32 mask = 0;
+            for (u32 i = 0; i < k_spheresPerTest; ++i)
+            {
+                bool outside = false;
+                for (const auto& plane : planes)
+                {
+                    f32 distance = batch.m_x[index + i] * plane.mvNormal.x + batch.m_y[index + i] * plane.mvNormal.y + batch.m_z[index + i] * plane.mvNormal.z + plane.mfD;
+                    outside |= (distance < -batch.m_radius[index + i]);
+                }
+                
+                mask |= outside ? 0 : (1u << i);
+            }
+            return mask;
+#endif
+        }
+        
+        /// Culls a single batch of objects, adding the visible objects to the output list
+        /// in their original order.
+        ///
+        /// @param planes
+        ///     The frustum planes.
+        /// @param renderObjects
+        ///     The list of all render objects.
+        /// @param startIndex
+        ///     The index of the first object in the batch.
+        /// @param numObjects
+        ///     The number of objects in the batch.
+        /// @param out_visibleObjects
+        ///     (Out) The list the visible objects should be added to.
+        ///
+        void CullBatch(const std::array<Plane, k_numFrustumPlanes>& planes, const std::vector<RenderObject>& renderObjects, u32 startIndex, u32 numObjects, std::vector<RenderObject>& out_visibleObjects) noexcept
+        {
+            BoundingSphereBatch batch;
+            PopulateBatch(renderObjects, startIndex, numObjects, batch);
+            
+            switch (CullBatchBounds(planes, batch, numObjects))
+            {
+                case CullResult::k_outside:
+                    return;
+                case CullResult::k_inside:
+                    out_visibleObjects.insert(out_visibleObjects.end(), renderObjects.begin() + startIndex, renderObjects.begin() + startIndex + numObjects);
+                    return;
+                case CullResult::k_intersecting:
+                    break;
+            }
+            
+            for (u32 i = 0; i < numObjects; i += k_spheresPerTest)
+            {
+                u32 visibleMask = CullSpheres(planes, batch, i);
+                u32 numInGroup = std::min(k_spheresPerTest, numObjects - i);
+                
+                for (u32 j = 0; j < numInGroup; ++j)
+                {
+                    if ((visibleMask & (1u << j)) != 0)
                     {
-                        taskVisibleObjects.push_back(renderPassObject);
+                        out_visibleObjects.push_back(renderObjects[startIndex + i + j]);
                     }
                 }
-                
-                std::unique_lock<std::mutex> lock(visibleObjectsMutex);
-                visibleRenderObjects.insert(visibleRenderObjects.end(), taskVisibleObjects.begin(), taskVisibleObjects.end());
-            });
+            }
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    std::vector<RenderObject> RenderPassVisibilityChecker::CalculateVisibleObjects(const TaskContext& taskContext, const RenderCamera& camera, const std::vector<RenderObject>& renderObjects) noexcept
+    {
+        if (renderObjects.empty())
+        {
+            return std::vector<RenderObject>();
         }
         
-        taskContext.ProcessChildTasks(tasks);
+        auto planes = GetPlanes(camera.GetFrustrum());
         
-        return visibleRenderObjects;
+        // Each chunk writes to its own output list so no synchronisation is needed. These are
+        // then merged in order, so the output is deterministic.
+        return taskContext.ParallelReduce(u32(renderObjects.size()), k_objectsPerVisibilityBatch, std::vector<RenderObject>(),
+        [&planes, &renderObjects](const TaskContext& innerTaskContext, u32 start, u32 end, std::vector<RenderObject>& visibleObjects)
+        {
+            for (u32 batchStart = start; batchStart < end; batchStart += k_objectsPerVisibilityBatch)
+            {
+                u32 numBatchObjects = std::min(k_objectsPerVisibilityBatch, end - batchStart);
+                CullBatch(planes, renderObjects, batchStart, numBatchObjects, visibleObjects);
+            }
+        },
+        [](std::vector<RenderObject>& visibleRenderObjects, std::vector<RenderObject>&& visibleObjects)
+        {
+            visibleRenderObjects.insert(visibleRenderObjects.end(), visibleObjects.begin(), visibleObjects.end());
+        });
     }
-} 
+}
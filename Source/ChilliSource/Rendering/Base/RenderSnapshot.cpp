@@ -27,8 +27,8 @@
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
-    RenderSnapshot::RenderSnapshot(const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& in_renderCamera) noexcept
-        : m_offscreenRenderTarget(renderTarget), m_resolution(resolution), m_clearColour(clearColour), m_renderCamera(in_renderCamera), m_preRenderCommandList(new RenderCommandList()), m_postRenderCommandList(new RenderCommandList()),
+    RenderSnapshot::RenderSnapshot(IAllocator* frameAllocator, const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& in_renderCamera) noexcept
+        : m_frameAllocator(frameAllocator), m_offscreenRenderTarget(renderTarget), m_resolution(resolution), m_clearColour(clearColour), m_renderCamera(in_renderCamera), m_preRenderCommandList(new RenderCommandList(frameAllocator)), m_postRenderCommandList(new RenderCommandList(frameAllocator)),
           m_renderFrameData()
     {
     }
@@ -63,6 +63,14 @@ namespace ChilliSource
         CS_ASSERT(!m_renderObjectsClaimed, "Render object list cannot be changed after it has been claimed.");
         
         m_renderObjects.push_back(renderObject);
+        ++m_numRenderObjectsAdded;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderSnapshot::AddRetainedRenderObject(const RenderObject& renderObject) noexcept
+    {
+        AddRenderObject(renderObject);
+        ++m_numRetainedRenderObjectsAdded;
     }
     
     //------------------------------------------------------------------------------
@@ -81,6 +89,30 @@ namespace ChilliSource
         m_renderFrameData.AddRenderSkinnedAnimation(std::move(renderSkinnedAnimation));
     }
     
+    //------------------------------------------------------------------------------
+    RenderSnapshot RenderSnapshot::CreateBucket() const noexcept
+    {
+        return RenderSnapshot(m_frameAllocator, m_offscreenRenderTarget, m_resolution, m_clearColour, m_renderCamera);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderSnapshot::MergeBucket(RenderSnapshot bucket) noexcept
+    {
+        CS_ASSERT(!m_renderAmbientLightsClaimed && !m_renderDirectionalLightsClaimed && !m_renderPointLightsClaimed && !m_renderObjectsClaimed && !m_renderFrameDataClaimed,
+                  "Cannot merge a bucket after any of the snapshot has been claimed.");
+        CS_ASSERT(bucket.m_preRenderCommandList && bucket.m_preRenderCommandList->GetNumCommands() == 0 && bucket.m_postRenderCommandList && bucket.m_postRenderCommandList->GetNumCommands() == 0,
+                  "Render snapshot buckets cannot contain pre or post render commands.");
+        
+        m_renderAmbientLights.insert(m_renderAmbientLights.end(), bucket.m_renderAmbientLights.begin(), bucket.m_renderAmbientLights.end());
+        m_renderDirectionalLights.insert(m_renderDirectionalLights.end(), bucket.m_renderDirectionalLights.begin(), bucket.m_renderDirectionalLights.end());
+        m_renderPointLights.insert(m_renderPointLights.end(), bucket.m_renderPointLights.begin(), bucket.m_renderPointLights.end());
+        m_renderObjects.insert(m_renderObjects.end(), bucket.m_renderObjects.begin(), bucket.m_renderObjects.end());
+        m_renderFrameData.Append(std::move(bucket.m_renderFrameData));
+        
+        m_numRenderObjectsAdded += bucket.m_numRenderObjectsAdded;
+        m_numRetainedRenderObjectsAdded += bucket.m_numRetainedRenderObjectsAdded;
+    }
+    
     //------------------------------------------------------------------------------
     RenderCommandList* RenderSnapshot::GetPreRenderCommandList() noexcept
     {
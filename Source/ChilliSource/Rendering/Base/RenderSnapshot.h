@@ -60,6 +60,9 @@ namespace ChilliSource
         
         /// Creates a new instance with the given viewport resolution and clear colour.
         ///
+        /// @param frameAllocator
+        ///     The allocator for the frame, which pre and post render commands are allocated from.
+        ///     May be null if no pre or post render commands will be added.
         /// @param renderTarget
         ///     The render target to render into, if null renders to screen (frame buffer)
         /// @param resolution
@@ -70,7 +73,7 @@ namespace ChilliSource
         ///     The main camera that will be used to render the scene. Currently only one camera per
         ///     scene is supported.
         ///
-        RenderSnapshot(const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera) noexcept;
+        RenderSnapshot(IAllocator* frameAllocator, const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera) noexcept;
         
         /// @return The viewport resolution.
         ///
@@ -112,6 +115,21 @@ namespace ChilliSource
         ///
         void AddRenderObject(const RenderObject& renderObject) noexcept;
         
+        /// Adds an object to the render snapshot which was retained from a previous frame rather
+        /// than being rebuilt. This is otherwise identical to AddRenderObject(), but the object
+        /// will not be included in the rebuilt render object count.
+        ///
+        /// @param renderObject
+        ///     The object which should be added.
+        ///
+        void AddRetainedRenderObject(const RenderObject& renderObject) noexcept;
+        
+        /// @return The number of render objects that have been added to the snapshot which were
+        ///     rebuilt this frame rather than retained from a previous frame. This continues to be
+        ///     valid after the render objects have been claimed.
+        ///
+        u32 GetNumRebuiltRenderObjects() const noexcept { return m_numRenderObjectsAdded - m_numRetainedRenderObjectsAdded; }
+        
         /// Adds a RenderDynamicMesh to the snapshot. This will be deleted at the end of the frame.
         ///
         /// @param The render dynamic mesh.
@@ -124,6 +142,23 @@ namespace ChilliSource
         ///
         void AddRenderSkinnedAnimation(RenderSkinnedAnimationAUPtr renderSkinnedAnimation) noexcept;
         
+        /// Creates an empty snapshot with the same target, resolution, clear colour and camera
+        /// as this one. A bucket can be populated independently of this snapshot, for example
+        /// on a background thread, and then merged back using MergeBucket().
+        ///
+        /// @return The new bucket.
+        ///
+        RenderSnapshot CreateBucket() const noexcept;
+        
+        /// Moves all lights, objects and frame data from the given bucket into this snapshot,
+        /// after any which have already been added. Buckets cannot contain pre or post render
+        /// commands.
+        ///
+        /// @param bucket
+        ///     The bucket which should be merged. Should be moved.
+        ///
+        void MergeBucket(RenderSnapshot bucket) noexcept;
+        
         /// @return A modifiable version of the pre render command list. This can be used to populate
         ///     The list with additional commands.
         ///
@@ -181,6 +216,7 @@ namespace ChilliSource
         const RenderTargetGroup* GetOffscreenRenderTarget() const noexcept { return m_offscreenRenderTarget; }
         
     private:
+        IAllocator* m_frameAllocator;
         Integer2 m_resolution;
         Colour m_clearColour;
         RenderCamera m_renderCamera;
@@ -192,6 +228,8 @@ namespace ChilliSource
         RenderCommandListUPtr m_postRenderCommandList;
         RenderFrameData m_renderFrameData;
         const RenderTargetGroup* m_offscreenRenderTarget;
+        u32 m_numRenderObjectsAdded = 0;
+        u32 m_numRetainedRenderObjectsAdded = 0;
         
         bool m_renderCameraClaimed = false;
         bool m_renderAmbientLightsClaimed = false;
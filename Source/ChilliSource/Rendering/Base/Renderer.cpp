@@ -25,6 +25,7 @@
 #include <ChilliSource/Rendering/Base/Renderer.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/ForwardRenderPassCompiler.h>
 #include <ChilliSource/Rendering/Base/RenderCommandCompiler.h>
@@ -66,7 +67,7 @@ namespace ChilliSource
     
     //------------------------------------------------------------------------------
     Renderer::Renderer() noexcept
-        : m_currentMainSnapshot(nullptr, Integer2::k_zero, Colour::k_black, RenderCamera())
+        : m_currentMainSnapshot(nullptr, nullptr, Integer2::k_zero, Colour::k_black, RenderCamera())
 
     {
 
@@ -79,9 +80,9 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    RenderSnapshot Renderer::CreateRenderSnapshot(const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera) noexcept
+    RenderSnapshot Renderer::CreateRenderSnapshot(IAllocator* frameAllocator, const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera) noexcept
     {
-        return RenderSnapshot(renderTarget, resolution, clearColour, renderCamera);
+        return RenderSnapshot(frameAllocator, renderTarget, resolution, clearColour, renderCamera);
     }
     
     //------------------------------------------------------------------------------
@@ -96,28 +97,38 @@ namespace ChilliSource
         
         taskScheduler->ScheduleTask(TaskType::k_small, [=](const TaskContext& taskContext)
         {
-            std::vector<RenderFrame> renderFrames(m_currentOffscreenSnapshots.size());
-            std::vector<RenderFrameData> renderFramesData(m_currentOffscreenSnapshots.size());
+            // The main snapshot is always the last frame, after all offscreen frames.
+            const auto numFrames = m_currentOffscreenSnapshots.size() + 1;
+            const auto mainFrameIndex = m_currentOffscreenSnapshots.size();
             
-            for(auto i=0; i<m_currentOffscreenSnapshots.size(); ++i)
+            std::vector<RenderFrame> renderFrames(numFrames);
+            std::vector<RenderFrameData> renderFramesData(numFrames);
+            std::vector<Task> tasks;
+            tasks.reserve(numFrames);
+            
+            for(std::size_t i = 0; i < m_currentOffscreenSnapshots.size(); ++i)
             {
                 CS_ASSERT(m_currentOffscreenSnapshots[i].GetPreRenderCommandList()->GetOrderedList().size() == 0 && m_currentOffscreenSnapshots[i].GetPostRenderCommandList()->GetOrderedList().size() == 0, "Offscreen render snapshots cannot have pre or post render commands");
                 
-                auto renderFrameData = m_currentOffscreenSnapshots[i].ClaimRenderFrameData();
-                renderFramesData.push_back(std::move(renderFrameData));
+                renderFramesData[i] = m_currentOffscreenSnapshots[i].ClaimRenderFrameData();
                 
-                auto renderFrame = CompileRenderFrame(m_currentOffscreenSnapshots[i]);
-                renderFrames.push_back(std::move(renderFrame));
+                tasks.push_back([=, &renderFrames](const TaskContext& innerTaskContext)
+                {
+                    renderFrames[i] = CompileRenderFrame(m_currentOffscreenSnapshots[i]);
+                });
             }
             
             auto preRenderCommandList = m_currentMainSnapshot.ClaimPreRenderCommandList();
             auto postRenderCommandList = m_currentMainSnapshot.ClaimPostRenderCommandList();
             
-            auto renderFrameData = m_currentMainSnapshot.ClaimRenderFrameData();
-            renderFramesData.push_back(std::move(renderFrameData));
+            renderFramesData[mainFrameIndex] = m_currentMainSnapshot.ClaimRenderFrameData();
+            
+            tasks.push_back([=, &renderFrames](const TaskContext& innerTaskContext)
+            {
+                renderFrames[mainFrameIndex] = CompileRenderFrame(m_currentMainSnapshot);
+            });
             
-            auto renderFrame = CompileRenderFrame(m_currentMainSnapshot);
-            renderFrames.push_back(std::move(renderFrame));
+            taskContext.ProcessChildTasks(tasks);
             
             auto targetRenderPassGroups = m_renderPassCompiler->CompileTargetRenderPassGroups(taskContext, std::move(renderFrames));
             auto renderCommandBuffer = RenderCommandCompiler::CompileRenderCommands(taskContext, std::move(frameAllocator), targetRenderPassGroups, std::move(preRenderCommandList), std::move(postRenderCommandList), std::move(renderFramesData));
@@ -170,6 +181,13 @@ namespace ChilliSource
         m_renderCommandProcessor = IRenderCommandProcessor::Create();
 
         m_commandRecycleSystem = Application::Get()->GetSystem<RenderCommandBufferManager>();
+        
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        CS_ASSERT(memoryTracker, "MemoryTracker must exist.");
+        for (u32 i = 0; i < m_frameAllocatorQueue.GetNumAllocators(); ++i)
+        {
+            memoryTracker->RegisterAllocator("Frame Allocator " + ToString(i), m_frameAllocatorQueue.GetAllocator(i));
+        }
     }
     
     //------------------------------------------------------------------------------
@@ -188,6 +206,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void Renderer::OnDestroy() noexcept
     {
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        for (u32 i = 0; i < m_frameAllocatorQueue.GetNumAllocators(); ++i)
+        {
+            memoryTracker->DeregisterAllocator(m_frameAllocatorQueue.GetAllocator(i));
+        }
+        
         m_commandRecycleSystem = nullptr;
         m_renderCommandProcessor.reset();
         m_renderPassCompiler.reset();
@@ -89,6 +89,8 @@ namespace ChilliSource
         /// scene. This will be created with the next queued frame allocator; if one isn't available
         /// this will block until one is.
         ///
+        /// @param frameAllocator
+        ///     The allocator for the frame, which pre and post render commands are allocated from.
         /// @param renderTarget
         ///     The render target to render into, if null renders to screen (frame buffer)
         /// @param resolution
@@ -101,7 +103,7 @@ namespace ChilliSource
         ///
         /// @return The new render snapshot object.
         ///
-        RenderSnapshot CreateRenderSnapshot(const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera) noexcept;
+        RenderSnapshot CreateRenderSnapshot(IAllocator* frameAllocator, const RenderTargetGroup* renderTarget, const Integer2& resolution, const Colour& clearColour, const RenderCamera& renderCamera) noexcept;
         
         /// Performs the Scene Snapshot through to the Render Command Queue Compilation Stages and
         /// then stores the output render command buffer render to later be processed by the
@@ -159,7 +159,7 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void CameraComponent::OnAddedToEntity()
     {
-        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection([=]()
+        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformInvalidatedEvent().OpenConnection([=]()
         {
             m_isFrustumCacheValid = false;
         });
@@ -29,7 +29,6 @@
 #include <ChilliSource/Rendering/Camera/OrthographicCameraComponent.h>
 
 #include <ChilliSource/Core/Base/Screen.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 
 namespace ChilliSource
@@ -46,7 +45,7 @@ namespace ChilliSource
                 break;
             case ViewportResizePolicy::k_scaleWithScreen:
                 m_referenceScreenSize = m_screen->GetResolution();
-                m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(MakeDelegate(this, &OrthographicCameraComponent::OnResolutionChanged));
+                m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(this, &OrthographicCameraComponent::OnResolutionChanged);
                 break;
         }
         
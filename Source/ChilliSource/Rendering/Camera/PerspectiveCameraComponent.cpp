@@ -29,7 +29,6 @@
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 
 #include <ChilliSource/Core/Base/Screen.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 
 namespace ChilliSource
@@ -45,7 +44,7 @@ namespace ChilliSource
             case ViewportResizePolicy::k_none:
                 break;
             case ViewportResizePolicy::k_scaleWithScreen:
-                m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(MakeDelegate(this, &PerspectiveCameraComponent::OnResolutionChanged));
+                m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(this, &PerspectiveCameraComponent::OnResolutionChanged);
                 break;
         }
         
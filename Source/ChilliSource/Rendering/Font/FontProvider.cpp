@@ -241,7 +241,7 @@ namespace ChilliSource
     //----------------------------------------------------------------------------
     void FontProvider::CreateResourceFromFileAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
     {
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const TaskContext&) noexcept
         {
             LoadFont(in_location, in_filePath, in_delegate, out_resource);
         });
@@ -281,7 +281,7 @@ namespace ChilliSource
             {
                 if(in_texture != nullptr)
                 {
-                    Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+                    Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const TaskContext&) noexcept
                     {
                         Font::Descriptor desc;
                         desc.m_texture = in_texture;
@@ -309,7 +309,7 @@ namespace ChilliSource
                     out_resource->SetLoadState(Resource::LoadState::k_failed);
                     in_delegate(out_resource);
                 }
-            });
+            }, out_resource->GetLoadPriority());
         }
     }
 }
@@ -49,6 +49,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(RenderFrame);
     CS_FORWARDDECLARE_CLASS(RenderFrameData);
     CS_FORWARDDECLARE_CLASS(RenderObject);
+    CS_FORWARDDECLARE_CLASS(RenderObjectGrid);
     CS_FORWARDDECLARE_CLASS(RenderPass);
     CS_FORWARDDECLARE_CLASS(RenderPassObject);
     CS_FORWARDDECLARE_CLASS(RenderSnapshot);
@@ -134,7 +135,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(CSParticleProvider);
     CS_FORWARDDECLARE_CLASS(ParticleEffect);
     CS_FORWARDDECLARE_CLASS(ParticleEffectComponent);
-    CS_FORWARDDECLARE_STRUCT(Particle);
+    CS_FORWARDDECLARE_CLASS(ParticleArray);
     CS_FORWARDDECLARE_CLASS(ParticleDrawable);
     CS_FORWARDDECLARE_CLASS(ParticleDrawableDef);
     CS_FORWARDDECLARE_CLASS(ParticleDrawableDefFactory);
@@ -203,6 +204,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(RenderCommandBufferManager);
     CS_FORWARDDECLARE_CLASS(RenderCommandList);
     CS_FORWARDDECLARE_CLASS(RenderInstanceRenderCommand);
+    CS_FORWARDDECLARE_CLASS(RenderInstancesRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadMaterialGroupRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadMeshRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadShaderRenderCommand);
@@ -93,6 +93,13 @@ namespace ChilliSource
         ///
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
+        /// Lights only read the state of their own entity when snapshotted, so can be snapshotted
+        /// on a background thread.
+        ///
+        /// @return Whether or not the render snapshot event can be called from a background thread.
+        ///
+        bool IsRenderSnapshotThreadSafe() const noexcept override { return true; }
+        
         Colour m_colour;
         f32 m_intensity;
     };
@@ -25,7 +25,6 @@
 #include <ChilliSource/Rendering/Lighting/DirectionalLightComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
@@ -151,24 +150,26 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void DirectionalLightComponent::OnAddedToScene() noexcept
     {
-        auto& transform = GetEntity()->GetTransform();
+        m_isDirectionValid = false;
         
-        m_direction = Vector3::Rotate(Vector3::k_unitPositiveZ, transform.GetWorldOrientation());
-        
-        m_transformChangedConnection = transform.GetTransformChangedEvent().OpenConnection(MakeDelegate(this, &DirectionalLightComponent::OnEntityTransformChanged));
+        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformInvalidatedEvent().OpenConnection(this, &DirectionalLightComponent::OnEntityTransformChanged);
     }
     
     //------------------------------------------------------------------------------
     void DirectionalLightComponent::OnEntityTransformChanged() noexcept
     {
-        auto& transform = GetEntity()->GetTransform();
-        
-        m_direction = Vector3::Rotate(Vector3::k_unitPositiveZ, transform.GetWorldOrientation());
+        m_isDirectionValid = false;
     }
     
     //------------------------------------------------------------------------------
     void DirectionalLightComponent::OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
     {
+        if (m_isDirectionValid == false)
+        {
+            m_direction = Vector3::Rotate(Vector3::k_unitPositiveZ, GetEntity()->GetTransform().GetWorldOrientation());
+            m_isDirectionValid = true;
+        }
+        
         if (m_shadowMap)
         {
             const auto& transform = GetEntity()->GetTransform();
@@ -28,7 +28,6 @@
 
 #include <ChilliSource/Rendering/Lighting/PointLightComponent.h>
 
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Lighting/PointRenderLight.h>
@@ -91,22 +90,26 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PointLightComponent::OnAddedToScene() noexcept
     {
-        auto& transform = GetEntity()->GetTransform();
+        m_isLightPositionValid = false;
         
-        m_lightPosition = transform.GetWorldPosition();
-        
-        m_transformChangedConnection = transform.GetTransformChangedEvent().OpenConnection(MakeDelegate(this, &PointLightComponent::OnEntityTransformChanged));
+        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformInvalidatedEvent().OpenConnection(this, &PointLightComponent::OnEntityTransformChanged);
     }
     
     //------------------------------------------------------------------------------
     void PointLightComponent::OnEntityTransformChanged() noexcept
     {
-        m_lightPosition = GetEntity()->GetTransform().GetWorldPosition();
+        m_isLightPositionValid = false;
     }
     
     //------------------------------------------------------------------------------
     void PointLightComponent::OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
     {
+        if (m_isLightPositionValid == false)
+        {
+            m_lightPosition = GetEntity()->GetTransform().GetWorldPosition();
+            m_isLightPositionValid = true;
+        }
+        
         renderSnapshot.AddPointRenderLight(PointRenderLight(GetFinalColour(), m_lightPosition, m_attenuation, m_rangeOfInfluence));
     }
     
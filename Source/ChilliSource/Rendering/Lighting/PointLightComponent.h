@@ -133,7 +133,8 @@ namespace ChilliSource
         ///
         void OnAddedToScene() noexcept override;
         
-        /// Triggered when the entity transform changes, updating the light view matrix.
+        /// Triggered when the entity transform is invalidated, so that the light position is
+        /// recalculated when it is next needed.
         ///
         void OnEntityTransformChanged() noexcept;
         
@@ -148,6 +149,13 @@ namespace ChilliSource
         ///
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
+        /// Lights only read the state of their own entity when snapshotted, so can be snapshotted
+        /// on a background thread.
+        ///
+        /// @return Whether or not the render snapshot event can be called from a background thread.
+        ///
+        bool IsRenderSnapshotThreadSafe() const noexcept override { return true; }
+        
         /// Triggered when either the component is removed from an entity which is currently in the
         /// scene, or the owning entity is removed from the scene.
         ///
@@ -159,6 +167,7 @@ namespace ChilliSource
         f32 m_minLightInfluence;
         
         Vector3 m_lightPosition;
+        bool m_isLightPositionValid = false;
         f32 m_rangeOfInfluence = 0.0f;
         Vector3 m_attenuation;
         
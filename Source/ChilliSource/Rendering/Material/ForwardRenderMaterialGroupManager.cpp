@@ -24,6 +24,7 @@
 #include <ChilliSource/Rendering/Material/ForwardRenderMaterialGroupManager.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 #include <ChilliSource/Rendering/Base/BlendMode.h>
@@ -594,11 +595,20 @@ namespace ChilliSource
             m_animatedShadowMap = resourcePool->LoadResource<Shader>(StorageLocation::k_chilliSource, "Shaders/Animated-ShadowMap.csshader");
             m_animatedBlinnDirectionalShadows = resourcePool->LoadResource<Shader>(StorageLocation::k_chilliSource, "Shaders/Animated-Blinn-DirectionalShadows.csshader");
         }
+        
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        CS_ASSERT(memoryTracker, "MemoryTracker must exist.");
+        memoryTracker->RegisterAllocator("Render Material Pool", &m_renderMaterialPool);
+        memoryTracker->RegisterAllocator("Render Material Group Pool", &m_renderMaterialGroupPool);
     }
     
     //------------------------------------------------------------------------------
     void ForwardRenderMaterialGroupManager::OnDestroy() noexcept
     {
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        memoryTracker->DeregisterAllocator(&m_renderMaterialPool);
+        memoryTracker->DeregisterAllocator(&m_renderMaterialGroupPool);
+        
         m_spriteUnlit.reset();
         
         m_skybox.reset();
@@ -26,7 +26,7 @@
 #define _CHILLISOURCE_RENDERING_MATERIAL_FORWARDRENDERMATERIALGROUPMANAGER_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentObjectPoolAllocator.h>
 #include <ChilliSource/Rendering/Material/RenderMaterialGroupManager.h>
 
 namespace ChilliSource
@@ -202,11 +202,13 @@ namespace ChilliSource
     private:
         friend class RenderMaterialGroupManager;
         
-        /// The init lifecycle event. Loads all shaders used by the system.
+        /// The init lifecycle event. Loads all shaders used by the system and registers the
+        /// render material pools with the memory tracker.
         ///
         void OnInit() noexcept override;
         
-        /// The destroy lifecycle event. Unloads all shaders used by the system.
+        /// The destroy lifecycle event. Unloads all shaders used by the system and deregisters
+        /// the render material pools from the memory tracker.
         ///
         void OnDestroy() noexcept override;
         
@@ -236,8 +238,8 @@ namespace ChilliSource
                                                       std::array<const RenderMaterial*, RenderMaterialGroup::k_numMaterialSlots>& out_renderMaterialSlots, std::vector<UniquePtr<RenderMaterial>>& out_renderMaterials) noexcept;
         
         
-        ObjectPoolAllocator<RenderMaterial> m_renderMaterialPool;
-        ObjectPoolAllocator<RenderMaterialGroup> m_renderMaterialGroupPool;
+        ConcurrentObjectPoolAllocator<RenderMaterial> m_renderMaterialPool;
+        ConcurrentObjectPoolAllocator<RenderMaterialGroup> m_renderMaterialGroupPool;
         
         bool m_shadowsSupported = false;
         
@@ -29,7 +29,6 @@
 #include <ChilliSource/Rendering/Material/Material.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Base/BlendMode.h>
 #include <ChilliSource/Rendering/Base/CullFace.h>
 #include <ChilliSource/Rendering/Base/StencilOp.h>
@@ -412,7 +411,8 @@ namespace ChilliSource
     //-----------------------------------------------------------
     const RenderMaterialGroup* Material::GetRenderMaterialGroup() const noexcept
     {
-        CS_RELEASE_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread(), "Must be run in main thread.");
+        //Materials are shared between entities which can be snapshotted in parallel, so only one thread rebuilds the cache.
+        std::unique_lock<std::mutex> lock(m_renderMaterialGroupMutex);
         
         if (!m_isCacheValid || !m_isVariableCacheValid || !m_renderMaterialGroup || !VerifyTexturesAreValid())
         {
@@ -42,6 +42,7 @@
 #include <ChilliSource/Rendering/Material/MaterialShadingType.h>
 
 #include <array>
+#include <mutex>
 #include <unordered_map>
 
 namespace ChilliSource
@@ -483,8 +484,9 @@ namespace ChilliSource
         /// material. This generated RenderMaterialGroup is cached
         /// and only re-generated when necessary.
         ///
-        /// This is not thread safe and should only be called from
-        /// the main thread.
+        /// This can be called from a background thread during the
+        /// render snapshot, but the material must not be modified
+        /// at the same time.
         ///
         /// @author Ian Copland
         ///
@@ -609,6 +611,7 @@ namespace ChilliSource
         mutable bool m_isVariableCacheValid = true;
         mutable UniquePtr<RenderMaterialGroup> m_renderMaterialGroup;
         mutable std::vector<const RenderTexture*> m_cachedRenderTextures;
+        mutable std::mutex m_renderMaterialGroupMutex;
     };
 }
 
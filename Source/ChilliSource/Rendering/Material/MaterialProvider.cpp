@@ -712,7 +712,7 @@ namespace ChilliSource
                             });
                             return;
                         }
-                    });
+                    }, out_material->GetLoadPriority());
                     break;
                 }
                 case ResourceType::k_texture:
@@ -748,7 +748,7 @@ namespace ChilliSource
                                      Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept { in_delegate(out_material); });
                                      return;
                                  }
-                             });
+                             }, out_material->GetLoadPriority());
                             break;
                         }
                         case TextureType::k_cubemap:
@@ -780,7 +780,7 @@ namespace ChilliSource
                                      Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept { in_delegate(out_material); });
                                      return;
                                  }
-                             });
+                             }, out_material->GetLoadPriority());
                             break;
                         }
                     }
@@ -891,7 +891,7 @@ namespace ChilliSource
     //----------------------------------------------------------------------------
     void MaterialProvider::CreateResourceFromFileAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
     {
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const TaskContext&) noexcept
         {
             BuildMaterialTask(in_location, in_filePath, in_delegate, out_resource);
         });
@@ -202,6 +202,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnVolumeChanged();
         
         SetMaterial(GetMaterialForMesh(0));
         
@@ -221,6 +222,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnVolumeChanged();
         
         SetMaterial(material);
         
@@ -246,6 +248,7 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        OnVolumeChanged();
         
         Reset();
     }
@@ -518,6 +521,12 @@ namespace ChilliSource
         CS_ASSERT(m_activeAnimationGroup->GetAnimationCount() > 0, "Must have at least one attached animation.");
         
         UpdateAnimationTimer(deltaTime);
+        BuildAnimation();
+    }
+    
+    //------------------------------------------------------------------------------
+    void AnimatedModelComponent::BuildAnimation() noexcept
+    {
         m_activeAnimationGroup->BuildAnimationData(m_animationBlendType, m_playbackPosition, m_blendlinePosition);
         
         //if there is a group fading out, then apply this to the active data.
@@ -631,9 +640,11 @@ namespace ChilliSource
         CS_ASSERT(m_model->GetNumMeshes() == m_materials.size(), "Invalid number of materials.");
         CS_ASSERT(m_activeAnimationGroup, "An animated model must always have an active animation group.");
         
+        //The timer isn't updated here as it can send events, and this may be called on a background
+        //thread. Any change to the timer is applied on the next update.
         if (m_animationDataDirty == true)
         {
-            UpdateAnimation(0.0f);
+            BuildAnimation();
         }
         
         for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
@@ -498,6 +498,12 @@ namespace ChilliSource
         ///     The delta time.
         ///
         void UpdateAnimation(f32 deltaTime) noexcept;
+        
+        /// Rebuilds the animation matrices for the current playback position, without updating
+        /// the animation timer. This doesn't send any events, but does update the transforms of
+        /// attached entities.
+        ///
+        void BuildAnimation() noexcept;
 
         /// Updates the animation timer.
         ///
@@ -535,6 +541,15 @@ namespace ChilliSource
         ///
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
+        /// Animated models can be snapshotted on a background thread unless they have attached
+        /// entities, as the attached entity transforms are updated if the animation is rebuilt.
+        /// Entities are only attached and detached from the main thread, so this doesn't change
+        /// during the snapshot.
+        ///
+        /// @return Whether or not the render snapshot event can be called from a background thread.
+        ///
+        bool IsRenderSnapshotThreadSafe() const noexcept override { return m_attachedEntities.empty(); }
+        
         /// Triggered when the component is removed to the scene.
         ///
         void OnRemovedFromScene() noexcept override;
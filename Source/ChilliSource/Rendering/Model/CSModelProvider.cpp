@@ -503,7 +503,7 @@ namespace ChilliSource
         ModelSPtr meshResource = std::static_pointer_cast<Model>(out_resource);
         
         //Load model as task
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const TaskContext&) noexcept
         {
             LoadMeshDataTask(in_location, in_filePath, in_delegate, meshResource);
         });
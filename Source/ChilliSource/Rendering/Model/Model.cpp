@@ -155,6 +155,23 @@ namespace ChilliSource
         return m_renderMeshes[index].get();
     }
     
+    //------------------------------------------------------------------------------
+    std::size_t Model::GetEstimatedMemoryUsage() const noexcept
+    {
+        if (GetLoadState() != LoadState::k_loaded)
+        {
+            return 0;
+        }
+        
+        std::size_t numBytes = 0;
+        for (const auto& renderMesh : m_renderMeshes)
+        {
+            numBytes += renderMesh->GetEstimatedMemoryUsage();
+        }
+        
+        return numBytes;
+    }
+    
     //------------------------------------------------------------------------------
     void Model::DestroyRenderMeshes() noexcept
     {
@@ -122,6 +122,11 @@ namespace ChilliSource
         ///
         const RenderMesh* GetRenderMesh(u32 index) const noexcept;
         
+        /// @return The estimated memory used by the mesh data of the model in bytes, or zero
+        ///     if it has not been built.
+        ///
+        std::size_t GetEstimatedMemoryUsage() const noexcept override;
+        
         ~Model() noexcept;
         
     private:
@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Model/RenderMesh.h>
 
+#include <ChilliSource/Rendering/Model/IndexFormat.h>
+
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
@@ -33,4 +35,17 @@ namespace ChilliSource
           m_shouldBackupData(shouldBackupData), m_inverseBindPoseMatrices(std::move(inverseBindPoseMatrices))
     {
     }
+    
+    //------------------------------------------------------------------------------
+    std::size_t RenderMesh::GetEstimatedMemoryUsage() const noexcept
+    {
+        std::size_t numBytes = std::size_t(m_numVertices) * m_vertexFormat.GetSize() + std::size_t(m_numIndices) * GetIndexSize(m_indexFormat);
+        
+        if (m_shouldBackupData)
+        {
+            numBytes *= 2;
+        }
+        
+        return numBytes;
+    }
 }
@@ -96,6 +96,13 @@ namespace ChilliSource
         ///
         bool ShouldBackupData() const noexcept { return m_shouldBackupData; }
         
+        /// This is an estimate based on the vertex and index buffer sizes, including the
+        /// main memory backup if there is one.
+        ///
+        /// @return The estimated memory used by the mesh data in bytes.
+        ///
+        std::size_t GetEstimatedMemoryUsage() const noexcept;
+        
         /// @return The inverse bind pose matrices for this mesh. Only applies to animated meshes.
         ///
         const std::vector<Matrix4>& GetInverseBindPoseMatrices() const noexcept { return m_inverseBindPoseMatrices; }
@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Model/RenderMeshManager.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Base/TargetType.h>
 
@@ -56,6 +58,20 @@ namespace ChilliSource
     {
         return (RenderMeshManager::InterfaceID == interfaceId);
     }
+    
+    //------------------------------------------------------------------------------
+    void RenderMeshManager::OnInit() noexcept
+    {
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        CS_ASSERT(memoryTracker, "MemoryTracker must exist.");
+        memoryTracker->RegisterAllocator("Render Mesh Pool", &m_renderMeshPool);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderMeshManager::OnDestroy() noexcept
+    {
+        Application::Get()->GetSystem<MemoryTracker>()->DeregisterAllocator(&m_renderMeshPool);
+    }
 
     //------------------------------------------------------------------------------
     UniquePtr<RenderMesh> RenderMeshManager::CreateRenderMesh(PolygonType polygonType, const VertexFormat& vertexFormat, IndexFormat indexFormat, u32 numVertices, u32 numIndices, const Sphere& boundingSphere,
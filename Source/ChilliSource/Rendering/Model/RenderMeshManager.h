@@ -26,7 +26,7 @@
 #define _CHILLISOURCE_RENDERING_SHADER_RENDERMESHMANAGER_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentObjectPoolAllocator.h>
 #include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Model/RenderMesh.h>
@@ -133,6 +133,14 @@ namespace ChilliSource
         
         RenderMeshManager();
         
+        /// The init lifecycle event. Registers the render mesh pool with the memory tracker.
+        ///
+        void OnInit() noexcept override;
+        
+        /// The destroy lifecycle event. Deregisters the render mesh pool from the memory tracker.
+        ///
+        void OnDestroy() noexcept override;
+        
         /// Called during the Render Snapshot stage of the render pipeline. All pending load and
         /// unload commands are added to the render snapshot.
         ///
@@ -146,7 +154,7 @@ namespace ChilliSource
         void OnRenderSnapshot(TargetType targetType, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
         std::mutex m_mutex;
-        ObjectPoolAllocator<RenderMesh> m_renderMeshPool;
+        ConcurrentObjectPoolAllocator<RenderMesh> m_renderMeshPool;
         std::vector<PendingLoadCommand> m_pendingLoadCommands;
         std::vector<UniquePtr<RenderMesh>> m_pendingUnloadCommands;
     };
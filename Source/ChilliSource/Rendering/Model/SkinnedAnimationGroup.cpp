@@ -27,12 +27,15 @@
 //
 
 #include <ChilliSource/Rendering/Model/SkinnedAnimationGroup.h>
+#include <ChilliSource/Core/Math/BatchMath.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/MathUtils.h>
 #include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Model/Skeleton.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     //-----------------------------------------------------------
@@ -216,24 +219,26 @@ namespace ChilliSource
         const std::vector<s32>& joints = mpSkeleton.GetJointIndices();
         CS_ASSERT(joints.size() == in_inverseBindPoseMatrices.size(), "Cannot apply bind pose matrices to joint matrices, because they are not from the same skeleton.");
         
+        //gather the animation matrix for each joint so that the bind pose can be applied to all joints in a single batch.
+        const u32 numJoints = u32(std::min(joints.size(), in_inverseBindPoseMatrices.size()));
+        auto combinedMatrices = MakeUniqueArray<Matrix4>(*in_allocator, numJoints);
+        for (u32 i = 0; i < numJoints; ++i)
+        {
+            combinedMatrices[i] = mCurrentAnimationMatrices[joints[i]];
+        }
+        BatchMath::MultiplyMatrices(in_inverseBindPoseMatrices.data(), combinedMatrices.get(), numJoints, combinedMatrices.get());
+        
         constexpr u32 k_numVectorsPerJoint = 3;
         auto jointDataSize = joints.size() * k_numVectorsPerJoint;
         auto jointData = MakeUniqueArray<Vector4>(*in_allocator, jointDataSize);
         
-        s32 count = 0;
-        std::vector<s32>::const_iterator joint = joints.begin();
-        for (auto ibp = in_inverseBindPoseMatrices.begin(); joint != joints.end() && ibp != in_inverseBindPoseMatrices.end();)
+        for (u32 i = 0; i < numJoints; ++i)
         {
-            Matrix4 combinedMatrix = ((*ibp) * (mCurrentAnimationMatrices[*joint]));
-            
-            jointData[count * 3 + 0] = Vector4(combinedMatrix.m[0], combinedMatrix.m[4], combinedMatrix.m[8], combinedMatrix.m[12]);
-            jointData[count * 3 + 1] = Vector4(combinedMatrix.m[1], combinedMatrix.m[5], combinedMatrix.m[9], combinedMatrix.m[13]);
-            jointData[count * 3 + 2] = Vector4(combinedMatrix.m[2], combinedMatrix.m[6], combinedMatrix.m[10], combinedMatrix.m[14]);
+            const Matrix4& combinedMatrix = combinedMatrices[i];
             
-            //incriment the iterators
-            ++joint;
-            ++ibp;
-            count++;
+            jointData[i * 3 + 0] = Vector4(combinedMatrix.m[0], combinedMatrix.m[4], combinedMatrix.m[8], combinedMatrix.m[12]);
+            jointData[i * 3 + 1] = Vector4(combinedMatrix.m[1], combinedMatrix.m[5], combinedMatrix.m[9], combinedMatrix.m[13]);
+            jointData[i * 3 + 2] = Vector4(combinedMatrix.m[2], combinedMatrix.m[6], combinedMatrix.m[10], combinedMatrix.m[14]);
         }
         
         return MakeUnique<RenderSkinnedAnimation>(*in_allocator, std::move(jointData), u32(jointDataSize));
@@ -29,7 +29,6 @@
 #include <ChilliSource/Rendering/Model/StaticModelComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
@@ -209,6 +208,10 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        m_isAABBValid = false;
+        m_isBoundingSphereValid = false;
+        m_areRenderObjectsValid = false;
+        OnVolumeChanged();
         
         SetMaterial(GetMaterialForMesh(0));
     }
@@ -226,6 +229,10 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        m_isAABBValid = false;
+        m_isBoundingSphereValid = false;
+        m_areRenderObjectsValid = false;
+        OnVolumeChanged();
         
         SetMaterial(material);
     }
@@ -250,6 +257,10 @@ namespace ChilliSource
         
         m_oobb.SetSize(m_model->GetAABB().GetSize());
         m_oobb.SetOrigin(m_model->GetAABB().GetOrigin());
+        m_isAABBValid = false;
+        m_isBoundingSphereValid = false;
+        m_areRenderObjectsValid = false;
+        OnVolumeChanged();
     }
     
     //------------------------------------------------------------------------------
@@ -317,13 +328,17 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void StaticModelComponent::SetShadowCastingEnabled(bool enabled) noexcept
     {
-        m_shadowCastingEnabled = enabled;
+        if (m_shadowCastingEnabled != enabled)
+        {
+            m_shadowCastingEnabled = enabled;
+            m_areRenderObjectsValid = false;
+        }
     }
     
     //------------------------------------------------------------------------------
     void StaticModelComponent::OnAddedToScene() noexcept
     {
-        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(MakeDelegate(this, &StaticModelComponent::OnEntityTransformChanged));
+        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformInvalidatedEvent().OpenConnection(this, &StaticModelComponent::OnEntityTransformChanged);
         
         OnEntityTransformChanged();
     }
@@ -334,6 +349,18 @@ namespace ChilliSource
         m_isAABBValid = false;
         m_isOOBBValid = false;
         m_isBoundingSphereValid = false;
+        m_areRenderObjectsValid = false;
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderObject StaticModelComponent::BuildRenderObject(u32 meshIndex, const RenderMaterialGroup* renderMaterialGroup) const noexcept
+    {
+        auto renderMesh = m_model->GetRenderMesh(meshIndex);
+        
+        const auto& transform = GetEntity()->GetTransform();
+        auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldOrientation(), transform.GetWorldScale());
+        
+        return RenderObject(renderMaterialGroup, renderMesh, transform.GetWorldTransform(), boundingSphere, m_shadowCastingEnabled, RenderLayer::k_standard);
     }
     
     //------------------------------------------------------------------------------
@@ -342,23 +369,44 @@ namespace ChilliSource
         CS_ASSERT(m_model->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a model that hasn't been loaded yet.");
         CS_ASSERT(m_model->GetNumMeshes() == m_materials.size(), "Invalid number of materials.");
         
+        if (!m_areRenderObjectsValid)
+        {
+            m_renderObjects.clear();
+        }
+        
         for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
         {
             CS_ASSERT(m_materials[index]->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a material that hasn't been loaded yet.");
             
+            // The render material group is owned by the material and can be recreated whenever the material
+            // changes, so it is checked every frame.
             auto renderMaterialGroup = m_materials[index]->GetRenderMaterialGroup();
-            auto renderMesh = m_model->GetRenderMesh(index);
-            
-            const auto& transform = GetEntity()->GetTransform();
-            auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldOrientation(), transform.GetWorldScale());
             
-            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, GetEntity()->GetTransform().GetWorldTransform(), boundingSphere, m_shadowCastingEnabled, RenderLayer::k_standard));
+            if (index >= m_renderObjects.size())
+            {
+                m_renderObjects.push_back(BuildRenderObject(index, renderMaterialGroup));
+                renderSnapshot.AddRenderObject(m_renderObjects[index]);
+            }
+            else if (m_renderObjects[index].GetRenderMaterialGroup() != renderMaterialGroup)
+            {
+                m_renderObjects[index] = BuildRenderObject(index, renderMaterialGroup);
+                renderSnapshot.AddRenderObject(m_renderObjects[index]);
+            }
+            else
+            {
+                renderSnapshot.AddRetainedRenderObject(m_renderObjects[index]);
+            }
         }
+        
+        m_areRenderObjectsValid = true;
     }
     
     //------------------------------------------------------------------------------
     void StaticModelComponent::OnRemovedFromScene() noexcept
     {
         m_transformChangedConnection.reset();
+        
+        m_renderObjects.clear();
+        m_areRenderObjectsValid = false;
     }
 }
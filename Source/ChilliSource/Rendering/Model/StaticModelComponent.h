@@ -27,13 +27,19 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
+#include <ChilliSource/Rendering/Base/RenderObject.h>
 #include <ChilliSource/Rendering/Model/Model.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     /// A static model component. This defines a 3D model that can be manipulated, textured
     /// but not animated.
     ///
+    /// The render objects describing the model are retained between frames, and are only
+    /// rebuilt when the transform, model or materials change.
+    ///
     /// This is not thread safe and should not be used on multiple threads at once.
     ///
     class StaticModelComponent final : public VolumeComponent
@@ -198,8 +204,19 @@ namespace ChilliSource
         ///
         void OnEntityTransformChanged() noexcept;
         
+        /// Builds the render object for the given mesh using the current transform.
+        ///
+        /// @param meshIndex
+        ///     The index of the mesh.
+        /// @param renderMaterialGroup
+        ///     The render material group currently used by the mesh.
+        ///
+        /// @return The new render object.
+        ///
+        RenderObject BuildRenderObject(u32 meshIndex, const RenderMaterialGroup* renderMaterialGroup) const noexcept;
+        
         /// Called during the render snapshot phase. Adds render objects to the scene
-        /// describing the model.
+        /// describing the model. These are retained from the previous frame where possible.
         ///
         /// @param renderSnapshot
         ///     The render snapshot.
@@ -208,6 +225,13 @@ namespace ChilliSource
         ///
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
+        /// Static models only modify their own state when snapshotted, so can be snapshotted
+        /// on a background thread.
+        ///
+        /// @return Whether or not the render snapshot event can be called from a background thread.
+        ///
+        bool IsRenderSnapshotThreadSafe() const noexcept override { return true; }
+        
         /// Triggered when the component is removed from an entity on the scene.
         ///
         void OnRemovedFromScene() noexcept override;
@@ -223,6 +247,10 @@ namespace ChilliSource
         bool m_isAABBValid = false;
         bool m_isOOBBValid = false;
         bool m_isBoundingSphereValid = false;
+        
+        std::vector<RenderObject> m_renderObjects;
+        bool m_areRenderObjectsValid = false;
+        
         EventConnectionUPtr m_transformChangedConnection;
     };
 }
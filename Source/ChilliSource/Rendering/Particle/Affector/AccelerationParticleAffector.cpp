@@ -29,7 +29,7 @@
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 
@@ -37,31 +37,44 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAcceleration(in_particleArray->size())
+    AccelerationParticleAffector::AccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
+        : ParticleAffector(in_affectorDef, in_particleArray)
     {
         //This can only be created by the AccelerationParticleAffectorDef so this is safe.
         m_accelerationAffectorDef = static_cast<const AccelerationParticleAffectorDef*>(in_affectorDef);
+
+        //one stream for each component of the acceleration.
+        m_accelerationStreams = in_particleArray->AddCustomStreams(3);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void AccelerationParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        CS_ASSERT(in_index >= 0 && in_index < m_particleAcceleration.size(), "Index out of bounds!");
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_index < particleArray->GetSize(), "Index out of bounds!");
 
-        m_particleAcceleration[in_index] = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+        Vector3 acceleration = m_accelerationAffectorDef->GetAccelerationProperty()->GenerateValue(in_effectProgress);
+        particleArray->GetCustomStream(m_accelerationStreams)[in_index] = acceleration.x;
+        particleArray->GetCustomStream(m_accelerationStreams + 1)[in_index] = acceleration.y;
+        particleArray->GetCustomStream(m_accelerationStreams + 2)[in_index] = acceleration.z;
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void AccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleArray* particleArray = GetParticleArray();
+        const u32 numParticles = particleArray->GetSize();
+
+        const ParticleArray::Stream velocityStreams[] = { ParticleArray::Stream::k_velocityX, ParticleArray::Stream::k_velocityY, ParticleArray::Stream::k_velocityZ };
+        for (u32 component = 0; component < 3; ++component)
         {
-            Particle& particle = particleArray->at(i);
-            Vector3& acceleration = m_particleAcceleration[i];
+            f32* velocities = particleArray->GetStream(velocityStreams[component]);
+            const f32* accelerations = particleArray->GetCustomStream(m_accelerationStreams + component);
 
-            particle.m_velocity += acceleration * in_deltaTime;
+            for (u32 i = 0; i < numParticles; ++i)
+            {
+                velocities[i] += accelerations[i] * in_deltaTime;
+            }
         }
     }
 }
@@ -29,7 +29,7 @@
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffectorDef.h>
 
@@ -37,30 +37,36 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleAngularAcceleration(in_particleArray->size())
+    AngularAccelerationParticleAffector::AngularAccelerationParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
+        : ParticleAffector(in_affectorDef, in_particleArray)
     {
         //This can only be created by the AngularAccelerationParticleAffectorDef so this is safe.
         m_angularAccelerationAffectorDef = static_cast<const AngularAccelerationParticleAffectorDef*>(in_affectorDef);
+
+        m_angularAccelerationStream = in_particleArray->AddCustomStreams(1);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void AngularAccelerationParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        CS_ASSERT(in_index >= 0 && in_index < m_particleAngularAcceleration.size(), "Index out of bounds!");
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_index < particleArray->GetSize(), "Index out of bounds!");
 
-        m_particleAngularAcceleration[in_index] = m_angularAccelerationAffectorDef->GetAngularAccelerationProperty()->GenerateValue(in_effectProgress);
+        particleArray->GetCustomStream(m_angularAccelerationStream)[in_index] = m_angularAccelerationAffectorDef->GetAngularAccelerationProperty()->GenerateValue(in_effectProgress);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void AngularAccelerationParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleArray* particleArray = GetParticleArray();
+        const u32 numParticles = particleArray->GetSize();
+
+        f32* angularVelocities = particleArray->GetStream(ParticleArray::Stream::k_angularVelocity);
+        const f32* angularAccelerations = particleArray->GetCustomStream(m_angularAccelerationStream);
+
+        for (u32 i = 0; i < numParticles; ++i)
         {
-            Particle& particle = particleArray->at(i);
-            f32 angularAcceleration = m_particleAngularAcceleration[i];
-            particle.m_angularVelocity += angularAcceleration * in_deltaTime;
+            angularVelocities[i] += angularAccelerations[i] * in_deltaTime;
         }
     }
 }
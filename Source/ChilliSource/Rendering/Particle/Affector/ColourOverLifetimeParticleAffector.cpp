@@ -29,7 +29,7 @@
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
@@ -48,31 +48,44 @@ namespace ChilliSource
         {
             return MathUtils::Clamp(in_value, 0.0f, 1.0f);
         }
+
+        //each colour key for a particle is stored as a time stream followed by a stream for each colour component.
+        constexpr u32 k_streamsPerColourKey = 5;
     }
     
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
+    ColourOverLifetimeParticleAffector::ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
     :ParticleAffector(in_affectorDef, in_particleArray)
-    ,m_particleColourData(0)
     {
         m_colourOverLifetimeAffectorDef = static_cast<const ColourOverLifetimeParticleAffectorDef*>(in_affectorDef);
         m_intermediateParticles = static_cast<u32>(m_colourOverLifetimeAffectorDef->GetIntermediateColours().size());
-        m_particleColourData = dynamic_array<ColourData>(in_particleArray->size() * (2 + m_intermediateParticles));
+        m_colourStreams = in_particleArray->AddCustomStreams((2 + m_intermediateParticles) * k_streamsPerColourKey);
+        m_lifeProgress.reserve(in_particleArray->GetCapacity());
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ColourOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        u32 colourDataIndex = in_index * (2 + m_intermediateParticles);
-        CS_ASSERT(colourDataIndex >= 0 && colourDataIndex < m_particleColourData.size(), "colourDataIndex out of bounds!");
-        
-        ColourData& colourDataInitial = m_particleColourData[colourDataIndex];
-        const Particle& particle = GetParticleArray()->at(in_index);
-        
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_index < particleArray->GetSize(), "Index out of bounds!");
+
+        auto setColourKey = [&](u32 in_key, const ColourData& in_colourData)
+        {
+            u32 stream = m_colourStreams + in_key * k_streamsPerColourKey;
+            particleArray->GetCustomStream(stream)[in_index] = in_colourData.m_time;
+            particleArray->GetCustomStream(stream + 1)[in_index] = in_colourData.m_colour.r;
+            particleArray->GetCustomStream(stream + 2)[in_index] = in_colourData.m_colour.g;
+            particleArray->GetCustomStream(stream + 3)[in_index] = in_colourData.m_colour.b;
+            particleArray->GetCustomStream(stream + 4)[in_index] = in_colourData.m_colour.a;
+        };
+
+        u32 colourKey = 0;
+
+        ColourData colourDataInitial;
         colourDataInitial.m_time = 0.0f;
-        colourDataInitial.m_colour = particle.m_colour;
-        ++colourDataIndex;
+        colourDataInitial.m_colour = particleArray->GetColour(in_index);
+        setColourKey(colourKey++, colourDataInitial);
         
         // Get the intermediate colours
         std::vector<ColourData> intermediateColours;
@@ -93,14 +106,13 @@ namespace ChilliSource
         // Add to the particles colour data
         for(const auto& intermediateColour : intermediateColours)
         {
-            ColourData& colourDataIntermediate = m_particleColourData[colourDataIndex];
-            colourDataIntermediate = intermediateColour;
-            ++colourDataIndex;
+            setColourKey(colourKey++, intermediateColour);
         }
         
-        ColourData& colourDataTarget = m_particleColourData[colourDataIndex];
+        ColourData colourDataTarget;
         colourDataTarget.m_time = 1.0f;
         colourDataTarget.m_colour = m_colourOverLifetimeAffectorDef->GetTargetColourProperty()->GenerateValue(in_effectProgress);
+        setColourKey(colourKey, colourDataTarget);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -108,29 +120,41 @@ namespace ChilliSource
     {
         const auto& interpolation = m_colourOverLifetimeAffectorDef->GetInterpolation();
         
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleArray* particleArray = GetParticleArray();
+        const u32 numParticles = particleArray->GetSize();
+
+        const f32* energies = particleArray->GetStream(ParticleArray::Stream::k_energy);
+        const f32* lifetimes = particleArray->GetStream(ParticleArray::Stream::k_lifetime);
+
+        m_lifeProgress.resize(numParticles);
+        for (u32 i = 0; i < numParticles; ++i)
         {
-            Particle& particle = particleArray->at(i);
-            
-            if(particle.m_isActive == false)
+            m_lifeProgress[i] = interpolation(1.0f - (energies[i] / lifetimes[i]));
+        }
+
+        const ParticleArray::Stream colourStreams[] = { ParticleArray::Stream::k_colourR, ParticleArray::Stream::k_colourG, ParticleArray::Stream::k_colourB, ParticleArray::Stream::k_colourA };
+        for (u32 component = 0; component < 4; ++component)
+        {
+            f32* colours = particleArray->GetStream(colourStreams[component]);
+            const f32* initialColours = particleArray->GetCustomStream(m_colourStreams + 1 + component);
+
+            for (u32 i = 0; i < numParticles; ++i)
             {
-                continue;
+                colours[i] = initialColours[i];
             }
-            
-            u32 colourIndex = i * (2 + m_intermediateParticles);
-            ColourData& colourDataInitial = m_particleColourData[colourIndex];
 
-            f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-            f32 progress = interpolation(normalisedLifeProgress);
-            
-            particle.m_colour = colourDataInitial.m_colour;
-            for(u32 offset = 0; offset < m_intermediateParticles + 1; ++offset)
+            for (u32 key = 0; key < m_intermediateParticles + 1; ++key)
             {
-                ColourData& colourData = m_particleColourData[colourIndex + offset];
-                ColourData& colourDataNext = m_particleColourData[colourIndex + offset + 1];
-                f32 timeProgress = Clamp(Clamp(progress - colourData.m_time) / (colourDataNext.m_time - colourData.m_time));
-                particle.m_colour += (colourDataNext.m_colour - colourData.m_colour) * timeProgress;
+                const f32* times = particleArray->GetCustomStream(m_colourStreams + key * k_streamsPerColourKey);
+                const f32* nextTimes = particleArray->GetCustomStream(m_colourStreams + (key + 1) * k_streamsPerColourKey);
+                const f32* keyColours = particleArray->GetCustomStream(m_colourStreams + key * k_streamsPerColourKey + 1 + component);
+                const f32* nextKeyColours = particleArray->GetCustomStream(m_colourStreams + (key + 1) * k_streamsPerColourKey + 1 + component);
+
+                for (u32 i = 0; i < numParticles; ++i)
+                {
+                    f32 timeProgress = Clamp(Clamp(m_lifeProgress[i] - times[i]) / (nextTimes[i] - times[i]));
+                    colours[i] += (nextKeyColours[i] - keyColours[i]) * timeProgress;
+                }
             }
         }
     }
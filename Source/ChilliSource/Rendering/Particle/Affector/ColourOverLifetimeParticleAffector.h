@@ -31,9 +31,10 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     //---------------------------------------------------------------------
@@ -94,11 +95,12 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        ColourOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
         
     private:
         const ColourOverLifetimeParticleAffectorDef* m_colourOverLifetimeAffectorDef = nullptr;
-        dynamic_array<ColourData> m_particleColourData;
+        u32 m_colourStreams = 0;
+        std::vector<f32> m_lifeProgress;
         
         u32 m_intermediateParticles = 0;
     };
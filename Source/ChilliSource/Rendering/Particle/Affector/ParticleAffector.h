@@ -53,7 +53,7 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
+        ParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
         //----------------------------------------------------------------
         /// Activates the particle with the given index.
         ///
@@ -96,11 +96,11 @@ namespace ChilliSource
         ///
         /// @return The particle array.
         //----------------------------------------------------------------
-        dynamic_array<Particle>* GetParticleArray() const;
+        ParticleArray* GetParticleArray() const;
     private:
 
         const ParticleAffectorDef* m_affectorDef = nullptr;
-        dynamic_array<Particle>* m_particleArray = nullptr;
+        ParticleArray* m_particleArray = nullptr;
     };
 }
 
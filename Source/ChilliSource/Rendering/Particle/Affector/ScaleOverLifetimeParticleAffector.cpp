@@ -29,7 +29,7 @@
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffector.h>
 
 #include <ChilliSource/Core/Math/MathUtils.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
@@ -37,37 +37,52 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray)
-        : ParticleAffector(in_affectorDef, in_particleArray), m_particleScaleData(in_particleArray->size())
+    ScaleOverLifetimeParticleAffector::ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray)
+        : ParticleAffector(in_affectorDef, in_particleArray)
     {
         //This can only be created by the ScaleOverLifetimeParticleAffectorDef so this is safe.
         m_scaleOverLifetimeAffectorDef = static_cast<const ScaleOverLifetimeParticleAffectorDef*>(in_affectorDef);
+
+        //streams for the x and y of the initial scale, followed by the x and y of the change in scale over the lifetime.
+        m_scaleStreams = in_particleArray->AddCustomStreams(4);
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ScaleOverLifetimeParticleAffector::ActivateParticle(u32 in_index, f32 in_effectProgress)
     {
-        CS_ASSERT(in_index >= 0 && in_index < m_particleScaleData.size(), "Index out of bounds!");
+        ParticleArray* particleArray = GetParticleArray();
+        CS_ASSERT(in_index < particleArray->GetSize(), "Index out of bounds!");
 
-        ScaleData& scaleData = m_particleScaleData[in_index];
-        const Particle& particle = GetParticleArray()->at(in_index);
-        
-        scaleData.m_initialScale = particle.m_scale;
+        Vector2 initialScale = particleArray->GetScale(in_index);
+        Vector2 targetScale = initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
 
-        scaleData.m_targetScale = scaleData.m_initialScale * m_scaleOverLifetimeAffectorDef->GetScaleProperty()->GenerateValue(in_effectProgress);
+        particleArray->GetCustomStream(m_scaleStreams)[in_index] = initialScale.x;
+        particleArray->GetCustomStream(m_scaleStreams + 1)[in_index] = initialScale.y;
+        particleArray->GetCustomStream(m_scaleStreams + 2)[in_index] = targetScale.x - initialScale.x;
+        particleArray->GetCustomStream(m_scaleStreams + 3)[in_index] = targetScale.y - initialScale.y;
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void ScaleOverLifetimeParticleAffector::AffectParticles(f32 in_deltaTime, f32 in_effectProgress)
     {
-        dynamic_array<Particle>* particleArray = GetParticleArray();
-        for (u32 i = 0; i < particleArray->size(); ++i)
+        ParticleArray* particleArray = GetParticleArray();
+        const u32 numParticles = particleArray->GetSize();
+
+        const f32* energies = particleArray->GetStream(ParticleArray::Stream::k_energy);
+        const f32* lifetimes = particleArray->GetStream(ParticleArray::Stream::k_lifetime);
+
+        const ParticleArray::Stream scaleStreams[] = { ParticleArray::Stream::k_scaleX, ParticleArray::Stream::k_scaleY };
+        for (u32 component = 0; component < 2; ++component)
         {
-            Particle& particle = particleArray->at(i);
-            ScaleData& scaleData = m_particleScaleData[i];
+            f32* scales = particleArray->GetStream(scaleStreams[component]);
+            const f32* initialScales = particleArray->GetCustomStream(m_scaleStreams + component);
+            const f32* scaleChanges = particleArray->GetCustomStream(m_scaleStreams + 2 + component);
 
-            f32 normalisedLifeProgress = 1.0f - (particle.m_energy / particle.m_lifetime);
-            particle.m_scale = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * normalisedLifeProgress;
+            for (u32 i = 0; i < numParticles; ++i)
+            {
+                f32 normalisedLifeProgress = 1.0f - (energies[i] / lifetimes[i]);
+                scales[i] = initialScales[i] + scaleChanges[i] * normalisedLifeProgress;
+            }
         }
     }
 }
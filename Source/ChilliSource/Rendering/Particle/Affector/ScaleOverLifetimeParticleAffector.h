@@ -31,7 +31,6 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/Vector2.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 
 namespace ChilliSource
@@ -83,21 +82,9 @@ namespace ChilliSource
         /// @param The particle affector definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, dynamic_array<Particle>* in_particleArray);
-        //----------------------------------------------------------------
-        /// A container for the initial scale and scale factor of a single 
-        /// particle.
-        ///
-        /// @author Ian Copland.
-        //----------------------------------------------------------------
-        struct ScaleData
-        {
-            Vector2 m_initialScale;
-            Vector2 m_targetScale;
-        };
-
+        ScaleOverLifetimeParticleAffector(const ParticleAffectorDef* in_affectorDef, ParticleArray* in_particleArray);
         const ScaleOverLifetimeParticleAffectorDef* m_scaleOverLifetimeAffectorDef = nullptr;
-        dynamic_array<ScaleData> m_particleScaleData;
+        u32 m_scaleStreams = 0;
     };
 }
 
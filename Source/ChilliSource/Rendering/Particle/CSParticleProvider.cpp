@@ -490,7 +490,7 @@ namespace ChilliSource
         CS_ASSERT(in_delegate != nullptr, "Async load delegate cannot be null.");
 
         ParticleEffectSPtr particleEffect = std::static_pointer_cast<ParticleEffect>(out_resource);
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const TaskContext&) noexcept
         {
             LoadCSParticleAsync(in_location, in_filePath, m_drawableDefFactory, m_emitterDefFactory, m_affectorDefFactory, in_delegate, particleEffect);
         });
@@ -28,15 +28,16 @@
 
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 
 namespace ChilliSource
 {
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
     ConcurrentParticleData::ConcurrentParticleData(u32 in_particleCount)
-        : m_particles(in_particleCount), m_lock(m_mutex, std::defer_lock)
+        : m_lock(m_mutex, std::defer_lock)
     {
+        m_particles.reserve(in_particleCount);
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
@@ -80,17 +81,17 @@ namespace ChilliSource
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    std::vector<u32> ConcurrentParticleData::TakeNewIndices()
+    std::vector<u32> ConcurrentParticleData::TakeNewIds()
     {
-        CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when taking new indices!")
+        CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when taking new ids!")
 
-        std::vector<u32> output = m_newParticleIndices;
-        m_newParticleIndices.clear();
+        std::vector<u32> output = m_newParticleIds;
+        m_newParticleIds.clear();
         return output;
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    const dynamic_array<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
+    const std::vector<ConcurrentParticleData::Particle>& ConcurrentParticleData::GetParticles() const
     {
         CS_ASSERT(m_lock.owns_lock() == true, "Must be locked when getting particles!");
 
@@ -104,31 +105,43 @@ namespace ChilliSource
     }
     //-----------------------------------------------------------------
     //-----------------------------------------------------------------
-    void ConcurrentParticleData::CommitParticleData(const dynamic_array<ChilliSource::Particle>* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere)
+    void ConcurrentParticleData::CommitParticleData(const ParticleArray* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere)
     {
         std::unique_lock<std::recursive_mutex> lock(m_mutex);
 
-        CS_ASSERT(in_particles->size() == m_particles.size(), "Particle data lists must be the same size.");
+        CS_ASSERT(in_particles->GetCapacity() <= m_particles.capacity(), "Particle array is larger than the concurrent particle data.");
 
-        m_activeParticles = false;
-        for (u32 i = 0; i < m_particles.size(); ++i)
+        const u32 numParticles = in_particles->GetSize();
+        const f32* positionsX = in_particles->GetStream(ParticleArray::Stream::k_positionX);
+        const f32* positionsY = in_particles->GetStream(ParticleArray::Stream::k_positionY);
+        const f32* positionsZ = in_particles->GetStream(ParticleArray::Stream::k_positionZ);
+        const f32* scalesX = in_particles->GetStream(ParticleArray::Stream::k_scaleX);
+        const f32* scalesY = in_particles->GetStream(ParticleArray::Stream::k_scaleY);
+        const f32* rotations = in_particles->GetStream(ParticleArray::Stream::k_rotation);
+        const f32* coloursR = in_particles->GetStream(ParticleArray::Stream::k_colourR);
+        const f32* coloursG = in_particles->GetStream(ParticleArray::Stream::k_colourG);
+        const f32* coloursB = in_particles->GetStream(ParticleArray::Stream::k_colourB);
+        const f32* coloursA = in_particles->GetStream(ParticleArray::Stream::k_colourA);
+
+        m_particles.resize(numParticles);
+        for (u32 i = 0; i < numParticles; ++i)
         {
             Particle& concurrentParticle = m_particles[i];
-            const ChilliSource::Particle& particle = (*in_particles)[i];
 
-            concurrentParticle.m_isActive = particle.m_isActive;
-            concurrentParticle.m_position = particle.m_position;
-            concurrentParticle.m_rotation = particle.m_rotation;
-            concurrentParticle.m_scale = particle.m_scale;
-            concurrentParticle.m_colour = particle.m_colour;
+            concurrentParticle.m_id = in_particles->GetId(i);
+            concurrentParticle.m_position = Vector3(positionsX[i], positionsY[i], positionsZ[i]);
+            concurrentParticle.m_rotation = rotations[i];
+            concurrentParticle.m_scale = Vector2(scalesX[i], scalesY[i]);
+            concurrentParticle.m_colour = Colour(coloursR[i], coloursG[i], coloursB[i], coloursA[i]);
+        }
+
+        m_activeParticles = (numParticles > 0);
 
-            if (concurrentParticle.m_isActive == true)
-            {
-                m_activeParticles = true;
-            }
+        for (u32 newIndex : in_newIndices)
+        {
+            m_newParticleIds.push_back(in_particles->GetId(newIndex));
         }
 
-        m_newParticleIndices.insert(m_newParticleIndices.end(), in_newIndices.begin(), in_newIndices.end());
         m_aabb = in_aabb;
         m_boundingSphere = in_boundingSphere;
         m_updating = false;
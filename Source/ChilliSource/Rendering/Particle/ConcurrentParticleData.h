@@ -31,7 +31,6 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Colour.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Geometry/Shapes.h>
@@ -54,13 +53,14 @@ namespace ChilliSource
     public:
         //-----------------------------------------------------------------
         /// A struct containing just the information required for drawing a
-        /// particle.
+        /// particle. The id of the particle is stable for the lifetime of
+        /// the particle, and is in the range zero to the particle count.
         ///
         /// @author Ian Copland
         //-----------------------------------------------------------------
         struct Particle final
         {
-            bool m_isActive = false;
+            u32 m_id = 0;
             Vector3 m_position;
             Vector2 m_scale = Vector2::k_zero;
             f32 m_rotation = 0.0f;
@@ -122,18 +122,18 @@ namespace ChilliSource
         //-----------------------------------------------------------------
         void Lock() const;
         //-----------------------------------------------------------------
-        /// Returns the list of indices that have changed since the last
-        /// time this was called. The list will be cleared when called.
-        /// Before this is called the container must be locked to ensure
-        /// that new particles are not activated prior to being rendered.
-        /// If the container is not locked the app is considered to be
-        /// in an irrecoverable state and will terminate.
+        /// Returns the ids of the particles that have been activated since
+        /// the last time this was called. The list will be cleared when
+        /// called. Before this is called the container must be locked to
+        /// ensure that new particles are not activated prior to being
+        /// rendered. If the container is not locked the app is considered
+        /// to be in an irrecoverable state and will terminate.
         /// 
         /// @author Ian Copland
         ///
-        /// @author A vector of particle indices.
+        /// @author A vector of particle ids.
         //-----------------------------------------------------------------
-        std::vector<u32> TakeNewIndices();
+        std::vector<u32> TakeNewIds();
         //-----------------------------------------------------------------
         /// Before this is called the container must be locked to ensure
         /// that any iteration over the particle data is safe. If not the
@@ -142,9 +142,9 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
-        /// @param The particle list.
+        /// @param The list of active particles.
         //-----------------------------------------------------------------
-        const dynamic_array<ConcurrentParticleData::Particle>& GetParticles() const;
+        const std::vector<ConcurrentParticleData::Particle>& GetParticles() const;
         //-----------------------------------------------------------------
         /// Unlocks the container. This should be called as soon as possible
         /// after dealing with data that needs to be locked.
@@ -159,17 +159,18 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
-        /// @param The list of particles.
-        /// @param The new indices.
+        /// @param The particle array.
+        /// @param The positions in the particle array of the particles
+        /// which have been activated during this update.
         /// @param The aabb.
         /// @param The obb.
         /// @param The bounding sphere.
         //-----------------------------------------------------------------
-        void CommitParticleData(const dynamic_array<ChilliSource::Particle>* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere);
+        void CommitParticleData(const ParticleArray* in_particles, const std::vector<u32>& in_newIndices, const AABB& in_aabb, const Sphere& in_boundingSphere);
     private:
 
-        dynamic_array<ConcurrentParticleData::Particle> m_particles;
-        std::vector<u32> m_newParticleIndices;
+        std::vector<ConcurrentParticleData::Particle> m_particles;
+        std::vector<u32> m_newParticleIds;
         AABB m_aabb;
         Sphere m_boundingSphere;
         bool m_updating = false;
@@ -44,10 +44,10 @@ namespace ChilliSource
     {
         m_concurrentParticleData->Lock();
 
-        auto newIndices = m_concurrentParticleData->TakeNewIndices();
-        for (const auto& index : newIndices)
+        auto newIds = m_concurrentParticleData->TakeNewIds();
+        for (const auto& id : newIds)
         {
-            ActivateParticle(m_concurrentParticleData->GetParticles(), index);
+            ActivateParticle(id);
         }
 
         DrawParticles(m_concurrentParticleData->GetParticles(), renderSnapshot, frameAllocator);
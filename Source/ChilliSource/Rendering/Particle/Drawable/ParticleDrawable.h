@@ -95,18 +95,15 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const ParticleDrawableDef* GetDrawableDef() const;
         //----------------------------------------------------------------
-        /// Activates the particle with the given index.
+        /// Activates the particle with the given id.
         ///
-        /// This is called on the main thread, but the particle data can 
-        /// be modified on other threads so make sure to lock it prior to 
-        /// use.
+        /// This is called on the main thread.
         ///
         /// @author Ian Copland
         ///
-        /// @param The particle draw data.
-        /// @param The index of the particle to activate.
+        /// @param The id of the particle to activate.
         //----------------------------------------------------------------
-        virtual void ActivateParticle(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) = 0;
+        virtual void ActivateParticle(u32 in_id) = 0;
         //----------------------------------------------------------------
         /// Renders all active particles in the effect. 
         ///
@@ -120,7 +117,7 @@ namespace ChilliSource
         /// @param frameAllocator - Allocate memory for this render frame
         /// from here
         //----------------------------------------------------------------
-        virtual void DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) = 0;
+        virtual void DrawParticles(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) = 0;
         
     private:
         const Entity* m_entity = nullptr;
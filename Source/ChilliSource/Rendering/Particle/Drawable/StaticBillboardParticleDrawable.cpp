@@ -30,7 +30,12 @@
 
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
+#include <ChilliSource/Rendering/Model/IndexFormat.h>
+#include <ChilliSource/Rendering/Model/PolygonType.h>
+#include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+#include <ChilliSource/Rendering/Model/VertexFormat.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Drawable/StaticBillboardParticleDrawableDef.h>
@@ -38,6 +43,7 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/BatchMath.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
@@ -49,10 +55,30 @@
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace ChilliSource
 {
     namespace
     {
+        constexpr u32 k_verticesPerBillboard = 4;
+        constexpr u32 k_indicesPerBillboard = 6;
+        constexpr u32 k_vertexDataSizePerBillboard = k_verticesPerBillboard * sizeof(SpriteVertex);
+        constexpr u32 k_indexDataSizePerBillboard = k_indicesPerBillboard * sizeof(u16);
+
+        constexpr u32 k_maxBillboardsForVertexData = RenderDynamicMesh::k_maxVertexDataSize / k_vertexDataSizePerBillboard;
+        constexpr u32 k_maxBillboardsForIndexData = RenderDynamicMesh::k_maxIndexDataSize / k_indexDataSizePerBillboard;
+
+        /// The maximum number of billboards which can be written to a single batched mesh. This is
+        /// limited by the maximum size of a dynamic mesh.
+        ///
+        constexpr u32 k_maxBillboardsPerBatch = (k_maxBillboardsForVertexData < k_maxBillboardsForIndexData) ? k_maxBillboardsForVertexData : k_maxBillboardsForIndexData;
+
+        static_assert(k_maxBillboardsPerBatch * k_verticesPerBillboard <= 65536, "Batched billboard vertices exceed the range of a short index.");
+
+        const u16 k_billboardIndices[k_indicesPerBillboard] { 0, 1, 2, 1, 3, 2 };
+
         //-----------------------------------------------------------------------------
         /// Returns the billboard size for the given size of image with the given 
         /// size policy
@@ -86,6 +112,43 @@ namespace ChilliSource
                 return Vector2::k_zero;
             }
         }
+        //-----------------------------------------------------------------------------
+        /// Transforms the position of every active particle into world space in a
+        /// single batch. Inactive particles, which have a transparent colour, are
+        /// skipped as they are never drawn.
+        ///
+        /// @param in_particleData - The particles.
+        /// @param in_entityWorldTransform - The world transform of the owning entity.
+        /// @param in_frameAllocator - The allocator the positions should be allocated
+        /// from.
+        ///
+        /// @return The world position of each active particle, in the same order as
+        /// the active particles appear in the particle data.
+        //-----------------------------------------------------------------------------
+        UniquePtr<Vector3[]> CalcActiveWorldPositions(const std::vector<ConcurrentParticleData::Particle>& in_particleData, const Matrix4& in_entityWorldTransform, IAllocator& in_frameAllocator)
+        {
+            u32 numActiveParticles = 0;
+            for (const auto& particle : in_particleData)
+            {
+                if (particle.m_colour != Colour::k_transparent)
+                {
+                    ++numActiveParticles;
+                }
+            }
+
+            auto worldPositions = MakeUniqueArray<Vector3>(in_frameAllocator, numActiveParticles);
+            u32 activeIndex = 0;
+            for (const auto& particle : in_particleData)
+            {
+                if (particle.m_colour != Colour::k_transparent)
+                {
+                    worldPositions[activeIndex++] = particle.m_position;
+                }
+            }
+
+            BatchMath::TransformPoints(worldPositions.get(), numActiveParticles, in_entityWorldTransform, worldPositions.get());
+            return worldPositions;
+        }
     }
 
     //----------------------------------------------
@@ -98,21 +161,21 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::ActivateParticle(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index)
+    void StaticBillboardParticleDrawable::ActivateParticle(u32 in_id)
     {
-        CS_ASSERT(in_index >= 0 && in_index < m_particleBillboardIndices.size(), "Index out of bounds!");
+        CS_ASSERT(in_id < m_particleBillboardIndices.size(), "Id out of bounds!");
 
         switch (m_billboardDrawableDef->GetImageSelectionType())
         {
         case StaticBillboardParticleDrawableDef::ImageSelectionType::k_cycle:
-            m_particleBillboardIndices[in_index] = m_nextBillboardIndex++;
+            m_particleBillboardIndices[in_id] = m_nextBillboardIndex++;
             if (m_nextBillboardIndex >= m_billboards->size())
             {
                 m_nextBillboardIndex = 0;
             }
             break;
         case StaticBillboardParticleDrawableDef::ImageSelectionType::k_random:
-            m_particleBillboardIndices[in_index] = Random::Generate<u32>(0, static_cast<s32>(m_billboards->size()) - 1);
+            m_particleBillboardIndices[in_id] = Random::Generate<u32>(0, static_cast<s32>(m_billboards->size()) - 1);
             break;
         default:
             CS_LOG_FATAL("Invalid image selection type.");
@@ -121,8 +184,14 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator)
+    void StaticBillboardParticleDrawable::DrawParticles(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator)
     {
+        if (m_billboardDrawableDef->GetDrawMode() == StaticBillboardParticleDrawableDef::DrawMode::k_batched)
+        {
+            DrawBatched(particleData, renderSnapshot, frameAllocator);
+            return;
+        }
+
         switch (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace())
         {
         case ParticleEffect::SimulationSpace::k_local:
@@ -183,7 +252,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::DrawLocalSpace(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const
+    void StaticBillboardParticleDrawable::DrawLocalSpace(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const
     {
         auto renderMaterialGroup = m_billboardDrawableDef->GetMaterial()->GetRenderMaterialGroup();
         auto entityWorldTransform = GetEntity()->GetTransform().GetWorldTransform();
@@ -197,15 +266,18 @@ namespace ChilliSource
         //billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
         auto inverseView = renderSnapshot.GetRenderCamera().GetOrientation();
 
+        auto worldPositions = CalcActiveWorldPositions(particleData, entityWorldTransform, *frameAllocator);
+        u32 activeIndex = 0;
+
         for (u32 i = 0; i < particleData.size(); ++i)
         {
             const auto& particle = particleData[i];
 
-            if (particle.m_isActive == true && particle.m_colour != Colour::k_transparent)
+            if (particle.m_colour != Colour::k_transparent)
             {
-                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
+                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_id]);
                 
-                auto worldPosition = particle.m_position * entityWorldTransform;
+                const auto& worldPosition = worldPositions[activeIndex++];
                 auto worldScale = Vector3(particle.m_scale * particleScaleFactor, 1.0f);
                 auto worldOrientation = Quaternion(Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView; //rotate locally in the XY plane before rotating to face the camera.
                 auto worldMatrix = Matrix4::CreateTransform(worldPosition, worldScale, worldOrientation);
@@ -221,7 +293,7 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void StaticBillboardParticleDrawable::DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const
+    void StaticBillboardParticleDrawable::DrawWorldSpace(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const
     {
         auto renderMaterialGroup = m_billboardDrawableDef->GetMaterial()->GetRenderMaterialGroup();
 
@@ -232,9 +304,9 @@ namespace ChilliSource
         {
             const auto& particle = particleData[i];
 
-            if (particle.m_isActive == true && particle.m_colour != Colour::k_transparent)
+            if (particle.m_colour != Colour::k_transparent)
             {
-                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
+                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_id]);
                 
                 auto worldPosition = particle.m_position;
                 auto worldScale = Vector3(particle.m_scale, 1.0f);
@@ -250,4 +322,131 @@ namespace ChilliSource
             }
         }
     }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void StaticBillboardParticleDrawable::DrawBatched(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator)
+    {
+        const auto& material = m_billboardDrawableDef->GetMaterial();
+        auto renderMaterialGroup = material->GetRenderMaterialGroup();
+        bool isLocalSpace = (GetDrawableDef()->GetParticleEffect()->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_local);
+        bool isSorted = material->IsTransparencyEnabled();
+
+        //local space particles are transformed by the entity, using a uniform scale for the same reasons as in DrawLocalSpace().
+        UniquePtr<Vector3[]> worldPositions;
+        f32 particleScaleFactor = 1.0f;
+        if (isLocalSpace == true)
+        {
+            worldPositions = CalcActiveWorldPositions(particleData, GetEntity()->GetTransform().GetWorldTransform(), *frameAllocator);
+
+            auto entityScale = GetEntity()->GetTransform().GetWorldScale();
+            particleScaleFactor = (entityScale.x + entityScale.y + entityScale.z) / 3.0f;
+        }
+
+        //billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
+        auto inverseView = renderSnapshot.GetRenderCamera().GetOrientation();
+        auto cameraPosition = renderSnapshot.GetRenderCamera().GetWorldMatrix().GetTranslation();
+
+        m_batchedParticles.clear();
+        u32 activeIndex = 0;
+        for (u32 i = 0; i < particleData.size(); ++i)
+        {
+            const auto& particle = particleData[i];
+
+            if (particle.m_colour != Colour::k_transparent)
+            {
+                BatchedParticle batchedParticle;
+                batchedParticle.m_index = i;
+                batchedParticle.m_worldPosition = (isLocalSpace == true) ? worldPositions[activeIndex] : particle.m_position;
+                batchedParticle.m_sortKey = (isSorted == true) ? (batchedParticle.m_worldPosition - cameraPosition).LengthSquared() : 0.0f;
+                m_batchedParticles.push_back(batchedParticle);
+                ++activeIndex;
+            }
+        }
+
+        //The renderer only sorts whole render objects, so transparent billboards within the mesh must be written back to front.
+        if (isSorted == true)
+        {
+            std::sort(m_batchedParticles.begin(), m_batchedParticles.end(), [](const BatchedParticle& a, const BatchedParticle& b)
+            {
+                return a.m_sortKey > b.m_sortKey;
+            });
+        }
+
+        for (u32 batchStart = 0; batchStart < m_batchedParticles.size(); batchStart += k_maxBillboardsPerBatch)
+        {
+            u32 numBillboards = std::min(u32(m_batchedParticles.size()) - batchStart, k_maxBillboardsPerBatch);
+            u32 vertexDataSize = numBillboards * k_vertexDataSizePerBillboard;
+            u32 indexDataSize = numBillboards * k_indexDataSizePerBillboard;
+
+            auto vertexData = MakeUniqueArray<u8>(*frameAllocator, vertexDataSize);
+            auto indexData = MakeUniqueArray<u8>(*frameAllocator, indexDataSize);
+            auto vertices = reinterpret_cast<SpriteVertex*>(vertexData.get());
+            auto indices = reinterpret_cast<u16*>(indexData.get());
+
+            Vector3 minBounds(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+            Vector3 maxBounds = -minBounds;
+
+            for (u32 i = 0; i < numBillboards; ++i)
+            {
+                const auto& batchedParticle = m_batchedParticles[batchStart + i];
+                const auto& particle = particleData[batchedParticle.m_index];
+                const auto& billboardData = m_billboards->at(m_particleBillboardIndices[particle.m_id]);
+
+                auto worldScale = Vector3(particle.m_scale * particleScaleFactor, 1.0f);
+                auto worldOrientation = Quaternion(Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView; //rotate locally in the XY plane before rotating to face the camera.
+                auto worldMatrix = Matrix4::CreateTransform(batchedParticle.m_worldPosition, worldScale, worldOrientation);
+
+                //The rows of the world matrix are the scaled billboard axes, so the corners can be calculated without a full transform.
+                auto right = worldMatrix.GetRight();
+                auto up = worldMatrix.GetUp();
+                auto centre = batchedParticle.m_worldPosition + billboardData.m_localCentre.x * right + billboardData.m_localCentre.y * up;
+                auto halfRight = (0.5f * billboardData.m_localSize.x) * right;
+                auto halfUp = (0.5f * billboardData.m_localSize.y) * up;
+
+                auto billboardVertices = vertices + i * k_verticesPerBillboard;
+                billboardVertices[0].m_position = Vector4(centre - halfRight + halfUp, 1.0f);
+                billboardVertices[1].m_position = Vector4(centre - halfRight - halfUp, 1.0f);
+                billboardVertices[2].m_position = Vector4(centre + halfRight + halfUp, 1.0f);
+                billboardVertices[3].m_position = Vector4(centre + halfRight - halfUp, 1.0f);
+
+                const auto& uvs = billboardData.m_uvs;
+                billboardVertices[0].m_texCoord = Vector2(uvs.m_u, uvs.m_v);
+                billboardVertices[1].m_texCoord = Vector2(uvs.m_u, uvs.m_v + uvs.m_t);
+                billboardVertices[2].m_texCoord = Vector2(uvs.m_u + uvs.m_s, uvs.m_v);
+                billboardVertices[3].m_texCoord = Vector2(uvs.m_u + uvs.m_s, uvs.m_v + uvs.m_t);
+
+                auto byteColour = ColourUtils::ColourToByteColour(particle.m_colour);
+                for (u32 j = 0; j < k_verticesPerBillboard; ++j)
+                {
+                    billboardVertices[j].m_colour = byteColour;
+
+                    Vector3 position = billboardVertices[j].m_position.XYZ();
+                    minBounds = Vector3::Min(minBounds, position);
+                    maxBounds = Vector3::Max(maxBounds, position);
+                }
+
+                auto billboardIndices = indices + i * k_indicesPerBillboard;
+                for (u32 j = 0; j < k_indicesPerBillboard; ++j)
+                {
+                    billboardIndices[j] = u16(i * k_verticesPerBillboard + k_billboardIndices[j]);
+                }
+            }
+
+            //The vertices are made relative to the centre of the batch so that the world matrix places the batch at its centre, which is
+            //the position the renderer uses when sorting transparent objects.
+            Sphere worldBoundingSphere(0.5f * (minBounds + maxBounds), 0.5f * (maxBounds - minBounds).Length());
+            Vector4 batchCentre(worldBoundingSphere.vOrigin, 0.0f);
+            for (u32 i = 0; i < numBillboards * k_verticesPerBillboard; ++i)
+            {
+                vertices[i].m_position -= batchCentre;
+            }
+
+            Sphere localBoundingSphere(Vector3::k_zero, worldBoundingSphere.fRadius);
+            auto renderDynamicMesh = MakeUnique<RenderDynamicMesh>(*frameAllocator, PolygonType::k_triangle, VertexFormat::k_sprite, IndexFormat::k_short, numBillboards * k_verticesPerBillboard,
+                numBillboards * k_indicesPerBillboard, localBoundingSphere, std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize);
+
+            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderDynamicMesh.get(), Matrix4::CreateTranslation(worldBoundingSphere.vOrigin), worldBoundingSphere, false, RenderLayer::k_standard));
+            renderSnapshot.AddRenderDynamicMesh(std::move(renderDynamicMesh));
+        }
+    }
 }
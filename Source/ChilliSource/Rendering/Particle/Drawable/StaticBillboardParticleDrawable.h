@@ -32,9 +32,12 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <vector>
+
 namespace ChilliSource
 {
     //-----------------------------------------------------------------------
@@ -59,6 +62,16 @@ namespace ChilliSource
             Vector2 m_localSize;
         };
         //----------------------------------------------------------------
+        /// A container for information on a single particle which will
+        /// be written to a batched mesh.
+        //----------------------------------------------------------------
+        struct BatchedParticle
+        {
+            u32 m_index;
+            f32 m_sortKey;
+            Vector3 m_worldPosition;
+        };
+        //----------------------------------------------------------------
         /// Constructor.
         ///
         /// @author Ian Copland
@@ -69,14 +82,13 @@ namespace ChilliSource
         //----------------------------------------------------------------
         StaticBillboardParticleDrawable(const Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData);
         //----------------------------------------------------------------
-        /// Activates the particle with the given index.
+        /// Activates the particle with the given id.
         ///
         /// @author Ian Copland
         ///
-        /// @param The particle draw data.
-        /// @param The index of the particle to activate.
+        /// @param The id of the particle to activate.
         //----------------------------------------------------------------
-        void ActivateParticle(const dynamic_array<ConcurrentParticleData::Particle>& in_particleData, u32 in_index) override;
+        void ActivateParticle(u32 in_id) override;
         //----------------------------------------------------------------
         /// Renders all active particles in the effect.
         ///
@@ -88,7 +100,7 @@ namespace ChilliSource
         /// @param frameAllocator - Allocate memory for this render frame
         /// from here
         //----------------------------------------------------------------
-        void DrawParticles(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) override;
+        void DrawParticles(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) override;
         //----------------------------------------------------------------
         /// Builds the billboard image data from the provided texture
         /// or texture atlas.
@@ -116,7 +128,7 @@ namespace ChilliSource
         /// @param frameAllocator - Allocate memory for this render frame
         /// from here
         //----------------------------------------------------------------
-        void DrawLocalSpace(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const;
+        void DrawLocalSpace(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const;
         //----------------------------------------------------------------
         /// Draws the particles without taking into account the world
         /// space transform of the owning entity as the particles are
@@ -130,12 +142,28 @@ namespace ChilliSource
         /// @param frameAllocator - Allocate memory for this render frame
         /// from here
         //----------------------------------------------------------------
-        void DrawWorldSpace(const dynamic_array<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const;
+        void DrawWorldSpace(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) const;
+        //----------------------------------------------------------------
+        /// Writes the billboards for all active particles into a single
+        /// frame allocated mesh in world space, which is then submitted
+        /// as one render object. If the material is transparent the
+        /// billboards are sorted back to front within the mesh. Large
+        /// effects are split across multiple meshes if they exceed the
+        /// maximum size of a dynamic mesh.
+        ///
+        /// @param particleData - The particle draw data.
+        /// @param renderSnapshot - The render snapshot that particles
+        /// will be added to.
+        /// @param frameAllocator - Allocate memory for this render frame
+        /// from here
+        //----------------------------------------------------------------
+        void DrawBatched(const std::vector<ConcurrentParticleData::Particle>& particleData, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator);
 
         const StaticBillboardParticleDrawableDef* m_billboardDrawableDef;
         std::unique_ptr <dynamic_array<BillboardData>> m_billboards;
         dynamic_array<u32> m_particleBillboardIndices;
         u32 m_nextBillboardIndex = 0;
+        std::vector<BatchedParticle> m_batchedParticles;
     };
 }
 
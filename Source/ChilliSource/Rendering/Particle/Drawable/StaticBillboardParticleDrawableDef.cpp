@@ -69,6 +69,32 @@ namespace ChilliSource
             return StaticBillboardParticleDrawableDef::ImageSelectionType::k_random;
         }
         //-----------------------------------------------------------------
+        /// Parse a draw mode from the given string. This is case
+        /// insensitive. If the string is not a valid draw mode this will
+        /// error.
+        ///
+        /// @param The string to parse.
+        ///
+        /// @return the parsed draw mode.
+        //-----------------------------------------------------------------
+        StaticBillboardParticleDrawableDef::DrawMode ParseDrawMode(const std::string& in_drawModeString)
+        {
+            std::string drawModeString = in_drawModeString;
+            StringUtils::ToLowerCase(drawModeString);
+
+            if (drawModeString == "individual")
+            {
+                return StaticBillboardParticleDrawableDef::DrawMode::k_individual;
+            }
+            else if (drawModeString == "batched")
+            {
+                return StaticBillboardParticleDrawableDef::DrawMode::k_batched;
+            }
+
+            CS_LOG_FATAL("Invalid draw mode: " + in_drawModeString);
+            return StaticBillboardParticleDrawableDef::DrawMode::k_individual;
+        }
+        //-----------------------------------------------------------------
         /// Parse a list of space separated strings.
         ///
         /// @author Ian Copland
@@ -86,15 +112,15 @@ namespace ChilliSource
     CS_DEFINE_NAMEDTYPE(StaticBillboardParticleDrawableDef);
     //--------------------------------------------------
     //--------------------------------------------------
-    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy)
-        : m_material(in_material), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy)
+    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy, DrawMode in_drawMode)
+        : m_material(in_material), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy), m_drawMode(in_drawMode)
     {
         CS_ASSERT(m_material != nullptr, "Cannot create a Billboard Particle Drawable Def with a null material.");
     }
     //--------------------------------------------------
     //--------------------------------------------------
-    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy)
-        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy)
+    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy, DrawMode in_drawMode)
+        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy), m_drawMode(in_drawMode)
     {
         CS_ASSERT(m_material != nullptr, "Cannot create a Billboard Particle Drawable Def with a null material.");
         CS_ASSERT(m_textureAtlas != nullptr, "Cannot create a Billboard Particle Drawable Def with a null texture atlas.");
@@ -103,8 +129,8 @@ namespace ChilliSource
     }
     //--------------------------------------------------
     //--------------------------------------------------
-    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy)
-        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_atlasIds(in_atlasIds), m_imageSelectionType(in_imageSelectionType), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy)
+    StaticBillboardParticleDrawableDef::StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy, DrawMode in_drawMode)
+        : m_material(in_material), m_textureAtlas(in_textureAtlas), m_atlasIds(in_atlasIds), m_imageSelectionType(in_imageSelectionType), m_particleSize(in_particleSize), m_sizePolicy(in_sizePolicy), m_drawMode(in_drawMode)
     {
         CS_ASSERT(m_material != nullptr, "Cannot create a Billboard Particle Drawable Def with a null material.");
         CS_ASSERT(m_textureAtlas != nullptr, "Cannot create a Billboard Particle Drawable Def with a null texture atlas.");
@@ -137,6 +163,14 @@ namespace ChilliSource
             m_sizePolicy = ParseSizePolicy(jsonValue.asString());
         }
 
+        //Draw mode
+        jsonValue = in_paramsJson.get("DrawMode", Json::nullValue);
+        if (jsonValue.isNull() == false)
+        {
+            CS_ASSERT(jsonValue.isString(), "draw mode must be a string.");
+            m_drawMode = ParseDrawMode(jsonValue.asString());
+        }
+
         //load the resources.
         if (in_asyncDelegate == nullptr)
         {
@@ -195,6 +229,12 @@ namespace ChilliSource
     {
         return m_sizePolicy;
     }
+    //--------------------------------------------------
+    //--------------------------------------------------
+    StaticBillboardParticleDrawableDef::DrawMode StaticBillboardParticleDrawableDef::GetDrawMode() const
+    {
+        return m_drawMode;
+    }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     void StaticBillboardParticleDrawableDef::LoadResources(const Json::Value& in_paramsJson)
@@ -78,6 +78,9 @@ namespace ChilliSource
     /// “UseHeightMaintainingAspect”, “UsePreferredSize”,
     /// “UseWidthMaintainingAspect”
     ///
+    /// "DrawMode": A string describing how the particles are submitted
+    /// for rendering. Possible values are "Individual" or "Batched".
+    ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
     class StaticBillboardParticleDrawableDef final : public ParticleDrawableDef
@@ -97,6 +100,20 @@ namespace ChilliSource
             k_cycle
         };
         //----------------------------------------------------------------
+        /// An enum describing the different ways the particles can be
+        /// submitted for rendering. Individual will submit each particle
+        /// as a separate render object, while batched will write all
+        /// particles in the effect into a single mesh which is submitted
+        /// as one render object. Batched is considerably cheaper for
+        /// large effects, but the effect is then culled and sorted as a
+        /// whole rather than per particle.
+        //----------------------------------------------------------------
+        enum class DrawMode
+        {
+            k_individual,
+            k_batched
+        };
+        //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable
         /// definition which uses just a material.
         ///
@@ -107,8 +124,9 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param [Optional] The draw mode. Defaults to individual.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const Vector2& in_particleSize, SizePolicy in_sizePolicy, DrawMode in_drawMode = DrawMode::k_individual);
         //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable definition
         /// which uses a texture atlas and multiple atlas Ids.
@@ -123,8 +141,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered 
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param [Optional] The draw mode. Defaults to individual.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::string& in_atlasId, const Vector2& in_particleSize, SizePolicy in_sizePolicy,
+            DrawMode in_drawMode = DrawMode::k_individual);
         //----------------------------------------------------------------
         /// Constructor for creating a billboard particle drawable 
         /// definition which uses a texture atlas and multiple atlas Ids.
@@ -141,8 +161,10 @@ namespace ChilliSource
         /// @param The size policy describing how the particle is rendered
         /// when the rendered image has a different aspect ratio to the 
         /// given size.
+        /// @param [Optional] The draw mode. Defaults to individual.
         //----------------------------------------------------------------
-        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy);
+        StaticBillboardParticleDrawableDef(const MaterialCSPtr& in_material, const TextureAtlasCSPtr& in_textureAtlas, const std::vector<std::string>& in_atlasIds, ImageSelectionType in_imageSelectionType, const Vector2& in_particleSize, SizePolicy in_sizePolicy,
+            DrawMode in_drawMode = DrawMode::k_individual);
         //----------------------------------------------------------------
         /// Constructor. Loads the params for the drawable def from the 
         /// given json params. If the async delegate is not null, then
@@ -221,6 +243,11 @@ namespace ChilliSource
         /// ratio.
         //----------------------------------------------------------------
         SizePolicy GetSizePolicy() const;
+        //----------------------------------------------------------------
+        /// @return The method that will be used to submit the particles
+        /// for rendering.
+        //----------------------------------------------------------------
+        DrawMode GetDrawMode() const;
     private:
         //----------------------------------------------------------------
         /// Loads the billboard resources on the main thread.
@@ -247,6 +274,7 @@ namespace ChilliSource
         ImageSelectionType m_imageSelectionType = ImageSelectionType::k_cycle;
         Vector2 m_particleSize = Vector2::k_one;
         SizePolicy m_sizePolicy = SizePolicy::k_none;
+        DrawMode m_drawMode = DrawMode::k_individual;
     };
 }
 
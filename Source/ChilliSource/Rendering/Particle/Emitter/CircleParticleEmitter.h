@@ -69,7 +69,7 @@ namespace ChilliSource
         /// @param The particle emitter definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        CircleParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray);
 
         const CircleParticleEmitterDef* m_circleParticleEmitterDef = nullptr;
     };
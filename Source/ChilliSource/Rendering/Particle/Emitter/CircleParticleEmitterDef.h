@@ -146,7 +146,7 @@ namespace ChilliSource
         ///
         /// @return the instance.
         //----------------------------------------------------------------
-        ParticleEmitterUPtr CreateInstance(dynamic_array<Particle>* in_particleArray) const override;
+        ParticleEmitterUPtr CreateInstance(ParticleArray* in_particleArray) const override;
         //----------------------------------------------------------------
         /// @author Ian Copland.
         ///
@@ -60,7 +60,7 @@ namespace ChilliSource
         /// @param The particle emitter definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        ParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray);
         //----------------------------------------------------------------
         /// Tries to emit new particles if required. This will be called 
         /// as part of a background task.
@@ -126,8 +126,8 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::vector<u32> TryEmitBurst(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation);
         //----------------------------------------------------------------
-        /// Emits a new particle if the next particle in the list is free
-        /// to be emitted. 
+        /// Emits a new particle if the particle array is not already
+        /// full.
         ///
         /// @author Ian Copland
         /// 
@@ -146,14 +146,13 @@ namespace ChilliSource
         void Emit(f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles);
 
         const ParticleEmitterDef* m_emitterDef = nullptr;
-        dynamic_array<Particle>* m_particleArray = nullptr;
+        ParticleArray* m_particleArray = nullptr;
 
         Vector3 m_emissionPosition;
         Vector3 m_emissionScale;
         Quaternion m_emissionOrientation;
         f32 m_emissionTime = 0.0f;
         bool m_hasEmitted = false;
-        u32 m_nextParticleIndex = 0;
     };
 }
 
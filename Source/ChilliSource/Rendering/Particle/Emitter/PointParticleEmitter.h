@@ -68,7 +68,7 @@ namespace ChilliSource
         /// @param The particle emitter definition.
         /// @param The particle array.
         //----------------------------------------------------------------
-        PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, dynamic_array<Particle>* in_particleArray);
+        PointParticleEmitter(const ParticleEmitterDef* in_particleEmitter, ParticleArray* in_particleArray);
     };
 }
 
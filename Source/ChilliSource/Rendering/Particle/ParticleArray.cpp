@@ -0,0 +1,269 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_numBuiltInStreams = static_cast<u32>(ParticleArray::Stream::k_total);
+
+        /// The number of floats each stream is padded to a multiple of, so that each stream
+        /// starts on a 16 byte boundary relative to the start of the stream data.
+        ///
+        constexpr u32 k_streamAlignment = 4;
+    }
+
+    //------------------------------------------------------------------------------
+    ParticleArray::ParticleArray(u32 capacity) noexcept
+        : m_capacity(capacity), m_stride(((capacity + k_streamAlignment - 1) / k_streamAlignment) * k_streamAlignment), m_streamData(m_stride * k_numBuiltInStreams, 0.0f), m_ids(capacity)
+    {
+        m_freeIds.reserve(capacity);
+        for (u32 i = 0; i < capacity; ++i)
+        {
+            m_freeIds.push_back(capacity - i - 1);
+        }
+
+        m_keptIndices.reserve(capacity);
+    }
+
+    //------------------------------------------------------------------------------
+    u32 ParticleArray::AddCustomStreams(u32 numStreams) noexcept
+    {
+        u32 firstCustomStreamIndex = m_numCustomStreams;
+
+        m_numCustomStreams += numStreams;
+        m_streamData.resize(m_stride * (k_numBuiltInStreams + m_numCustomStreams), 0.0f);
+
+        return firstCustomStreamIndex;
+    }
+
+    //------------------------------------------------------------------------------
+    f32* ParticleArray::GetStream(Stream stream) noexcept
+    {
+        CS_ASSERT(stream != Stream::k_total, "Invalid stream.");
+
+        return GetStreamData(static_cast<u32>(stream));
+    }
+
+    //------------------------------------------------------------------------------
+    const f32* ParticleArray::GetStream(Stream stream) const noexcept
+    {
+        CS_ASSERT(stream != Stream::k_total, "Invalid stream.");
+
+        return GetStreamData(static_cast<u32>(stream));
+    }
+
+    //------------------------------------------------------------------------------
+    f32* ParticleArray::GetCustomStream(u32 customStreamIndex) noexcept
+    {
+        CS_ASSERT(customStreamIndex < m_numCustomStreams, "Custom stream index out of bounds.");
+
+        return GetStreamData(k_numBuiltInStreams + customStreamIndex);
+    }
+
+    //------------------------------------------------------------------------------
+    const f32* ParticleArray::GetCustomStream(u32 customStreamIndex) const noexcept
+    {
+        CS_ASSERT(customStreamIndex < m_numCustomStreams, "Custom stream index out of bounds.");
+
+        return GetStreamData(k_numBuiltInStreams + customStreamIndex);
+    }
+
+    //------------------------------------------------------------------------------
+    u32 ParticleArray::GetId(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        return m_ids[index];
+    }
+
+    //------------------------------------------------------------------------------
+    u32 ParticleArray::AddParticle() noexcept
+    {
+        CS_ASSERT(IsFull() == false, "Cannot add a particle to a full particle array.");
+
+        u32 index = m_size++;
+
+        m_ids[index] = m_freeIds.back();
+        m_freeIds.pop_back();
+
+        for (u32 i = 0; i < k_numBuiltInStreams; ++i)
+        {
+            GetStreamData(i)[index] = 0.0f;
+        }
+
+        GetStream(Stream::k_scaleX)[index] = 1.0f;
+        GetStream(Stream::k_scaleY)[index] = 1.0f;
+        SetColour(index, Colour::k_white);
+
+        return index;
+    }
+
+    //------------------------------------------------------------------------------
+    void ParticleArray::RemoveExpiredParticles() noexcept
+    {
+        const f32* energies = GetStream(Stream::k_energy);
+
+        u32 firstExpired = 0;
+        while (firstExpired < m_size && energies[firstExpired] > 0.0f)
+        {
+            ++firstExpired;
+        }
+
+        if (firstExpired == m_size)
+        {
+            return;
+        }
+
+        m_keptIndices.clear();
+        for (u32 i = firstExpired; i < m_size; ++i)
+        {
+            if (energies[i] > 0.0f)
+            {
+                m_keptIndices.push_back(i);
+            }
+            else
+            {
+                m_freeIds.push_back(m_ids[i]);
+            }
+        }
+
+        // Compact one stream at a time, rather than one particle at a time, so that each
+        // stream is processed in a single pass over contiguous memory.
+        u32 numStreams = k_numBuiltInStreams + m_numCustomStreams;
+        for (u32 streamIndex = 0; streamIndex < numStreams; ++streamIndex)
+        {
+            f32* stream = GetStreamData(streamIndex);
+            for (u32 i = 0; i < u32(m_keptIndices.size()); ++i)
+            {
+                stream[firstExpired + i] = stream[m_keptIndices[i]];
+            }
+        }
+
+        for (u32 i = 0; i < u32(m_keptIndices.size()); ++i)
+        {
+            m_ids[firstExpired + i] = m_ids[m_keptIndices[i]];
+        }
+
+        m_size = firstExpired + u32(m_keptIndices.size());
+    }
+
+    //------------------------------------------------------------------------------
+    void ParticleArray::Clear() noexcept
+    {
+        for (u32 i = 0; i < m_size; ++i)
+        {
+            m_freeIds.push_back(m_ids[i]);
+        }
+
+        m_size = 0;
+    }
+
+    //------------------------------------------------------------------------------
+    Vector3 ParticleArray::GetPosition(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        return Vector3(GetStream(Stream::k_positionX)[index], GetStream(Stream::k_positionY)[index], GetStream(Stream::k_positionZ)[index]);
+    }
+
+    //------------------------------------------------------------------------------
+    void ParticleArray::SetPosition(u32 index, const Vector3& position) noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        GetStream(Stream::k_positionX)[index] = position.x;
+        GetStream(Stream::k_positionY)[index] = position.y;
+        GetStream(Stream::k_positionZ)[index] = position.z;
+    }
+
+    //------------------------------------------------------------------------------
+    Vector3 ParticleArray::GetVelocity(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        return Vector3(GetStream(Stream::k_velocityX)[index], GetStream(Stream::k_velocityY)[index], GetStream(Stream::k_velocityZ)[index]);
+    }
+
+    //------------------------------------------------------------------------------
+    void ParticleArray::SetVelocity(u32 index, const Vector3& velocity) noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        GetStream(Stream::k_velocityX)[index] = velocity.x;
+        GetStream(Stream::k_velocityY)[index] = velocity.y;
+        GetStream(Stream::k_velocityZ)[index] = velocity.z;
+    }
+
+    //------------------------------------------------------------------------------
+    Vector2 ParticleArray::GetScale(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        return Vector2(GetStream(Stream::k_scaleX)[index], GetStream(Stream::k_scaleY)[index]);
+    }
+
+    //------------------------------------------------------------------------------
+    void ParticleArray::SetScale(u32 index, const Vector2& scale) noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        GetStream(Stream::k_scaleX)[index] = scale.x;
+        GetStream(Stream::k_scaleY)[index] = scale.y;
+    }
+
+    //------------------------------------------------------------------------------
+    Colour ParticleArray::GetColour(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        return Colour(GetStream(Stream::k_colourR)[index], GetStream(Stream::k_colourG)[index], GetStream(Stream::k_colourB)[index], GetStream(Stream::k_colourA)[index]);
+    }
+
+    //------------------------------------------------------------------------------
+    void ParticleArray::SetColour(u32 index, const Colour& colour) noexcept
+    {
+        CS_ASSERT(index < m_size, "Particle index out of bounds.");
+
+        GetStream(Stream::k_colourR)[index] = colour.r;
+        GetStream(Stream::k_colourG)[index] = colour.g;
+        GetStream(Stream::k_colourB)[index] = colour.b;
+        GetStream(Stream::k_colourA)[index] = colour.a;
+    }
+
+    //------------------------------------------------------------------------------
+    f32* ParticleArray::GetStreamData(u32 streamIndex) noexcept
+    {
+        return m_streamData.data() + streamIndex * m_stride;
+    }
+
+    //------------------------------------------------------------------------------
+    const f32* ParticleArray::GetStreamData(u32 streamIndex) const noexcept
+    {
+        return m_streamData.data() + streamIndex * m_stride;
+    }
+}
@@ -0,0 +1,248 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEARRAY_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEARRAY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A structure-of-arrays container for the live particles in a single particle effect.
+    ///
+    /// Each per-particle value is stored in a separate contiguous stream of floats, and the
+    /// live particles are always kept packed at the start of each stream, so updates can be
+    /// written as simple loops over [0, GetSize()) which the compiler is able to vectorise,
+    /// without having to skip inactive particles.
+    ///
+    /// As particles are moved when others are removed, the position of a particle in the
+    /// array is only valid until the next call to RemoveExpiredParticles(). Each particle
+    /// is also assigned an id in the range [0, GetCapacity()) which is stable for its
+    /// lifetime, and can be used to associate external data with a particle.
+    ///
+    /// Particle affectors which need to store their own per-particle data can add custom
+    /// streams, which are kept in step with the built in streams.
+    ///
+    /// This is not thread-safe.
+    ///
+    class ParticleArray final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ParticleArray);
+
+        /// The built in per-particle streams.
+        ///
+        enum class Stream
+        {
+            k_lifetime,
+            k_energy,
+            k_positionX,
+            k_positionY,
+            k_positionZ,
+            k_velocityX,
+            k_velocityY,
+            k_velocityZ,
+            k_scaleX,
+            k_scaleY,
+            k_rotation,
+            k_angularVelocity,
+            k_colourR,
+            k_colourG,
+            k_colourB,
+            k_colourA,
+            k_total
+        };
+
+        /// Creates a new empty particle array.
+        ///
+        /// @param capacity
+        ///     The maximum number of live particles.
+        ///
+        ParticleArray(u32 capacity) noexcept;
+
+        /// @return The maximum number of live particles.
+        ///
+        u32 GetCapacity() const noexcept { return m_capacity; }
+
+        /// @return The number of live particles.
+        ///
+        u32 GetSize() const noexcept { return m_size; }
+
+        /// @return Whether or not the array has no room for more particles.
+        ///
+        bool IsFull() const noexcept { return m_size == m_capacity; }
+
+        /// Adds the given number of custom streams. Any pointers to stream data previously
+        /// returned by the array are invalidated.
+        ///
+        /// @param numStreams
+        ///     The number of streams to add.
+        ///
+        /// @return The index of the first of the new custom streams.
+        ///
+        u32 AddCustomStreams(u32 numStreams) noexcept;
+
+        /// @param stream
+        ///     The built in stream.
+        ///
+        /// @return The data for the given stream. Only the first GetSize() values are valid.
+        ///
+        f32* GetStream(Stream stream) noexcept;
+
+        /// @param stream
+        ///     The built in stream.
+        ///
+        /// @return The data for the given stream. Only the first GetSize() values are valid.
+        ///
+        const f32* GetStream(Stream stream) const noexcept;
+
+        /// @param customStreamIndex
+        ///     The index of the custom stream, as returned by AddCustomStreams().
+        ///
+        /// @return The data for the given custom stream. Only the first GetSize() values
+        ///     are valid.
+        ///
+        f32* GetCustomStream(u32 customStreamIndex) noexcept;
+
+        /// @param customStreamIndex
+        ///     The index of the custom stream, as returned by AddCustomStreams().
+        ///
+        /// @return The data for the given custom stream. Only the first GetSize() values
+        ///     are valid.
+        ///
+        const f32* GetCustomStream(u32 customStreamIndex) const noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        ///
+        /// @return The stable id of the particle.
+        ///
+        u32 GetId(u32 index) const noexcept;
+
+        /// Adds a new particle to the end of the array. The particle has zero lifetime,
+        /// energy, position, velocity, rotation and angular velocity, a scale of one and
+        /// a white colour. Custom streams are not initialised. The array must not be full.
+        ///
+        /// @return The position of the new particle in the array.
+        ///
+        u32 AddParticle() noexcept;
+
+        /// Removes all particles which have no energy remaining, maintaining the order of
+        /// the remaining particles.
+        ///
+        void RemoveExpiredParticles() noexcept;
+
+        /// Removes all particles.
+        ///
+        void Clear() noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        ///
+        /// @return The position of the particle.
+        ///
+        Vector3 GetPosition(u32 index) const noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        /// @param position
+        ///     The new position of the particle.
+        ///
+        void SetPosition(u32 index, const Vector3& position) noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        ///
+        /// @return The velocity of the particle.
+        ///
+        Vector3 GetVelocity(u32 index) const noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        /// @param velocity
+        ///     The new velocity of the particle.
+        ///
+        void SetVelocity(u32 index, const Vector3& velocity) noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        ///
+        /// @return The scale of the particle.
+        ///
+        Vector2 GetScale(u32 index) const noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        /// @param scale
+        ///     The new scale of the particle.
+        ///
+        void SetScale(u32 index, const Vector2& scale) noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        ///
+        /// @return The colour of the particle.
+        ///
+        Colour GetColour(u32 index) const noexcept;
+
+        /// @param index
+        ///     The position of the particle in the array.
+        /// @param colour
+        ///     The new colour of the particle.
+        ///
+        void SetColour(u32 index, const Colour& colour) noexcept;
+
+    private:
+        /// @param streamIndex
+        ///     The index of the stream, where custom streams follow the built in streams.
+        ///
+        /// @return The data for the stream.
+        ///
+        f32* GetStreamData(u32 streamIndex) noexcept;
+
+        /// @param streamIndex
+        ///     The index of the stream, where custom streams follow the built in streams.
+        ///
+        /// @return The data for the stream.
+        ///
+        const f32* GetStreamData(u32 streamIndex) const noexcept;
+
+        u32 m_capacity;
+        u32 m_stride;
+        u32 m_size = 0;
+        u32 m_numCustomStreams = 0;
+        std::vector<f32> m_streamData;
+        std::vector<u32> m_ids;
+        std::vector<u32> m_freeIds;
+        std::vector<u32> m_keptIndices;
+    };
+}
+
+#endif
@@ -29,14 +29,13 @@
 #include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
 
 #include <ChilliSource/Core/Base/Application.h>
-#include <ChilliSource/Core/Container/dynamic_array.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/BatchMath.h>
 #include <ChilliSource/Core/State/State.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
-#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleArray.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
@@ -45,6 +44,8 @@
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <tuple>
 
@@ -52,6 +53,8 @@ namespace ChilliSource
 {
     namespace
     {
+        constexpr u32 k_minParticlesPerBoundsTask = 2048;
+
         //----------------------------------------------------------------
         /// A container for all information required by the background
         /// particle update.
@@ -63,7 +66,7 @@ namespace ChilliSource
             ParticleEffectCSPtr m_particleEffect;
             ParticleEmitterSPtr m_particleEmitter;
             std::vector<ParticleAffectorSPtr> m_particleAffectors;
-            std::shared_ptr<dynamic_array<Particle>> m_particleArray;
+            ParticleArraySPtr m_particleArray;
             ConcurrentParticleDataSPtr m_concurrentParticleData;
             f32 m_playbackTime = 0.0f;
             f32 m_deltaTime = 0.0f; 
@@ -93,46 +96,59 @@ namespace ChilliSource
         }
         //----------------------------------------------------------------
         /// Calculates the bounding shapes for the given set of particles.
+        /// Large particle arrays are processed in parallel.
         ///
         /// @author Ian Copland
         ///
-        /// @param The particle effect.
+        /// @param The task context.
         /// @param The array of particles.
         /// 
         /// @return a pair containing the AABB and the Bounding Sphere.
         //----------------------------------------------------------------
-        std::pair<AABB, Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const dynamic_array<Particle>* in_particleArray)
+        std::pair<AABB, Sphere> CalculateBoundingShapes(const TaskContext& in_taskContext, const ParticleArray* in_particleArray)
         {
-            Vector3 min = Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-            Vector3 max = Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
+            Vector3 min = Vector3::k_zero;
+            Vector3 max = Vector3::k_zero;
 
-            bool anyActive = false;
-            for (const auto& particle : *in_particleArray)
+            const u32 numParticles = in_particleArray->GetSize();
+            if (numParticles > 0)
             {
-                if (particle.m_isActive == true)
+                const ParticleArray::Stream positionStreams[] = { ParticleArray::Stream::k_positionX, ParticleArray::Stream::k_positionY, ParticleArray::Stream::k_positionZ };
+                const f32* positions[] = { in_particleArray->GetStream(positionStreams[0]), in_particleArray->GetStream(positionStreams[1]), in_particleArray->GetStream(positionStreams[2]) };
+
+                using Bounds = std::array<f32, 6>;
+                const f32 k_max = std::numeric_limits<f32>::max();
+                const Bounds emptyBounds = {{ k_max, k_max, k_max, -k_max, -k_max, -k_max }};
+
+                Bounds bounds = in_taskContext.ParallelReduce(numParticles, k_minParticlesPerBoundsTask, emptyBounds, [&positions](const TaskContext&, u32 in_start, u32 in_end, Bounds& inout_bounds)
                 {
-                    anyActive = true;
-
-                    if (particle.m_position.x < min.x)
-                        min.x = particle.m_position.x;
-                    if (particle.m_position.y < min.y)
-                        min.y = particle.m_position.y;
-                    if (particle.m_position.z < min.z)
-                        min.z = particle.m_position.z;
-
-                    if (particle.m_position.x > max.x)
-                        max.x = particle.m_position.x;
-                    if (particle.m_position.y > max.y)
-                        max.y = particle.m_position.y;
-                    if (particle.m_position.z > max.z)
-                        max.z = particle.m_position.z;
-                }
-            }
+                    for (u32 component = 0; component < 3; ++component)
+                    {
+                        const f32* componentPositions = positions[component];
+
+                        f32 componentMin = inout_bounds[component];
+                        f32 componentMax = inout_bounds[component + 3];
+                        for (u32 i = in_start; i < in_end; ++i)
+                        {
+                            componentMin = std::min(componentMin, componentPositions[i]);
+                            componentMax = std::max(componentMax, componentPositions[i]);
+                        }
+
+                        inout_bounds[component] = componentMin;
+                        inout_bounds[component + 3] = componentMax;
+                    }
+                },
+                [](Bounds& inout_bounds, Bounds&& in_chunkBounds)
+                {
+                    for (u32 component = 0; component < 3; ++component)
+                    {
+                        inout_bounds[component] = std::min(inout_bounds[component], in_chunkBounds[component]);
+                        inout_bounds[component + 3] = std::max(inout_bounds[component + 3], in_chunkBounds[component + 3]);
+                    }
+                });
 
-            if (anyActive == false)
-            {
-                min = Vector3::k_zero;
-                max = Vector3::k_zero;
+                min = Vector3(bounds[0], bounds[1], bounds[2]);
+                max = Vector3(bounds[3], bounds[4], bounds[5]);
             }
 
             Vector3 size = max - min;
@@ -148,31 +164,43 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param in_taskContext - The context of the update task.
         /// @param in_desc - The particle update description. This contains
         /// a snapshot of all data required to update the particle effect.
         //----------------------------------------------------------------
-        void ParticleUpdateTask(const ParticleUpdateDesc& in_desc)
+        void ParticleUpdateTask(const TaskContext& in_taskContext, const ParticleUpdateDesc& in_desc)
         {
             CS_ASSERT(in_desc.m_particleEffect != nullptr, "Cannot update particles with null particle effect.");
             CS_ASSERT(in_desc.m_particleArray != nullptr, "Cannot update particles with null particle array.");
             CS_ASSERT(in_desc.m_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
 
-            //update the particles
-            for (auto& particle : *in_desc.m_particleArray)
+            //update the particles, removing any that have run out of energy.
+            ParticleArray* particleArray = in_desc.m_particleArray.get();
+
+            f32* energies = particleArray->GetStream(ParticleArray::Stream::k_energy);
+            for (u32 i = 0; i < particleArray->GetSize(); ++i)
+            {
+                energies[i] -= in_desc.m_deltaTime;
+            }
+
+            particleArray->RemoveExpiredParticles();
+
+            const u32 numParticles = particleArray->GetSize();
+            const std::pair<ParticleArray::Stream, ParticleArray::Stream> integratedStreams[] =
+            {
+                std::make_pair(ParticleArray::Stream::k_positionX, ParticleArray::Stream::k_velocityX),
+                std::make_pair(ParticleArray::Stream::k_positionY, ParticleArray::Stream::k_velocityY),
+                std::make_pair(ParticleArray::Stream::k_positionZ, ParticleArray::Stream::k_velocityZ),
+                std::make_pair(ParticleArray::Stream::k_rotation, ParticleArray::Stream::k_angularVelocity)
+            };
+            for (const auto& integratedStream : integratedStreams)
             {
-                if (particle.m_isActive == true)
+                f32* values = particleArray->GetStream(integratedStream.first);
+                const f32* rates = particleArray->GetStream(integratedStream.second);
+
+                for (u32 i = 0; i < numParticles; ++i)
                 {
-                    particle.m_energy -= in_desc.m_deltaTime;
-                    if (particle.m_energy > 0.0f)
-                    {
-                        particle.m_position += particle.m_velocity * in_desc.m_deltaTime;
-                        particle.m_rotation += particle.m_angularVelocity * in_desc.m_deltaTime;
-                    }
-                    else
-                    {
-                        particle.m_energy = 0.0f;
-                        particle.m_isActive = false;
-                    }
+                    values[i] += rates[i] * in_desc.m_deltaTime;
                 }
             }
 
@@ -201,7 +229,7 @@ namespace ChilliSource
                 }
             }
 
-            auto boundingShapes = CalculateBoundingShapes(in_desc.m_particleEffect.get(), in_desc.m_particleArray.get());
+            auto boundingShapes = CalculateBoundingShapes(in_taskContext, in_desc.m_particleArray.get());
             in_desc.m_concurrentParticleData->CommitParticleData(in_desc.m_particleArray.get(), newIndices, boundingShapes.first, boundingShapes.second);
         }
     }
@@ -325,6 +353,7 @@ namespace ChilliSource
         m_localAABB = AABB();
         m_localBoundingSphere = Sphere();
         m_invalidateBoundingShapeCache = true;
+        OnVolumeChanged();
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
@@ -377,7 +406,7 @@ namespace ChilliSource
         {
             ValidateParticleEffect(m_particleEffect);
 
-            m_particleArray = std::make_shared<dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
+            m_particleArray = std::make_shared<ParticleArray>(m_particleEffect->GetMaxParticles());
             m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles());
 
             m_drawable = m_particleEffect->GetDrawableDef()->CreateInstance(GetEntity(), m_concurrentParticleData.get());
@@ -401,6 +430,7 @@ namespace ChilliSource
             m_localAABB = AABB();
             m_localBoundingSphere = Sphere();
             m_invalidateBoundingShapeCache = true;
+            OnVolumeChanged();
         }
     }
     //-------------------------------------------------------
@@ -422,6 +452,7 @@ namespace ChilliSource
         m_localAABB = m_concurrentParticleData->GetAABB();
         m_localBoundingSphere = m_concurrentParticleData->GetBoundingSphere();
         m_invalidateBoundingShapeCache = true;
+        OnVolumeChanged();
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -447,42 +478,16 @@ namespace ChilliSource
                 mOBBoundingBox.SetTransform(worldMatrix);
 
                 //transform the 8 points of the AABB into world space and recalculate.
-                std::vector<Vector3> points;
-                points.push_back(m_localAABB.BackBottomLeft() * worldMatrix);
-                points.push_back(m_localAABB.BackBottomRight() * worldMatrix);
-                points.push_back(m_localAABB.BackTopLeft() * worldMatrix);
-                points.push_back(m_localAABB.BackTopRight() * worldMatrix);
-                points.push_back(m_localAABB.FrontBottomLeft() * worldMatrix);
-                points.push_back(m_localAABB.FrontBottomRight() * worldMatrix);
-                points.push_back(m_localAABB.FrontTopLeft() * worldMatrix);
-                points.push_back(m_localAABB.FrontTopRight() * worldMatrix);
-
-                Vector3 min = Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-                Vector3 max = Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
-                for (auto& point : points)
-                {
-                    if (point.x < min.x)
-                        min.x = point.x;
-                    if (point.y < min.y)
-                        min.y = point.y;
-                    if (point.z < min.z)
-                        min.z = point.z;
-
-                    if (point.x > max.x)
-                        max.x = point.x;
-                    if (point.y > max.y)
-                        max.y = point.y;
-                    if (point.z > max.z)
-                        max.z = point.z;
-                }
-
-                Vector3 size = max - min;
-                Vector3 centre = min + 0.5f * size;
-
-                mBoundingBox = AABB(centre, size);
+                std::array<Vector3, 8> points =
+                {{
+                    m_localAABB.BackBottomLeft(), m_localAABB.BackBottomRight(), m_localAABB.BackTopLeft(), m_localAABB.BackTopRight(),
+                    m_localAABB.FrontBottomLeft(), m_localAABB.FrontBottomRight(), m_localAABB.FrontTopLeft(), m_localAABB.FrontTopRight()
+                }};
+                BatchMath::TransformPoints(points.data(), u32(points.size()), worldMatrix, points.data());
+                mBoundingBox = BatchMath::CalculateAABB(points.data(), u32(points.size()));
 
                 //bounding sphere encapsulates the AABB.
-                mBoundingSphere = Sphere(centre, size.Length() * 0.5f);
+                mBoundingSphere = Sphere(mBoundingBox.GetOrigin(), mBoundingBox.GetSize().Length() * 0.5f);
             }
 
             m_invalidateBoundingShapeCache = false;
@@ -494,7 +499,7 @@ namespace ChilliSource
     {
         PrepareParticleEffect();
 
-        m_entityTransformConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(MakeDelegate(this, &ParticleEffectComponent::OnEntityTransformChanged));
+        m_entityTransformConnection = GetEntity()->GetTransform().GetTransformInvalidatedEvent().OpenConnection(this, &ParticleEffectComponent::OnEntityTransformChanged);
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
@@ -534,11 +539,8 @@ namespace ChilliSource
     {
         if (m_concurrentParticleData->StartUpdate() == true)
         {
-            //intialise the particles by disabling them all.
-            for (auto& particle : *m_particleArray)
-            {
-                particle.m_isActive = false;
-            }
+            //intialise the particles by removing them all.
+            m_particleArray->Clear();
             m_concurrentParticleData->CommitParticleData(m_particleArray.get(), std::vector<u32>(), AABB(), Sphere());
 
             m_playbackState = PlaybackState::k_playing;
@@ -588,9 +590,9 @@ namespace ChilliSource
             desc.m_entityScale = GetEntity()->GetTransform().GetWorldScale();
             desc.m_entityOrientation = GetEntity()->GetTransform().GetWorldOrientation();
             desc.m_interpolateEmission = (m_firstFrame == false);
-            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_small, [=](const TaskContext&) noexcept
+            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_small, [=](const TaskContext& in_taskContext) noexcept
             {
-                ParticleUpdateTask(desc);
+                ParticleUpdateTask(in_taskContext, desc);
             });
 
             m_firstFrame = false;
@@ -624,9 +626,9 @@ namespace ChilliSource
                 desc.m_entityScale = GetEntity()->GetTransform().GetWorldScale();
                 desc.m_entityOrientation = GetEntity()->GetTransform().GetWorldOrientation();
                 desc.m_interpolateEmission = (m_firstFrame == false);
-                Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_small, [=](const TaskContext&) noexcept
+                Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_small, [=](const TaskContext& in_taskContext) noexcept
                 {
-                    ParticleUpdateTask(desc);
+                    ParticleUpdateTask(in_taskContext, desc);
                 });
 
                 m_firstFrame = false;
@@ -366,6 +366,15 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         //----------------------------------------------------------------
+        /// Particle drawables only modify their own state when drawn, and
+        /// the particle data is locked while it is read, so particle
+        /// effects can be snapshotted on a background thread.
+        ///
+        /// @return Whether or not the render snapshot event can be called
+        /// from a background thread.
+        //----------------------------------------------------------------
+        bool IsRenderSnapshotThreadSafe() const noexcept override { return true; }
+        //----------------------------------------------------------------
         /// Called when the entities transform changes. This invalidates
         /// the bounding shape cache.
         ///
@@ -392,7 +401,7 @@ namespace ChilliSource
         ParticleDrawableUPtr m_drawable;
         ParticleEmitterSPtr m_emitter;
         std::vector<ParticleAffectorSPtr> m_affectors;
-        std::shared_ptr<dynamic_array<Particle>> m_particleArray;
+        ParticleArraySPtr m_particleArray;
         ConcurrentParticleDataSPtr m_concurrentParticleData;
 
         PlaybackType m_playbackType = PlaybackType::k_once;
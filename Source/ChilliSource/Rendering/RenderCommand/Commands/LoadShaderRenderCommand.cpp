@@ -27,8 +27,8 @@
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
-    LoadShaderRenderCommand::LoadShaderRenderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader) noexcept
-        : RenderCommand(Type::k_loadShader), m_renderShader(renderShader), m_vertexShader(vertexShader), m_fragmentShader(fragmentShader)
+    LoadShaderRenderCommand::LoadShaderRenderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept
+        : RenderCommand(Type::k_loadShader), m_renderShader(renderShader), m_vertexShader(vertexShader), m_fragmentShader(fragmentShader), m_instancedVertexShader(instancedVertexShader)
     {
     }
 }
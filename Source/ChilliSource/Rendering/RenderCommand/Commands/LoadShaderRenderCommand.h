@@ -52,6 +52,10 @@ namespace ChilliSource
         ///
         const std::string& GetFragmentShader() const noexcept { return m_fragmentShader; }
         
+        /// @return The instanced variant of the vertex shader, or empty if there isn't one.
+        ///
+        const std::string& GetInstancedVertexShader() const noexcept { return m_instancedVertexShader; }
+        
     private:
         friend class RenderCommandList;
         
@@ -63,12 +67,15 @@ namespace ChilliSource
         ///     The vertex shader string.
         /// @param fragmentShader
         ///     The fragment shader string.
+        /// @param instancedVertexShader
+        ///     The instanced variant of the vertex shader, or empty if there isn't one.
         ///
-        LoadShaderRenderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader) noexcept;
+        LoadShaderRenderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept;
         
         RenderShader* m_renderShader;
         std::string m_vertexShader;
         std::string m_fragmentShader;
+        std::string m_instancedVertexShader;
     };
 }
 
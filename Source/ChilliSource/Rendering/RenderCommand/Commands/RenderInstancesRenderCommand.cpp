@@ -1,11 +1,7 @@
 //
-//  Particle.h
-//  ChilliSource
-//  Created by Ian Copland on 07/10/2014.
-//
 //  The MIT License (MIT)
 //
-//  Copyright (c) 2014 Tag Games Limited
+//  Copyright (c) 2016 Tag Games Limited
 //
 //  Permission is hereby granted, free of charge, to any person obtaining a copy
 //  of this software and associated documentation files (the "Software"), to deal
@@ -26,35 +22,14 @@
 //  THE SOFTWARE.
 //
 
-#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
-#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLE_H_
-
-#include <ChilliSource/ChilliSource.h>
-
-#include <ChilliSource/Core/Math/Vector3.h>
-#include <ChilliSource/Core/Math/Vector2.h>
-#include <ChilliSource/Core/Math/Quaternion.h>
-#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 
 namespace ChilliSource
 {
-    //-----------------------------------------------------------------------
-    /// A struct containing the properties for a single particle.
-    ///
-    /// @author Ian Copland
-    //-----------------------------------------------------------------------
-    struct Particle final
+    //------------------------------------------------------------------------------
+    RenderInstancesRenderCommand::RenderInstancesRenderCommand(UniquePtr<Matrix4[]> worldMatrices, u32 numInstances) noexcept
+        : RenderCommand(Type::k_renderInstances), m_worldMatrices(std::move(worldMatrices)), m_numInstances(numInstances)
     {
-        bool m_isActive = false;
-        f32 m_lifetime = 0.0f;
-        f32 m_energy = 0.0f;
-        Vector3 m_position;
-        Vector2 m_scale = Vector2::k_one;
-        f32 m_rotation = 0.0f;
-        Colour m_colour = Colour::k_white;
-        Vector3 m_velocity;
-        f32 m_angularVelocity = 0.0f;
-    };
+        CS_ASSERT(m_worldMatrices && m_numInstances > 0, "Cannot render zero instances.");
+    }
 }
-
-#endif
@@ -0,0 +1,73 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2016 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_RENDERINSTANCESRENDERCOMMAND_H_
+#define _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_RENDERINSTANCESRENDERCOMMAND_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
+
+namespace ChilliSource
+{
+    /// A render command for rendering a series of instances of the mesh currently described
+    /// by the context state, one for each of the given world transforms. This is used in place
+    /// of a series of RenderInstanceRenderCommands when consecutive objects share the same
+    /// material, mesh and skinned animation. The world matrices are allocated from the frame
+    /// allocator, so the command must be destroyed before the frame allocator is reset.
+    ///
+    /// This must be instantiated via a RenderCommandList.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class RenderInstancesRenderCommand final : public RenderCommand
+    {
+    public:
+        /// @return The world matrices of the instances.
+        ///
+        const Matrix4* GetWorldMatrices() const noexcept { return m_worldMatrices.get(); };
+        
+        /// @return The number of instances.
+        ///
+        u32 GetNumInstances() const noexcept { return m_numInstances; };
+        
+    private:
+        friend class RenderCommandList;
+        
+        /// Creates a new command with the given world matrices.
+        ///
+        /// @param worldMatrices
+        ///     The world matrix of each instance. Must be moved.
+        /// @param numInstances
+        ///     The number of instances.
+        ///
+        RenderInstancesRenderCommand(UniquePtr<Matrix4[]> worldMatrices, u32 numInstances) noexcept;
+        
+        UniquePtr<Matrix4[]> m_worldMatrices;
+        u32 m_numInstances;
+    };
+}
+
+#endif
@@ -68,6 +68,7 @@ namespace ChilliSource
             k_applyMeshBatch,
             k_applySkinnedAnimation,
             k_renderInstance,
+            k_renderInstances,
             k_end,
             k_unloadTargetGroup,
             k_unloadMesh,
@@ -43,6 +43,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadCubemapRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreTextureRenderCommand.h>
@@ -57,269 +58,239 @@
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
-    void RenderCommandList::AddLoadShaderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader) noexcept
+    RenderCommandList::RenderCommandList(IAllocator* frameAllocator) noexcept
+        : m_frameAllocator(frameAllocator)
     {
-        RenderCommandUPtr renderCommand(new LoadShaderRenderCommand(renderShader, vertexShader, fragmentShader));
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList::RenderCommandList(RenderCommandList&& toMove) noexcept
+        : m_orderedCommands(std::move(toMove.m_orderedCommands)), m_renderCommands(std::move(toMove.m_renderCommands)), m_frameAllocator(toMove.m_frameAllocator)
+    {
+        toMove.m_orderedCommands.clear();
+        toMove.m_renderCommands.clear();
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList& RenderCommandList::operator=(RenderCommandList&& toMove) noexcept
+    {
+        if (this != &toMove)
+        {
+            DestroyCommands();
+            
+            m_orderedCommands = std::move(toMove.m_orderedCommands);
+            m_renderCommands = std::move(toMove.m_renderCommands);
+            m_frameAllocator = toMove.m_frameAllocator;
+            
+            toMove.m_orderedCommands.clear();
+            toMove.m_renderCommands.clear();
+        }
         
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        return *this;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddLoadShaderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept
+    {
+        AddCommand<LoadShaderRenderCommand>(renderShader, vertexShader, fragmentShader, instancedVertexShader);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadTextureCommand(RenderTexture* renderTexture, std::unique_ptr<const u8[]> textureData, u32 textureDataSize) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadTextureRenderCommand(renderTexture, std::move(textureData), textureDataSize));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadTextureRenderCommand>(renderTexture, std::move(textureData), textureDataSize);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadCubemapCommand(RenderTexture* renderTexture, std::array<std::unique_ptr<const u8[]>, 6> textureData, u32 textureDataSize) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadCubemapRenderCommand(renderTexture, std::move(textureData), textureDataSize));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadCubemapRenderCommand>(renderTexture, std::move(textureData), textureDataSize);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadMaterialGroupCommand(RenderMaterialGroup* renderMaterialGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadMaterialGroupRenderCommand(renderMaterialGroup));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadMaterialGroupRenderCommand>(renderMaterialGroup);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadMeshCommand(RenderMesh* renderMesh, std::unique_ptr<const u8[]> vertexData, u32 vertexDataSize, std::unique_ptr<const u8[]> indexData, u32 indexDataSize) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadMeshRenderCommand(renderMesh, std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadMeshRenderCommand>(renderMesh, std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreTextureCommand(const RenderTexture* renderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreTextureRenderCommand(renderTexture));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreTextureRenderCommand>(renderTexture);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreCubemapCommand(const RenderTexture* renderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreCubemapRenderCommand(renderTexture));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreCubemapRenderCommand>(renderTexture);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreMeshCommand(const RenderMesh* renderMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreMeshRenderCommand(renderMesh));
-
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreMeshRenderCommand>(renderMesh);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRestoreRenderTargetGroupCommand(const RenderTargetGroup* renderTargetGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new RestoreRenderTargetGroupCommand(renderTargetGroup));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RestoreRenderTargetGroupCommand>(renderTargetGroup);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddLoadTargetGroupCommand(RenderTargetGroup* renderTargetGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new LoadTargetGroupRenderCommand(renderTargetGroup));
-
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<LoadTargetGroupRenderCommand>(renderTargetGroup);
     }
     //------------------------------------------------------------------------------
     void RenderCommandList::AddBeginCommand(const Integer2& resolution, const Colour& clearColour) noexcept
     {
-        RenderCommandUPtr renderCommand(new BeginRenderCommand(resolution, clearColour));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<BeginRenderCommand>(resolution, clearColour);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddBeginWithTargetGroupCommand(const RenderTargetGroup* renderTargetGroup, const Colour& clearColour) noexcept
     {
-        RenderCommandUPtr renderCommand(new BeginWithTargetGroupRenderCommand(renderTargetGroup, clearColour));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<BeginWithTargetGroupRenderCommand>(renderTargetGroup, clearColour);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyCameraCommand(const Vector3& position, const Matrix4& viewMatrix, const Matrix4& viewProjectionMatrix) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyCameraRenderCommand(position, viewMatrix, viewProjectionMatrix));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyCameraRenderCommand>(position, viewMatrix, viewProjectionMatrix);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyAmbientLightCommand(const Colour& colour) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyAmbientLightRenderCommand(colour));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyAmbientLightRenderCommand>(colour);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyDirectionalLightCommand(const Colour& colour, const Vector3& direction, const Matrix4& lightViewProjection, f32 shadowTolerance, const RenderTexture* shadowMapRenderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyDirectionalLightRenderCommand(colour, direction, lightViewProjection, shadowTolerance, shadowMapRenderTexture));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyDirectionalLightRenderCommand>(colour, direction, lightViewProjection, shadowTolerance, shadowMapRenderTexture);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyPointLightCommand(const Colour& colour, const Vector3& position, const Vector3& attenuation) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyPointLightRenderCommand(colour, position, attenuation));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyPointLightRenderCommand>(colour, position, attenuation);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMaterialCommand(const RenderMaterial* renderMaterial) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyMaterialRenderCommand(renderMaterial));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyMaterialRenderCommand>(renderMaterial);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMeshCommand(const RenderMesh* renderMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyMeshRenderCommand(renderMesh));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyMeshRenderCommand>(renderMesh);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyDynamicMeshCommand(const RenderDynamicMesh* renderDynamicMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyDynamicMeshRenderCommand(renderDynamicMesh));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyDynamicMeshRenderCommand>(renderDynamicMesh);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMeshBatchCommand(RenderMeshBatchUPtr renderMeshBatch) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplyMeshBatchRenderCommand(std::move(renderMeshBatch)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplyMeshBatchRenderCommand>(std::move(renderMeshBatch));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplySkinnedAnimationCommand(const RenderSkinnedAnimation* renderSkinnedAnimation) noexcept
     {
-        RenderCommandUPtr renderCommand(new ApplySkinnedAnimationRenderCommand(renderSkinnedAnimation));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<ApplySkinnedAnimationRenderCommand>(renderSkinnedAnimation);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddRenderInstanceCommand(const Matrix4& worldMatrix) noexcept
     {
-        RenderCommandUPtr renderCommand(new RenderInstanceRenderCommand(worldMatrix));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<RenderInstanceRenderCommand>(worldMatrix);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddRenderInstancesCommand(UniquePtr<Matrix4[]> worldMatrices, u32 numInstances) noexcept
+    {
+        AddCommand<RenderInstancesRenderCommand>(std::move(worldMatrices), numInstances);
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddEndCommand() noexcept
     {
-        RenderCommandUPtr renderCommand(new EndRenderCommand());
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<EndRenderCommand>();
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadTargetGroupCommand(UniquePtr<RenderTargetGroup> renderTargetGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadTargetGroupRenderCommand(std::move(renderTargetGroup)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadTargetGroupRenderCommand>(std::move(renderTargetGroup));
     }
 
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadMeshCommand(UniquePtr<RenderMesh> renderMesh) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadMeshRenderCommand(std::move(renderMesh)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadMeshRenderCommand>(std::move(renderMesh));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadMaterialGroupCommand(UniquePtr<RenderMaterialGroup> renderMaterialGroup) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadMaterialGroupRenderCommand(std::move(renderMaterialGroup)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadMaterialGroupRenderCommand>(std::move(renderMaterialGroup));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadTextureCommand(UniquePtr<RenderTexture> renderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadTextureRenderCommand(std::move(renderTexture)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadTextureRenderCommand>(std::move(renderTexture));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadCubemapCommand(UniquePtr<RenderTexture> renderTexture) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadCubemapRenderCommand(std::move(renderTexture)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadCubemapRenderCommand>(std::move(renderTexture));
     }
     
     //------------------------------------------------------------------------------
     void RenderCommandList::AddUnloadShaderCommand(UniquePtr<RenderShader> renderShader) noexcept
     {
-        RenderCommandUPtr renderCommand(new UnloadShaderRenderCommand(std::move(renderShader)));
-        
-        m_orderedCommands.push_back(renderCommand.get());
-        m_renderCommands.push_back(std::move(renderCommand));
+        AddCommand<UnloadShaderRenderCommand>(std::move(renderShader));
     }
     //------------------------------------------------------------------------------
     RenderCommand* RenderCommandList::GetCommand(u32 index) noexcept
     {
         CS_ASSERT(index < GetNumCommands(), "Index out of bounds.");
         
-        return m_renderCommands[index].get();
+        return m_renderCommands[index].first;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandList::DestroyCommands() noexcept
+    {
+        for (const auto& renderCommand : m_renderCommands)
+        {
+            renderCommand.first->~RenderCommand();
+            m_frameAllocator->Deallocate(renderCommand.first, renderCommand.second);
+        }
+        
+        m_orderedCommands.clear();
+        m_renderCommands.clear();
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandList::~RenderCommandList() noexcept
+    {
+        DestroyCommands();
     }
 }
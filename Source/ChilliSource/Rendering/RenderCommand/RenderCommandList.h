@@ -26,16 +26,21 @@
 #define _CHILLISOURCE_RENDERING_RENDERCOMMAND_RENDERCOMMANDLIST_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Memory/IAllocator.h>
 #include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
 
 #include <array>
+#include <new>
+#include <utility>
 #include <vector>
 
 namespace ChilliSource
 {
     /// Provides the ability to create an ordered list of render commands. Commands are
     /// created contiguously in memory to improve cache locality and reduce fragmentation.
+    /// They are allocated from the frame allocator rather than individually from the free
+    /// store, so the list must be destroyed before the frame allocator is reset.
     ///
     /// This is not thread-safe and therefore should only be accessed from one thread
     /// at a time.
@@ -45,9 +50,14 @@ namespace ChilliSource
     public:
         CS_DECLARE_NOCOPY(RenderCommandList);
         
-        RenderCommandList() = default;
-        RenderCommandList(RenderCommandList&&) = default;
-        RenderCommandList& operator=(RenderCommandList&&) = default;
+        /// @param frameAllocator
+        ///     The allocator that commands are allocated from. May be null if no commands will
+        ///     ever be added to the list.
+        ///
+        RenderCommandList(IAllocator* frameAllocator) noexcept;
+        
+        RenderCommandList(RenderCommandList&& toMove) noexcept;
+        RenderCommandList& operator=(RenderCommandList&& toMove) noexcept;
         
         /// Creates and adds a new load shader command to the render command list.
         ///
@@ -57,8 +67,10 @@ namespace ChilliSource
         ///     The vertex shader string.
         /// @param fragmentShader
         ///     The fragment shader string
+        /// @param instancedVertexShader
+        ///     The instanced variant of the vertex shader, or empty if there isn't one.
         ///
-        void AddLoadShaderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader) noexcept;
+        void AddLoadShaderCommand(RenderShader* renderShader, const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept;
         
         /// Creates and adds a new load texture command to the render command list.
         ///
@@ -247,6 +259,17 @@ namespace ChilliSource
         ///
         void AddRenderInstanceCommand(const Matrix4& worldMatrix) noexcept;
         
+        /// Creates and adds a new render instances command to the render command list. This
+        /// renders the currently applied mesh once for each of the given world matrices.
+        ///
+        /// @param worldMatrices
+        ///     The world matrix of each instance, allocated from the frame allocator. Must be
+        ///     moved.
+        /// @param numInstances
+        ///     The number of instances.
+        ///
+        void AddRenderInstancesCommand(UniquePtr<Matrix4[]> worldMatrices, u32 numInstances) noexcept;
+        
         /// Creates and adds a new end command to the render command list.
         ///
         void AddEndCommand() noexcept;
@@ -305,10 +328,39 @@ namespace ChilliSource
         ///
         RenderCommand* GetCommand(u32 index) noexcept;
         
+        ~RenderCommandList() noexcept;
+        
     private:
+        /// Constructs a new command of the given type in memory allocated from the frame allocator
+        /// and appends it to the list.
+        ///
+        /// @param constructorArgs
+        ///     The arguments for the constructor of the command.
+        ///
+        template <typename TRenderCommand, typename... TConstructorArgs> void AddCommand(TConstructorArgs&&... constructorArgs) noexcept;
+        
+        /// Destroys all commands in the list and returns their memory to the frame allocator.
+        ///
+        void DestroyCommands() noexcept;
+        
         std::vector<const RenderCommand*> m_orderedCommands;
-        std::vector<RenderCommandUPtr> m_renderCommands; //TODO: This should be changed to a series of pools of individial render command types.
+        std::vector<std::pair<RenderCommand*, std::size_t>> m_renderCommands;
+        IAllocator* m_frameAllocator;
     };
+    
+    //------------------------------------------------------------------------------
+    template <typename TRenderCommand, typename... TConstructorArgs> void RenderCommandList::AddCommand(TConstructorArgs&&... constructorArgs) noexcept
+    {
+        static_assert(std::is_base_of<RenderCommand, TRenderCommand>::value, "Type must be a render command.");
+        static_assert(alignof(TRenderCommand) <= sizeof(std::intptr_t), "Render command alignment is greater than the frame allocator supports.");
+        CS_ASSERT(m_frameAllocator, "Cannot add commands to a render command list without an allocator.");
+        
+        void* memory = m_frameAllocator->Allocate(sizeof(TRenderCommand));
+        TRenderCommand* renderCommand = new (memory) TRenderCommand(std::forward<TConstructorArgs>(constructorArgs)...);
+        
+        m_orderedCommands.push_back(renderCommand);
+        m_renderCommands.push_back(std::make_pair(renderCommand, sizeof(TRenderCommand)));
+    }
 }
 
 #endif
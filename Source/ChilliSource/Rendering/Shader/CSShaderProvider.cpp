@@ -29,6 +29,8 @@
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Shader/Shader.h>
 
+#include <cctype>
+
 namespace ChilliSource
 {
     namespace
@@ -37,6 +39,28 @@ namespace ChilliSource
         const std::string k_languageTag("GLSL");
         const std::string k_vsTag("VertexShader");
         const std::string k_fsTag("FragmentShader");
+        const std::string k_instancedVsTag("InstancedVertexShader");
+        
+        /// Finds the first occurrence of the given tag which is not part of a longer name,
+        /// for example so that VertexShader is not matched by InstancedVertexShader.
+        ///
+        /// @param tag
+        ///     The tag
+        /// @param text
+        ///     The string data to search in.
+        ///
+        /// @return The index of the tag, or npos if it couldn't be found.
+        ///
+        std::string::size_type FindTag(const std::string& tag, const std::string& text) noexcept
+        {
+            auto tagIdx = text.find(tag);
+            while (tagIdx != text.npos && tagIdx > 0 && (std::isalnum(static_cast<unsigned char>(text[tagIdx - 1])) || text[tagIdx - 1] == '_'))
+            {
+                tagIdx = text.find(tag, tagIdx + 1);
+            }
+            
+            return tagIdx;
+        }
         
         /// Grabs the contents of a chunk identified by the given tag
         ///
@@ -57,7 +81,7 @@ namespace ChilliSource
         std::string GetChunk(const std::string& chunkTag, const std::string& text) noexcept
         {
             //Find the chunk key
-            auto tagStartIdx = text.find(chunkTag);
+            auto tagStartIdx = FindTag(chunkTag, text);
             CS_ASSERT(tagStartIdx != text.npos, "Missing '" + chunkTag + "' tag from shader.");
             
             //Find the open brace
@@ -176,9 +200,16 @@ namespace ChilliSource
                 return;
             }
             
+            // The instanced vertex shader is optional.
+            std::string instancedVsChunk;
+            if (FindTag(k_instancedVsTag, languageChunk) != languageChunk.npos)
+            {
+                instancedVsChunk = GetChunk(k_instancedVsTag, languageChunk);
+            }
+            
             if (delegate == nullptr)
             {
-                shader->Build(vsChunk, fsChunk);
+                shader->Build(vsChunk, fsChunk, instancedVsChunk);
                 shader->SetLoadState(Resource::LoadState::k_loaded);
             }
             else
@@ -186,7 +217,7 @@ namespace ChilliSource
                 //All GL related tasks must be performed on the main thread.
                 Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
                 {
-                    shader->Build(vsChunk, fsChunk);
+                    shader->Build(vsChunk, fsChunk, instancedVsChunk);
                     shader->SetLoadState(Resource::LoadState::k_loaded);
                     delegate(shader);
                 });
@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Shader/RenderShaderManager.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Base/TargetType.h>
 
@@ -56,7 +58,21 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    UniquePtr<RenderShader> RenderShaderManager::CreateRenderShader(const std::string& vertexShader, const std::string& fragmentShader) noexcept
+    void RenderShaderManager::OnInit() noexcept
+    {
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        CS_ASSERT(memoryTracker, "MemoryTracker must exist.");
+        memoryTracker->RegisterAllocator("Render Shader Pool", &m_renderShaderPool);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderShaderManager::OnDestroy() noexcept
+    {
+        Application::Get()->GetSystem<MemoryTracker>()->DeregisterAllocator(&m_renderShaderPool);
+    }
+    
+    //------------------------------------------------------------------------------
+    UniquePtr<RenderShader> RenderShaderManager::CreateRenderShader(const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept
     {
         UniquePtr<RenderShader> renderShader(MakeUnique<RenderShader>(m_renderShaderPool));
         auto rawRenderShader = renderShader.get();
@@ -64,6 +80,7 @@ namespace ChilliSource
         PendingLoadCommand loadCommand;
         loadCommand.m_vertexShader = vertexShader;
         loadCommand.m_fragmentShader = fragmentShader;
+        loadCommand.m_instancedVertexShader = instancedVertexShader;
         loadCommand.m_renderShader = rawRenderShader;
         
         std::unique_lock<std::mutex> lock(m_mutex);
@@ -91,7 +108,7 @@ namespace ChilliSource
             
             for (auto& loadCommand : m_pendingLoadCommands)
             {
-                preRenderCommandList->AddLoadShaderCommand(loadCommand.m_renderShader, loadCommand.m_vertexShader, loadCommand.m_fragmentShader);
+                preRenderCommandList->AddLoadShaderCommand(loadCommand.m_renderShader, loadCommand.m_vertexShader, loadCommand.m_fragmentShader, loadCommand.m_instancedVertexShader);
             }
             m_pendingLoadCommands.clear();
             
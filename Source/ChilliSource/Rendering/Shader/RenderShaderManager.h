@@ -27,7 +27,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/System/AppSystem.h>
-#include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentObjectPoolAllocator.h>
 #include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Rendering/Shader/RenderShader.h>
 
@@ -71,10 +71,12 @@ namespace ChilliSource
         ///     The vertex shader string.
         /// @param fragmentShader
         ///     The fragment shader string.
+        /// @param instancedVertexShader
+        ///     The instanced variant of the vertex shader, or empty if there isn't one.
         ///
         /// @return The render shader instance.
         ///
-        UniquePtr<RenderShader> CreateRenderShader(const std::string& vertexShader, const std::string& fragmentShader) noexcept;
+        UniquePtr<RenderShader> CreateRenderShader(const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept;
         
         /// Removes the render shader from the manager and queues an UnloadShaderRenderCommand for
         /// the next Render Snapshot stage in the render pipeline. The render command is given
@@ -90,12 +92,13 @@ namespace ChilliSource
         friend class Application;
         
         /// A container for information relating to pending shader load commands, such as the
-        /// vertex shader, fragment shader and the related RenderShader.
+        /// vertex shader, fragment shader, instanced vertex shader and the related RenderShader.
         ///
         struct PendingLoadCommand final
         {
             std::string m_vertexShader;
             std::string m_fragmentShader;
+            std::string m_instancedVertexShader;
             RenderShader* m_renderShader = nullptr;
         };
         
@@ -108,6 +111,14 @@ namespace ChilliSource
         
         RenderShaderManager();
         
+        /// The init lifecycle event. Registers the render shader pool with the memory tracker.
+        ///
+        void OnInit() noexcept override;
+        
+        /// The destroy lifecycle event. Deregisters the render shader pool from the memory tracker.
+        ///
+        void OnDestroy() noexcept override;
+        
         /// Called during the Render Snapshot stage of the render pipeline. All pending load and
         /// unload commands are added to the render snapshot.
         ///
@@ -121,7 +132,7 @@ namespace ChilliSource
         void OnRenderSnapshot(TargetType targetType, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
         std::mutex m_mutex;
-        ObjectPoolAllocator<RenderShader> m_renderShaderPool;
+        ConcurrentObjectPoolAllocator<RenderShader> m_renderShaderPool;
         std::vector<PendingLoadCommand> m_pendingLoadCommands;
         std::vector<UniquePtr<RenderShader>> m_pendingUnloadCommands;
     };
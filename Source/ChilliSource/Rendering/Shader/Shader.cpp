@@ -44,14 +44,14 @@ namespace ChilliSource
     }
 
     //------------------------------------------------------------------------------
-    void Shader::Build(const std::string& vertexShader, const std::string& fragmentShader) noexcept
+    void Shader::Build(const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader) noexcept
     {
         DestroyRenderShader();
         
         auto renderShaderManager = Application::Get()->GetSystem<RenderShaderManager>();
         CS_ASSERT(renderShaderManager, "RenderShaderManager must exist.");
         
-        m_renderShader = renderShaderManager->CreateRenderShader(vertexShader, fragmentShader);
+        m_renderShader = renderShaderManager->CreateRenderShader(vertexShader, fragmentShader, instancedVertexShader);
     }
 
     //------------------------------------------------------------------------------
@@ -58,8 +58,13 @@ namespace ChilliSource
         ///     The vertex shader string.
         /// @param fragmentShaderData
         ///     The fragment shader string.
+        /// @param instancedVertexShader
+        ///     (Optional) A variant of the vertex shader which reads the world matrix from the
+        ///     per-instance attribute a_instanceWorldMat and the view projection matrix from
+        ///     u_vpMat. This is used with the fragment shader to draw runs of instances in a
+        ///     single call where supported. Defaults to empty, meaning there is no variant.
         ///
-        void Build(const std::string& vertexShader, const std::string& fragmentShader) noexcept;
+        void Build(const std::string& vertexShader, const std::string& fragmentShader, const std::string& instancedVertexShader = "") noexcept;
         
         /// @return The underlying RenderShader used by the render system.
         ///
@@ -30,8 +30,8 @@
 
 #include <ChilliSource/Core/Base/ByteColour.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/BatchMath.h>
 #include <ChilliSource/Rendering/Base/AspectRatioUtils.h>
 #include <ChilliSource/Rendering/Base/RenderObject.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
@@ -43,6 +43,7 @@
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
 #include <algorithm>
+#include <array>
 
 namespace ChilliSource
 {
@@ -195,6 +196,7 @@ namespace ChilliSource
         {
             OnTransformChanged();
             SetTextureSizeCacheValid();
+            OnVolumeChanged();
         }
         
         if(GetEntity() && m_isAABBValid == false)
@@ -205,10 +207,16 @@ namespace ChilliSource
             
             // Realign the origin
             Vector2 anchorPoint = GetAnchorPoint(m_originAlignment, transformedSize * 0.5f);
+            Vector2 halfSize = transformedSize * 0.5f;
             
-            // Rebuild the box
-            mBoundingBox.SetSize(Vector3(transformedSize, 0.0f));
-            mBoundingBox.SetOrigin(GetEntity()->GetTransform().GetWorldPosition() - Vector3(anchorPoint, 0.0f));
+            // Rebuild the box from the world space corners of the sprite
+            std::array<Vector3, 4> corners =
+            {{
+                Vector3(-anchorPoint.x - halfSize.x, -anchorPoint.y - halfSize.y, 0.0f), Vector3(-anchorPoint.x + halfSize.x, -anchorPoint.y - halfSize.y, 0.0f),
+                Vector3(-anchorPoint.x - halfSize.x, -anchorPoint.y + halfSize.y, 0.0f), Vector3(-anchorPoint.x + halfSize.x, -anchorPoint.y + halfSize.y, 0.0f)
+            }};
+            BatchMath::TransformPoints(corners.data(), u32(corners.size()), GetEntity()->GetTransform().GetWorldTransform(), corners.data());
+            mBoundingBox = BatchMath::CalculateAABB(corners.data(), u32(corners.size()));
         }
         return mBoundingBox;
     }
@@ -220,6 +228,7 @@ namespace ChilliSource
         {
             OnTransformChanged();
             SetTextureSizeCacheValid();
+            OnVolumeChanged();
         }
         
         if(GetEntity() && m_isOOBBValid == false)
@@ -246,6 +255,7 @@ namespace ChilliSource
         {
             OnTransformChanged();
             SetTextureSizeCacheValid();
+            OnVolumeChanged();
         }
         
         if(GetEntity() && m_isBSValid == false)
@@ -257,8 +267,12 @@ namespace ChilliSource
             // Realign the origin
             Vector2 anchorPoint = GetAnchorPoint(m_originAlignment, transformedSize * 0.5f);
             
-            mBoundingSphere.vOrigin = GetEntity()->GetTransform().GetWorldPosition() - Vector3(anchorPoint, 0.0f);
-            mBoundingSphere.fRadius = std::sqrt((transformedSize.x * transformedSize.x) + (transformedSize.y * transformedSize.y)) * 0.5f;
+            const auto& transform = GetEntity()->GetTransform();
+            Vector3 worldScale = transform.GetWorldScale();
+            f32 maxScaleComponent = std::max(std::max(std::abs(worldScale.x), std::abs(worldScale.y)), std::abs(worldScale.z));
+            
+            mBoundingSphere.vOrigin = Vector3(-anchorPoint, 0.0f) * transform.GetWorldTransform();
+            mBoundingSphere.fRadius = std::sqrt((transformedSize.x * transformedSize.x) + (transformedSize.y * transformedSize.y)) * 0.5f * maxScaleComponent;
         }
         return mBoundingSphere;
     }
@@ -286,6 +300,7 @@ namespace ChilliSource
         OnTransformChanged();
         
         m_originalSize = in_size;
+        OnVolumeChanged();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -300,6 +315,7 @@ namespace ChilliSource
         OnTransformChanged();
         
         m_sizePolicyDelegate = k_sizeDelegates[(u32)in_sizePolicy];
+        OnVolumeChanged();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -327,6 +343,7 @@ namespace ChilliSource
         OnTransformChanged();
         
         m_textureAtlas = in_atlas;
+        OnVolumeChanged();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -338,6 +355,7 @@ namespace ChilliSource
         
         m_hashedTextureAtlasId = HashCRC32::GenerateHashCode(in_atlasId);
         m_uvs = m_textureAtlas->GetFrameUVs(m_hashedTextureAtlasId);
+        OnVolumeChanged();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -399,8 +417,10 @@ namespace ChilliSource
     //-----------------------------------------------------------
     void SpriteComponent::SetOriginAlignment(AlignmentAnchor in_alignment)
     {
+        OnTransformChanged();
+        
         m_originAlignment = in_alignment;
-        m_vertexPositionsValid = false;
+        OnVolumeChanged();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -449,7 +469,7 @@ namespace ChilliSource
     //----------------------------------------------------
     void SpriteComponent::OnAddedToScene()
     {
-        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(MakeDelegate(this, &SpriteComponent::OnTransformChanged));
+        m_transformChangedConnection = GetEntity()->GetTransform().GetTransformInvalidatedEvent().OpenConnection(this, &SpriteComponent::OnTransformChanged);
         
         OnTransformChanged();
     }
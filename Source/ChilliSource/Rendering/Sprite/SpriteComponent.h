@@ -325,6 +325,14 @@ namespace ChilliSource
         //------------------------------------------------------------
         void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         //------------------------------------------------------------
+        /// Sprites only read their own state when snapshotted, so
+        /// can be snapshotted on a background thread.
+        ///
+        /// @return Whether or not the render snapshot event can be
+        /// called from a background thread.
+        //------------------------------------------------------------
+        bool IsRenderSnapshotThreadSafe() const noexcept override { return true; }
+        //------------------------------------------------------------
         /// Triggered when the component is removed from an entity on
         /// the scene
         ///
@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Target/RenderTargetGroupManager.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Base/TargetType.h>
 
@@ -54,6 +56,20 @@ namespace ChilliSource
     {
         return (RenderTargetGroupManager::InterfaceID == interfaceId);
     }
+    
+    //------------------------------------------------------------------------------
+    void RenderTargetGroupManager::OnInit() noexcept
+    {
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        CS_ASSERT(memoryTracker, "MemoryTracker must exist.");
+        memoryTracker->RegisterAllocator("Render Target Group Pool", &m_renderTargetGroupPool);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderTargetGroupManager::OnDestroy() noexcept
+    {
+        Application::Get()->GetSystem<MemoryTracker>()->DeregisterAllocator(&m_renderTargetGroupPool);
+    }
 
     //------------------------------------------------------------------------------
     UniquePtr<RenderTargetGroup> RenderTargetGroupManager::CreateRenderTargetGroup(const RenderTexture* colourTarget, const RenderTexture* depthTarget) noexcept
@@ -26,7 +26,7 @@
 #define _CHILLISOURCE_RENDERING_TARGET_RENDERTARGETGROUPMANAGER_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentObjectPoolAllocator.h>
 #include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Target/RenderTargetGroup.h>
@@ -125,6 +125,14 @@ namespace ChilliSource
         
         RenderTargetGroupManager();
         
+        /// The init lifecycle event. Registers the render target group pool with the memory tracker.
+        ///
+        void OnInit() noexcept override;
+        
+        /// The destroy lifecycle event. Deregisters the render target group pool from the memory tracker.
+        ///
+        void OnDestroy() noexcept override;
+        
         /// Called during the Render Snapshot stage of the render pipeline. All pending load and
         /// unload commands are added to the render snapshot.
         ///
@@ -138,7 +146,7 @@ namespace ChilliSource
         void OnRenderSnapshot(TargetType targetType, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
         std::mutex m_mutex;
-        ObjectPoolAllocator<RenderTargetGroup> m_renderTargetGroupPool;
+        ConcurrentObjectPoolAllocator<RenderTargetGroup> m_renderTargetGroupPool;
         std::vector<const RenderTargetGroup*> m_renderTargetGroups;
         std::vector<RenderTargetGroup*> m_pendingLoadCommands;
         std::vector<UniquePtr<RenderTargetGroup>> m_pendingUnloadCommands;
@@ -140,6 +140,19 @@ namespace ChilliSource
         return m_renderTexture.get();
     }
     
+    //------------------------------------------------------------------------------
+    std::size_t Cubemap::GetEstimatedMemoryUsage() const noexcept
+    {
+        if (GetLoadState() != LoadState::k_loaded || !m_renderTexture)
+        {
+            return 0;
+        }
+        
+        // The render texture describes a single face.
+        constexpr std::size_t k_numFaces = 6;
+        return m_renderTexture->GetEstimatedMemoryUsage() * k_numFaces;
+    }
+    
     //------------------------------------------------------------------------------
     void Cubemap::DestroyRenderTexture() noexcept
     {
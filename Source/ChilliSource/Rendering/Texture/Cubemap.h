@@ -111,6 +111,11 @@ namespace ChilliSource
         ///
         const RenderTexture* GetRenderTexture() const noexcept;
         
+        /// @return The estimated memory used by the cubemap data in bytes, or zero if it has
+        ///     not been built.
+        ///
+        std::size_t GetEstimatedMemoryUsage() const noexcept override;
+        
         ~Cubemap() noexcept;
         
     private:
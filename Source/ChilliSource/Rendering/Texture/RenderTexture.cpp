@@ -26,10 +26,72 @@
 
 namespace ChilliSource
 {
+    namespace
+    {
+        /// @param imageFormat
+        ///     The image format.
+        /// @param imageCompression
+        ///     The image compression type.
+        ///
+        /// @return The number of bits used to store each pixel in the given format.
+        ///
+        u32 CalcBitsPerPixel(ImageFormat imageFormat, ImageCompression imageCompression) noexcept
+        {
+            switch (imageCompression)
+            {
+                case ImageCompression::k_PVR2Bpp:
+                    return 2;
+                case ImageCompression::k_PVR4Bpp:
+                case ImageCompression::k_ETC1:
+                    return 4;
+                case ImageCompression::k_none:
+                    break;
+            }
+            
+            switch (imageFormat)
+            {
+                case ImageFormat::k_Lum8:
+                    return 8;
+                case ImageFormat::k_RGBA4444:
+                case ImageFormat::k_RGB565:
+                case ImageFormat::k_LumA88:
+                case ImageFormat::k_Depth16:
+                    return 16;
+                case ImageFormat::k_RGB888:
+                    return 24;
+                case ImageFormat::k_RGBA8888:
+                case ImageFormat::k_Depth32:
+                    return 32;
+            }
+            
+            CS_LOG_FATAL("Invalid image format.");
+            return 0;
+        }
+    }
+    
     //------------------------------------------------------------------------------
     RenderTexture::RenderTexture(const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression, TextureFilterMode filterMode, TextureWrapMode wrapModeS,  TextureWrapMode wrapModeT,
                                  bool isMipmapped, bool shouldBackupData) noexcept
         : m_dimensions(dimensions), m_imageFormat(imageFormat), m_imageCompression(imageCompression), m_filterMode(filterMode), m_wrapModeS(wrapModeS), m_wrapModeT(wrapModeT), m_isMipmapped(isMipmapped), m_shouldBackupData(shouldBackupData)
     {
     }
+    
+    //------------------------------------------------------------------------------
+    std::size_t RenderTexture::GetEstimatedMemoryUsage() const noexcept
+    {
+        std::size_t numBytes = std::size_t(m_dimensions.x) * std::size_t(m_dimensions.y) * CalcBitsPerPixel(m_imageFormat, m_imageCompression) / 8;
+        
+        // A full mipmap chain adds a third to the size of the base image.
+        if (m_isMipmapped)
+        {
+            numBytes += numBytes / 3;
+        }
+        
+        if (m_shouldBackupData)
+        {
+            numBytes *= 2;
+        }
+        
+        return numBytes;
+    }
 }
@@ -104,6 +104,13 @@ namespace ChilliSource
         ///
         bool ShouldBackupData() const noexcept { return m_shouldBackupData; }
         
+        /// This is an estimate based on the dimensions and format of the texture, including
+        /// any mipmaps and the main memory backup if there is one.
+        ///
+        /// @return The estimated memory used by the texture data in bytes.
+        ///
+        std::size_t GetEstimatedMemoryUsage() const noexcept;
+        
         /// This is not thread safe and should only be called from the render thread.
         ///
         /// @return A pointer to render system specific additional information.
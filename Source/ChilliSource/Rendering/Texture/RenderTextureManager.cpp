@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Texture/RenderTextureManager.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Memory/MemoryTracker.h>
 #include <ChilliSource/Rendering/Base/RenderSnapshot.h>
 #include <ChilliSource/Rendering/Base/TargetType.h>
 
@@ -54,6 +56,20 @@ namespace ChilliSource
     {
         return (RenderTextureManager::InterfaceID == interfaceId);
     }
+    
+    //------------------------------------------------------------------------------
+    void RenderTextureManager::OnInit() noexcept
+    {
+        auto memoryTracker = Application::Get()->GetSystem<MemoryTracker>();
+        CS_ASSERT(memoryTracker, "MemoryTracker must exist.");
+        memoryTracker->RegisterAllocator("Render Texture Pool", &m_renderTexturePool);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderTextureManager::OnDestroy() noexcept
+    {
+        Application::Get()->GetSystem<MemoryTracker>()->DeregisterAllocator(&m_renderTexturePool);
+    }
         
     //------------------------------------------------------------------------------
     UniquePtr<RenderTexture> RenderTextureManager::CreateTexture2D(std::unique_ptr<const u8[]> textureData, u32 textureDataSize, const Integer2& dimensions, ImageFormat imageFormat, ImageCompression imageCompression,
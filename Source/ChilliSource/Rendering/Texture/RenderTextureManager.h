@@ -26,7 +26,7 @@
 #define _CHILLISOURCE_RENDERING_TEXTURE_RENDERTEXTUREMANAGER_H_
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Memory/ObjectPoolAllocator.h>
+#include <ChilliSource/Core/Memory/ConcurrentObjectPoolAllocator.h>
 #include <ChilliSource/Core/Memory/UniquePtr.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Rendering/Texture/RenderTexture.h>
@@ -175,6 +175,14 @@ namespace ChilliSource
         
         RenderTextureManager();
         
+        /// The init lifecycle event. Registers the render texture pool with the memory tracker.
+        ///
+        void OnInit() noexcept override;
+        
+        /// The destroy lifecycle event. Deregisters the render texture pool from the memory tracker.
+        ///
+        void OnDestroy() noexcept override;
+        
         /// Called during the Render Snapshot stage of the render pipeline. All pending load and
         /// unload commands are added to the render snapshot.
         ///
@@ -188,7 +196,7 @@ namespace ChilliSource
         void OnRenderSnapshot(TargetType targetType, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
         
         std::mutex m_mutex;
-        ObjectPoolAllocator<RenderTexture> m_renderTexturePool;
+        ConcurrentObjectPoolAllocator<RenderTexture> m_renderTexturePool;
         std::vector<PendingLoadCommand2D> m_pendingLoadCommands2D;
         std::vector<PendingLoadCommandCubemap> m_pendingLoadCommandsCubemap;
         std::vector<UniquePtr<RenderTexture>> m_pendingUnloadCommands2D;
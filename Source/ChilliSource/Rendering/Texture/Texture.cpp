@@ -140,6 +140,17 @@ namespace ChilliSource
         return m_renderTexture.get();
     }
     
+    //------------------------------------------------------------------------------
+    std::size_t Texture::GetEstimatedMemoryUsage() const noexcept
+    {
+        if (GetLoadState() != LoadState::k_loaded || !m_renderTexture)
+        {
+            return 0;
+        }
+        
+        return m_renderTexture->GetEstimatedMemoryUsage();
+    }
+    
     //------------------------------------------------------------------------------
     void Texture::DestroyRenderTexture() noexcept
     {
@@ -106,6 +106,11 @@ namespace ChilliSource
         ///
         const RenderTexture* GetRenderTexture() const noexcept;
         
+        /// @return The estimated memory used by the texture data in bytes, or zero if it has
+        ///     not been built.
+        ///
+        std::size_t GetEstimatedMemoryUsage() const noexcept override;
+        
         ~Texture() noexcept;
         
     private:
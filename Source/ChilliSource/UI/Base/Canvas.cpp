@@ -30,7 +30,6 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Screen.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
 #include <ChilliSource/UI/Base/WidgetFactory.h>
@@ -116,14 +115,14 @@ namespace ChilliSource
     //-------------------------------------------------------
     void Canvas::OnResume()
     {
-        m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(MakeDelegate(this, &Canvas::OnScreenResolutionChanged));
+        m_screenResizedConnection = m_screen->GetResolutionChangedEvent().OpenConnection(this, &Canvas::OnScreenResolutionChanged);
         
         auto pointerSystem = Application::Get()->GetSystem<PointerSystem>();
-        m_pointerAddedConnection = pointerSystem->GetPointerAddedEvent().OpenConnection(MakeDelegate(this, &Canvas::OnPointerAdded));
-        m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(MakeDelegate(this, &Canvas::OnPointerDown));
-        m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(MakeDelegate(this, &Canvas::OnPointerMoved));
-        m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(MakeDelegate(this, &Canvas::OnPointerUp));
-        m_pointerRemovedConnection = pointerSystem->GetPointerRemovedEvent().OpenConnection(MakeDelegate(this, &Canvas::OnPointerRemoved));
+        m_pointerAddedConnection = pointerSystem->GetPointerAddedEvent().OpenConnection(this, &Canvas::OnPointerAdded);
+        m_pointerDownConnection = pointerSystem->GetPointerDownEventInternal().OpenConnection(this, &Canvas::OnPointerDown);
+        m_pointerMovedConnection = pointerSystem->GetPointerMovedEvent().OpenConnection(this, &Canvas::OnPointerMoved);
+        m_pointerUpConnection = pointerSystem->GetPointerUpEvent().OpenConnection(this, &Canvas::OnPointerUp);
+        m_pointerRemovedConnection = pointerSystem->GetPointerRemovedEvent().OpenConnection(this, &Canvas::OnPointerRemoved);
         
         m_canvas->OnResume();
     }
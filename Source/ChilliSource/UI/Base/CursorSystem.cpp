@@ -27,7 +27,6 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/AppConfig.h>
 #include <ChilliSource/Core/Resource/ResourcePool.h>
-#include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Input/Pointer/PointerSystem.h>
 #include <ChilliSource/UI/Base/WidgetFactory.h>
@@ -112,9 +111,9 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void CursorSystem::OnResume() noexcept
     {
-        m_pointerAddedConnection = m_pointerSystem->GetPointerAddedEvent().OpenConnection(MakeDelegate(this, &CursorSystem::OnPointerAdded));
-        m_pointerMovedConnection = m_pointerSystem->GetPointerMovedEvent().OpenConnection(MakeDelegate(this, &CursorSystem::OnPointerMoved));
-        m_pointerRemovedConnection = m_pointerSystem->GetPointerRemovedEvent().OpenConnection(MakeDelegate(this, &CursorSystem::OnPointerRemoved));
+        m_pointerAddedConnection = m_pointerSystem->GetPointerAddedEvent().OpenConnection(this, &CursorSystem::OnPointerAdded);
+        m_pointerMovedConnection = m_pointerSystem->GetPointerMovedEvent().OpenConnection(this, &CursorSystem::OnPointerMoved);
+        m_pointerRemovedConnection = m_pointerSystem->GetPointerRemovedEvent().OpenConnection(this, &CursorSystem::OnPointerRemoved);
         
         m_cursor->OnResume();
     }
@@ -179,11 +179,11 @@ namespace ChilliSource
             Highlight();
         }
         
-        m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(MakeDelegate(this, &HighlightUIComponent::OnPressedInside));
-        m_moveEnteredConnection = GetWidget()->GetMoveEnteredEvent().OpenConnection(MakeDelegate(this, &HighlightUIComponent::OnMoveEntered));
-        m_moveExitedConnection = GetWidget()->GetMoveExitedEvent().OpenConnection(MakeDelegate(this, &HighlightUIComponent::OnMoveExited));
-        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(MakeDelegate(this, &HighlightUIComponent::OnReleasedInside));
-        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(MakeDelegate(this, &HighlightUIComponent::OnReleasedOutside));
+        m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(this, &HighlightUIComponent::OnPressedInside);
+        m_moveEnteredConnection = GetWidget()->GetMoveEnteredEvent().OpenConnection(this, &HighlightUIComponent::OnMoveEntered);
+        m_moveExitedConnection = GetWidget()->GetMoveExitedEvent().OpenConnection(this, &HighlightUIComponent::OnMoveExited);
+        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(this, &HighlightUIComponent::OnReleasedInside);
+        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(this, &HighlightUIComponent::OnReleasedOutside);
     }
     //-------------------------------------------------------------------
     //-------------------------------------------------------------------
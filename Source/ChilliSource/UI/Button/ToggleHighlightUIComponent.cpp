@@ -359,11 +359,11 @@ namespace ChilliSource
             Highlight();
         }
         
-        m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(MakeDelegate(this, &ToggleHighlightUIComponent::OnPressedInside));
-        m_moveEnteredConnection = GetWidget()->GetMoveEnteredEvent().OpenConnection(MakeDelegate(this, &ToggleHighlightUIComponent::OnMoveEntered));
-        m_moveExitedConnection = GetWidget()->GetMoveExitedEvent().OpenConnection(MakeDelegate(this, &ToggleHighlightUIComponent::OnMoveExited));
-        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(MakeDelegate(this, &ToggleHighlightUIComponent::OnReleasedInside));
-        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(MakeDelegate(this, &ToggleHighlightUIComponent::OnReleasedOutside));
+        m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(this, &ToggleHighlightUIComponent::OnPressedInside);
+        m_moveEnteredConnection = GetWidget()->GetMoveEnteredEvent().OpenConnection(this, &ToggleHighlightUIComponent::OnMoveEntered);
+        m_moveExitedConnection = GetWidget()->GetMoveExitedEvent().OpenConnection(this, &ToggleHighlightUIComponent::OnMoveExited);
+        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(this, &ToggleHighlightUIComponent::OnReleasedInside);
+        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(this, &ToggleHighlightUIComponent::OnReleasedOutside);
     }
     //-------------------------------------------------------------------
     //-------------------------------------------------------------------
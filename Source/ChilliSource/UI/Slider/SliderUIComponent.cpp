@@ -204,11 +204,11 @@ namespace ChilliSource
         m_sliderWidget = GetWidget()->GetInternalWidget(m_sliderWidgetName);
         CS_ASSERT(m_sliderWidget != nullptr, "Could not find bar widget with name: " + m_sliderWidgetName);
         
-        m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(MakeDelegate(this, &SliderUIComponent::OnPressedInside));
-        m_draggedInsideConnection = GetWidget()->GetDraggedInsideEvent().OpenConnection(MakeDelegate(this, &SliderUIComponent::OnDraggedInside));
-        m_draggedOutsideConnection = GetWidget()->GetDraggedOutsideEvent().OpenConnection(MakeDelegate(this, &SliderUIComponent::OnDraggedOutside));
-        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(MakeDelegate(this, &SliderUIComponent::OnReleasedInside));
-        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(MakeDelegate(this, &SliderUIComponent::OnReleasedOutside));
+        m_pressedInsideConnection = GetWidget()->GetPressedInsideEvent().OpenConnection(this, &SliderUIComponent::OnPressedInside);
+        m_draggedInsideConnection = GetWidget()->GetDraggedInsideEvent().OpenConnection(this, &SliderUIComponent::OnDraggedInside);
+        m_draggedOutsideConnection = GetWidget()->GetDraggedOutsideEvent().OpenConnection(this, &SliderUIComponent::OnDraggedOutside);
+        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(this, &SliderUIComponent::OnReleasedInside);
+        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(this, &SliderUIComponent::OnReleasedOutside);
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -225,8 +225,8 @@ namespace ChilliSource
         CS_ASSERT(m_textComponent, "No text component found in editable text widget.");
         m_textComponent->SetText(m_initialText);
 
-        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(MakeDelegate(this, &EditableTextUIComponent::OnReleasedInside));
-        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(MakeDelegate(this, &EditableTextUIComponent::OnReleasedOutside));
+        m_releasedInsideConnection = GetWidget()->GetReleasedInsideEvent().OpenConnection(this, &EditableTextUIComponent::OnReleasedInside);
+        m_releasedOutsideConnection = GetWidget()->GetReleasedOutsideEvent().OpenConnection(this, &EditableTextUIComponent::OnReleasedOutside);
     }
 
     //-------------------------------------------------------------
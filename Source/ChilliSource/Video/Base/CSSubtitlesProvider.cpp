@@ -115,7 +115,7 @@ namespace ChilliSource
         SubtitlesSPtr pSubtitles = std::static_pointer_cast<Subtitles>(out_resource);
         
         //Load model as task
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleFileTask(out_resource->GetLoadPriority(), [=](const TaskContext&) noexcept
         {
             LoadSubtitles(in_storageLocation, in_filePath, in_delegate, pSubtitles);
         });